@@ -0,0 +1,86 @@
+#include "bench_common.h"
+#include "chunk_codec.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Points of a scanned chunk: a wavy floor and a wall of 2 m, 5 mm apart, in millimeters, with smooth colors
+    std::vector<MapPoint> makeChunk(size_t n, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> u(0.f, 2000.f), noise(-2.f, 2.f);
+        std::vector<MapPoint> points(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            const float a = u(rng), b = u(rng);
+            MapPoint &p = points[i];
+            if (i % 2)
+                p = {a, 30.f * std::sin(b * 0.003f) + noise(rng), b, 0};
+            else
+                p = {a, b, 2000.f + noise(rng), 0};
+            const uint32_t shade = (uint32_t)(p.x * 0.05f + p.y * 0.03f) & 0x3f;
+            p.color = ((120 + shade) << 16) | ((100 + shade) << 8) | (80 + shade);
+        }
+        return points;
+    }
+
+    void benchChunk(size_t nb_points, float step)
+    {
+        std::mt19937 rng(5);
+        const auto points = makeChunk(nb_points, rng);
+        std::vector<uint8_t> encoded;
+        const double encode_ms = bench::bestMs(5, [&] {
+            encoded.clear();
+            chunk_codec::encode(points.data(), points.size(), step, encoded);
+        });
+        std::vector<MapPoint> decoded;
+        bool ok = true;
+        const double decode_ms = bench::bestMs(5, [&] { ok &= chunk_codec::decode(encoded.data(), encoded.size(), decoded); });
+        const std::string name = std::to_string(nb_points) + " points, step " + std::to_string((int)step) + " mm";
+        std::cout << "[Bench] " << name << ": " << (double)encoded.size() / nb_points << " bytes per point (" << sizeof(MapPoint)
+                  << " raw)" << (ok && decoded.size() == nb_points ? "" : ", DECODING FAILED") << std::endl;
+        bench::report("encode " + name, encode_ms, (double)nb_points, "points");
+        bench::report("decode " + name, decode_ms, (double)nb_points, "points");
+    }
+
+    /// A batch of chunks as written by a recording and read back by a replay, on all the workers
+    void benchBatch(size_t nb_chunks, size_t nb_points, float step)
+    {
+        std::mt19937 rng(6);
+        std::vector<ChunkData> chunks(nb_chunks);
+        std::vector<const ChunkData *> pointers;
+        for (auto &it : chunks)
+        {
+            it.points = makeChunk(nb_points, rng);
+            pointers.push_back(&it);
+        }
+        std::vector<std::vector<uint8_t>> encoded;
+        const double encode_ms = bench::bestMs(3, [&] { chunk_codec::encode(pointers, step, encoded); });
+        std::vector<std::vector<MapPoint>> decoded;
+        bool ok = true;
+        const double decode_ms = bench::bestMs(3, [&] { ok &= chunk_codec::decode(encoded, decoded); });
+        size_t bytes = 0;
+        for (const auto &it : encoded)
+            bytes += it.size();
+        const std::string name = std::to_string(nb_chunks) + " chunks of " + std::to_string(nb_points) + " points";
+        if (!ok)
+            std::cout << "[Bench][Error] Decoding failed" << std::endl;
+        bench::report("batch encode " + name, encode_ms, (double)(nb_chunks * nb_points), "points");
+        bench::report("batch decode " + name, decode_ms, (double)(nb_chunks * nb_points), "points");
+        bench::report("batch decode " + name + ", compressed input", decode_ms, (double)bytes, "B");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bench::configurePool(argc, argv);
+    benchChunk(5000, 5.f);
+    benchChunk(50000, 5.f);
+    // Larger than the blocks of the parallel sort
+    benchChunk(500000, 5.f);
+    benchChunk(50000, 20.f);
+    benchBatch(256, 20000, 5.f);
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "bench_common.h"
+#include "chunk_octree.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Chunks of a few meters on a large map, in millimeters like the sample
+    std::vector<ChunkBounds> makeChunks(size_t n, float range, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> pos(-range, range), size(500.f, 3000.f);
+        std::vector<ChunkBounds> chunks(n);
+        for (auto &b : chunks)
+            for (int i = 0; i < 3; i++)
+            {
+                b.min[i] = i == 1 ? pos(rng) * 0.05f : pos(rng);
+                b.max[i] = b.min[i] + size(rng);
+            }
+        return chunks;
+    }
+
+    Frustum boxFrustum(const float *center, float half)
+    {
+        const float vp[16] = {1.f / half, 0.f, 0.f, -center[0] / half,
+                              0.f, 1.f / half, 0.f, -center[1] / half,
+                              0.f, 0.f, 1.f / half, -center[2] / half,
+                              0.f, 0.f, 0.f, 1.f};
+        Frustum frustum;
+        frustum.set(vp);
+        return frustum;
+    }
+
+    void benchOctree(size_t nb_chunks)
+    {
+        std::mt19937 rng(11);
+        const float range = 200000.f;
+        auto chunks = makeChunks(nb_chunks, range, rng);
+        ChunkOctree octree(2000.f);
+        const double build_ms = bench::bestMs(1, [&] {
+            for (size_t i = 0; i < chunks.size(); i++)
+                octree.update(0, (int)i, chunks[i]);
+        });
+        bench::report("octree insert " + std::to_string(nb_chunks) + " chunks", build_ms, (double)nb_chunks, "chunks");
+        // Chunks growing as the mapping goes, most stay in their node
+        const double move_ms = bench::bestMs(3, [&] {
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                chunks[i].max[0] += 10.f;
+                octree.update(0, (int)i, chunks[i]);
+            }
+        });
+        bench::report("octree update " + std::to_string(nb_chunks) + " chunks", move_ms, (double)nb_chunks, "chunks");
+
+        // Views of 1/8 of the map (a few percents of the chunks) at random places
+        std::uniform_real_distribution<float> pos(-range, range);
+        std::vector<Frustum> views(200);
+        for (auto &it : views)
+        {
+            const float center[3] = {pos(rng), 0.f, pos(rng)};
+            it = boxFrustum(center, range / 8.f);
+        }
+        size_t visible = 0;
+        const double tree_ms = bench::bestMs(3, [&] {
+            visible = 0;
+            for (const auto &view : views)
+                octree.queryFrustum(view, [&](int, int, bool) { visible++; });
+        });
+        size_t scanned = 0;
+        const double scan_ms = bench::bestMs(3, [&] {
+            scanned = 0;
+            for (const auto &view : views)
+                for (const auto &b : chunks)
+                    scanned += view.classify(b) != Frustum::OUTSIDE ? 1 : 0;
+        });
+        std::cout << "[Bench] " << (double)visible / views.size() << " visible chunks per view (" << (visible == scanned ? "same" : "NOT the same")
+                  << " as the linear scan)" << std::endl;
+        bench::report("octree frustum culling, " + std::to_string(nb_chunks) + " chunks", tree_ms, (double)views.size(), "views");
+        bench::report("linear frustum culling, " + std::to_string(nb_chunks) + " chunks", scan_ms, (double)views.size(), "views");
+    }
+}
+
+int main()
+{
+    benchOctree(2000);
+    benchOctree(50000);
+    return 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "thread_pool.h"
+
+/// Timing helpers of the benchmarks
+namespace bench
+{
+    /// Best time of f over repeats runs, in milliseconds
+    template <typename F>
+    double bestMs(int repeats, const F &f)
+    {
+        double best = 1e30;
+        for (int i = 0; i < repeats; i++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            f();
+            best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    /// Print a result as items per second
+    inline void report(const std::string &name, double ms, double items, const char *unit = "items")
+    {
+        std::cout << "[Bench] " << name << ": " << ms << " ms, " << (ms > 0. ? items / ms * 1e-3 : 0.) << " M" << unit << "/s" << std::endl;
+    }
+
+    /// Workers of the global pool from the first argument (default: one per core besides the calling thread)
+    inline void configurePool(int argc, char **argv)
+    {
+        if (argc > 1)
+            ThreadPool::configure(std::atoi(argv[1]));
+        std::cout << "[Bench] " << ThreadPool::global().getNbWorkers() << " workers" << std::endl;
+    }
+
+    /// Keeps a result alive so that the computation is not optimized out
+    template <typename T>
+    void keep(const T &value)
+    {
+        static volatile T sink;
+        sink = value;
+        // Read back, a store alone is "set but not used"
+        (void)sink;
+    }
+}
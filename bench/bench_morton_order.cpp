@@ -0,0 +1,160 @@
+#include "bench_common.h"
+#include "chunk_codec.h"
+#include "chunk_store.h"
+#include "morton_order.h"
+
+#include <cmath>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    const float CELL_SIZE = 10.f;
+
+    /// Points of a fused chunk in the order of the mapping (no spatial order): floor and wall of 2 m, in millimeters
+    std::vector<MapPoint> makeChunk(size_t n, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> u(0.f, 2000.f), noise(-2.f, 2.f);
+        std::vector<MapPoint> points(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            const float a = u(rng), b = u(rng);
+            if (i % 2)
+                points[i] = {a, 30.f * std::sin(b * 0.003f) + noise(rng), b, 0x806040};
+            else
+                points[i] = {a, b, 2000.f + noise(rng), 0x806040};
+        }
+        return points;
+    }
+
+    std::vector<MapPoint> mortonOrdered(const std::vector<MapPoint> &points)
+    {
+        const float origin[3] = {0.f, 0.f, 0.f};
+        std::vector<uint32_t> order(points.size());
+        morton::sortOrder(points.data(), points.size(), origin, CELL_SIZE, order.data());
+        std::vector<MapPoint> sorted(points.size());
+        for (size_t i = 0; i < points.size(); i++)
+            sorted[i] = points[order[i]];
+        return sorted;
+    }
+
+    double meanStep(const std::vector<MapPoint> &points)
+    {
+        double sum = 0.;
+        for (size_t i = 1; i < points.size(); i++)
+        {
+            const double dx = points[i].x - points[i - 1].x, dy = points[i].y - points[i - 1].y, dz = points[i].z - points[i - 1].z;
+            sum += std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+        return sum / std::max<size_t>(points.size() - 1, 1);
+    }
+
+    /// Cache lines holding the points of boxes of half size half around some of the points, on average per box
+    double linesPerBox(const std::vector<MapPoint> &points, const std::vector<MapPoint> &centers, float half, double &points_per_box)
+    {
+        size_t lines = 0, found = 0;
+        std::unordered_set<size_t> touched;
+        for (const auto &c : centers)
+        {
+            touched.clear();
+            for (size_t i = 0; i < points.size(); i++)
+                if (std::fabs(points[i].x - c.x) <= half && std::fabs(points[i].y - c.y) <= half && std::fabs(points[i].z - c.z) <= half)
+                {
+                    touched.insert(i * sizeof(MapPoint) / 64);
+                    found++;
+                }
+            lines += touched.size();
+        }
+        points_per_box = (double)found / centers.size();
+        return (double)lines / centers.size();
+    }
+
+    void benchSort(size_t nb_points)
+    {
+        std::mt19937 rng(7);
+        const auto points = makeChunk(nb_points, rng);
+        const float origin[3] = {0.f, 0.f, 0.f};
+        std::vector<uint32_t> order(nb_points);
+        const double ms = bench::bestMs(5, [&] { morton::sortOrder(points.data(), nb_points, origin, CELL_SIZE, order.data()); });
+        bench::report("Morton sort order of " + std::to_string(nb_points) + " points", ms, (double)nb_points, "points");
+    }
+
+    void benchLocality(size_t nb_points)
+    {
+        std::mt19937 rng(8);
+        const auto points = makeChunk(nb_points, rng);
+        const auto sorted = mortonOrdered(points);
+        std::cout << "[Bench] " << nb_points << " points, mean distance between consecutive points: " << meanStep(points) << " mm unordered, "
+                  << meanStep(sorted) << " mm in Morton order" << std::endl;
+
+        // Neighbourhoods of 5 cm, as read by a range query or a normal estimation
+        std::vector<MapPoint> centers(200);
+        std::uniform_int_distribution<size_t> pick(0, nb_points - 1);
+        for (auto &it : centers)
+            it = points[pick(rng)];
+        double found = 0.;
+        const double lines_raw = linesPerBox(points, centers, 50.f, found);
+        const double lines_sorted = linesPerBox(sorted, centers, 50.f, found);
+        std::cout << "[Bench] " << found << " points per 10 cm box, in " << lines_raw << " cache lines unordered, " << lines_sorted
+                  << " in Morton order (" << (found * sizeof(MapPoint) / 64) << " at best)" << std::endl;
+    }
+
+    /// The codec sorts its input in Morton order, a store in Morton order hands it sorted chunks
+    void benchCodec(size_t nb_points)
+    {
+        std::mt19937 rng(9);
+        const auto points = makeChunk(nb_points, rng);
+        const auto sorted = mortonOrdered(points);
+        std::vector<uint8_t> out;
+        const double raw_ms = bench::bestMs(5, [&] {
+            out.clear();
+            chunk_codec::encode(points.data(), points.size(), 5.f, out);
+        });
+        const size_t raw_bytes = out.size();
+        const double sorted_ms = bench::bestMs(5, [&] {
+            out.clear();
+            chunk_codec::encode(sorted.data(), sorted.size(), 5.f, out);
+        });
+        std::cout << "[Bench] Encoded " << nb_points << " points: " << (double)raw_bytes / nb_points << " bytes per point unordered, "
+                  << (double)out.size() / nb_points << " in Morton order" << std::endl;
+        bench::report("encode " + std::to_string(nb_points) + " unordered points", raw_ms, (double)nb_points, "points");
+        bench::report("encode " + std::to_string(nb_points) + " points in Morton order", sorted_ms, (double)nb_points, "points");
+    }
+
+    /// Cost of the layout on the update path of the store
+    void benchStore(size_t nb_chunks, size_t nb_points)
+    {
+        std::mt19937 rng(10);
+        std::vector<std::vector<MapPoint>> chunks(nb_chunks);
+        std::vector<ChunkInput> inputs;
+        for (size_t i = 0; i < nb_chunks; i++)
+        {
+            chunks[i] = makeChunk(nb_points, rng);
+            inputs.push_back({(int)i, chunks[i].data(), chunks[i].size()});
+        }
+        for (float cell_size : {0.f, CELL_SIZE})
+        {
+            ChunkStore store(1, 2000.f);
+            store.setMortonOrder(cell_size);
+            const double ms = bench::bestMs(5, [&] { store.update(0, inputs); });
+            bench::report(std::string("store update of ") + std::to_string(nb_chunks) + " chunks of " + std::to_string(nb_points) + " points, "
+                              + (cell_size > 0.f ? "Morton order" : "unordered"),
+                          ms, (double)(nb_chunks * nb_points), "points");
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bench::configurePool(argc, argv);
+    benchSort(5000);
+    benchSort(50000);
+    benchSort(500000);
+    benchLocality(50000);
+    benchCodec(50000);
+    benchStore(20, 5000);
+    // Relocalization: large update sorted on all the cores
+    benchStore(64, 20000);
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "bench_common.h"
+#include "parallel_primitives.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    void benchRadixSort(size_t n, int key_bits)
+    {
+        std::mt19937_64 rng(1);
+        const uint64_t mask = key_bits >= 64 ? ~0ull : (1ull << key_bits) - 1;
+        std::vector<uint64_t> input(n);
+        for (auto &it : input)
+            it = rng() & mask;
+        std::vector<uint64_t> keys;
+        std::vector<uint32_t> values(n);
+        const double radix_ms = bench::bestMs(5, [&] {
+            keys = input;
+            for (size_t i = 0; i < n; i++)
+                values[i] = (uint32_t)i;
+            parallel::radixSort(keys.data(), values.data(), n);
+        });
+        std::vector<std::pair<uint64_t, uint32_t>> pairs(n);
+        const double std_ms = bench::bestMs(5, [&] {
+            for (size_t i = 0; i < n; i++)
+                pairs[i] = std::make_pair(input[i], (uint32_t)i);
+            std::sort(pairs.begin(), pairs.end());
+        });
+        const std::string name = std::to_string(n) + " keys of " + std::to_string(key_bits) + " bits";
+        bench::report("radixSort " + name, radix_ms, (double)n, "keys");
+        bench::report("std::sort " + name, std_ms, (double)n, "keys");
+    }
+
+    void benchScanCompact(size_t n)
+    {
+        std::vector<uint32_t> in(n), out(n);
+        for (size_t i = 0; i < n; i++)
+            in[i] = (uint32_t)(i * 2654435761u);
+        const double scan_ms = bench::bestMs(5, [&] { bench::keep(parallel::exclusiveScan(in.data(), out.data(), n)); });
+        bench::report("exclusiveScan " + std::to_string(n), scan_ms, (double)n);
+        const double compact_ms = bench::bestMs(5, [&] { bench::keep(parallel::compact(in.data(), n, out.data(), [](uint32_t v) { return (v & 3) == 0; })); });
+        bench::report("compact 1/4 of " + std::to_string(n), compact_ms, (double)n);
+    }
+
+    /// Spin for us microseconds
+    void work(int us)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        double x = 0.;
+        while (std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() < us)
+            x += std::sqrt(x + 1.);
+        bench::keep(x);
+    }
+
+    /// forEach against a thread per task
+    void benchTasks(int nb_tasks, int us)
+    {
+        const double pool_ms = bench::bestMs(3, [&] { parallel::forEach(nb_tasks, [&](size_t) { work(us); }); });
+        const double threads_ms = bench::bestMs(3, [&] {
+            std::vector<std::thread> threads;
+            for (int i = 0; i < nb_tasks; i++)
+                threads.emplace_back([&] { work(us); });
+            for (auto &it : threads)
+                it.join();
+        });
+        const std::string name = std::to_string(nb_tasks) + " tasks of " + std::to_string(us) + " us";
+        bench::report("forEach " + name, pool_ms, nb_tasks, "tasks");
+        bench::report("thread per task " + name, threads_ms, nb_tasks, "tasks");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bench::configurePool(argc, argv);
+    benchRadixSort(1 << 16, 30);
+    benchRadixSort(1 << 20, 30);
+    benchRadixSort(1 << 20, 63);
+    benchScanCompact(1 << 22);
+    benchTasks(2000, 5);
+    benchTasks(2000, 50);
+    return 0;
+}
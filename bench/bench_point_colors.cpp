@@ -0,0 +1,144 @@
+#include <GL/glew.h>
+#include <GL/freeglut.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "bench_common.h"
+#include "frame_buffer.h"
+#include "map_point.h"
+#include "shader.h"
+
+// Color of the fused points unpacked by the vertex shader (before) or by the vertex fetch (after, as SubMapObj)
+
+namespace
+{
+    GLchar SHADER_UNPACK_VERTEX_SHADER[] =
+        "#version 330 core\n"
+        "layout(location = 0) in vec4 in_VertexRGBA;\n"
+        "uniform mat4 u_mvpMatrix;\n"
+        "out vec3 b_color;\n"
+        "void main() {\n"
+        "   uint vertexColor = floatBitsToUint(in_VertexRGBA.w);\n"
+        "   b_color = vec3(((vertexColor & uint(0x00FF0000)) >> 16) / 255.f, ((vertexColor & uint(0x0000FF00)) >> 8) / 255.f, (vertexColor & uint(0x000000FF)) / 255.f);\n"
+        "   gl_Position = u_mvpMatrix * vec4(in_VertexRGBA.xyz, 1);\n"
+        "   gl_PointSize = 1.0;\n"
+        "}";
+
+    GLchar FETCH_UNPACK_VERTEX_SHADER[] =
+        "#version 330 core\n"
+        "layout(location = 0) in vec3 in_Vertex;\n"
+        "layout(location = 1) in vec3 in_Color;\n"
+        "uniform mat4 u_mvpMatrix;\n"
+        "out vec3 b_color;\n"
+        "void main() {\n"
+        "   b_color = in_Color;\n"
+        "   gl_Position = u_mvpMatrix * vec4(in_Vertex, 1);\n"
+        "   gl_PointSize = 1.0;\n"
+        "}";
+
+    /// Points in the view, in [-1, 1]
+    std::vector<MapPoint> makePoints(size_t n)
+    {
+        std::mt19937 rng(12);
+        std::uniform_real_distribution<float> u(-1.f, 1.f);
+        std::vector<MapPoint> points(n);
+        for (auto &p : points)
+            p = {u(rng), u(rng), u(rng) * 0.5f + 0.5f, (uint32_t)rng() & 0xffffff};
+        return points;
+    }
+
+    /// Best GPU time of the draw over repeats, in milliseconds
+    double gpuBestMs(int repeats, GLsizei nb_points)
+    {
+        GLuint query;
+        glGenQueries(1, &query);
+        double best = 1e30;
+        for (int i = 0; i < repeats; i++)
+        {
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            glBeginQuery(GL_TIME_ELAPSED, query);
+            glDrawArrays(GL_POINTS, 0, nb_points);
+            glEndQuery(GL_TIME_ELAPSED);
+            GLuint64 elapsed_ns = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed_ns);
+            best = std::min(best, elapsed_ns * 1e-6);
+        }
+        glDeleteQueries(1, &query);
+        return best;
+    }
+
+    void benchVariant(const char *name, GLchar *vertex_shader, bool fetch_unpack, GLsizei nb_points)
+    {
+        Shader shader(vertex_shader, FRAGMENT_SHADER);
+        glUseProgram(shader.getProgramId());
+        const float identity[16] = {1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f};
+        glUniformMatrix4fv(glGetUniformLocation(shader.getProgramId(), "u_mvpMatrix"), 1, GL_TRUE, identity);
+
+        GLuint vao;
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glEnableVertexAttribArray(Shader::ATTRIB_VERTICES_POS);
+        if (fetch_unpack)
+        {
+            glVertexAttribPointer(Shader::ATTRIB_VERTICES_POS, 3, GL_FLOAT, GL_FALSE, sizeof(MapPoint), 0);
+            glVertexAttribPointer(Shader::ATTRIB_COLOR_POS, GL_BGRA, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(MapPoint), (void *)offsetof(MapPoint, color));
+            glEnableVertexAttribArray(Shader::ATTRIB_COLOR_POS);
+        }
+        else
+            glVertexAttribPointer(Shader::ATTRIB_VERTICES_POS, 4, GL_FLOAT, GL_FALSE, sizeof(MapPoint), 0);
+
+        // Vertex stage alone, then with the points rasterized
+        glEnable(GL_RASTERIZER_DISCARD);
+        const double vertex_ms = gpuBestMs(50, nb_points);
+        glDisable(GL_RASTERIZER_DISCARD);
+        const double draw_ms = gpuBestMs(50, nb_points);
+        bench::report(std::string(name) + ", vertex stage", vertex_ms, (double)nb_points, "points");
+        bench::report(std::string(name) + ", draw", draw_ms, (double)nb_points, "points");
+
+        glBindVertexArray(0);
+        glDeleteVertexArrays(1, &vao);
+        glUseProgram(0);
+    }
+}
+
+/// ./bench_point_colors [millions of points], needs a display
+int main(int argc, char **argv)
+{
+    const size_t nb_points = (size_t)((argc > 1 ? std::atof(argv[1]) : 8.) * 1e6);
+    glutInit(&argc, argv);
+    glutInitDisplayMode(GLUT_RGBA | GLUT_DEPTH);
+    glutInitWindowSize(64, 64);
+    glutCreateWindow("bench_point_colors");
+    if (glewInit() != GLEW_OK)
+    {
+        std::cout << "[Bench][Error] Unable to initialize OpenGL" << std::endl;
+        return EXIT_FAILURE;
+    }
+    glutHideWindow();
+    std::cout << "[Bench] " << glGetString(GL_RENDERER) << ", " << nb_points << " points" << std::endl;
+
+    FrameBuffer target;
+    if (!target.resize(1920, 1080))
+    {
+        std::cout << "[Bench][Error] Unable to create the render target" << std::endl;
+        return EXIT_FAILURE;
+    }
+    target.bind();
+    glEnable(GL_DEPTH_TEST);
+
+    const auto points = makePoints(nb_points);
+    GLuint vbo;
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(MapPoint), points.data(), GL_STATIC_DRAW);
+
+    benchVariant("color unpacked by the shader", SHADER_UNPACK_VERTEX_SHADER, false, (GLsizei)nb_points);
+    benchVariant("color unpacked by the vertex fetch", FETCH_UNPACK_VERTEX_SHADER, true, (GLsizei)nb_points);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDeleteBuffers(1, &vbo);
+    FrameBuffer::unbind();
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "bench_common.h"
+#include "simd_math.h"
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /// Plain loops, what the compiler does without the SSE path
+    simd::Mat4 scalarMultiply(const simd::Mat4 &a, const simd::Mat4 &b)
+    {
+        simd::Mat4 r;
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+            {
+                float sum = 0.f;
+                for (int k = 0; k < 4; k++)
+                    sum += a.m[i * 4 + k] * b.m[k * 4 + j];
+                r.m[i * 4 + j] = sum;
+            }
+        return r;
+    }
+
+    /// General inverse (Gauss-Jordan with pivoting), as done before the closed-form rigid inverse
+    simd::Mat4 generalInverse(const simd::Mat4 &a)
+    {
+        float m[4][8];
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 8; j++)
+                m[i][j] = j < 4 ? a.m[i * 4 + j] : (j - 4 == i ? 1.f : 0.f);
+        for (int c = 0; c < 4; c++)
+        {
+            int pivot = c;
+            for (int i = c + 1; i < 4; i++)
+                if (std::fabs(m[i][c]) > std::fabs(m[pivot][c]))
+                    pivot = i;
+            for (int j = 0; j < 8; j++)
+                std::swap(m[c][j], m[pivot][j]);
+            const float inv = 1.f / m[c][c];
+            for (int j = 0; j < 8; j++)
+                m[c][j] *= inv;
+            for (int i = 0; i < 4; i++)
+                if (i != c)
+                {
+                    const float f = m[i][c];
+                    for (int j = 0; j < 8; j++)
+                        m[i][j] -= f * m[c][j];
+                }
+        }
+        simd::Mat4 r;
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+                r.m[i * 4 + j] = m[i][j + 4];
+        return r;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(1);
+    std::normal_distribution<float> n(0.f, 1.f);
+    const int N = 4096;
+    std::vector<simd::Mat4> poses(N);
+    for (auto &it : poses)
+    {
+        float q[4], t[3] = {n(rng) * 1000.f, n(rng) * 1000.f, n(rng) * 1000.f}, norm = 0.f;
+        for (auto &c : q)
+        {
+            c = n(rng);
+            norm += c * c;
+        }
+        for (auto &c : q)
+            c /= std::sqrt(norm);
+        it = simd::fromQuatTranslation(q, t);
+    }
+    std::vector<simd::Mat4> out(N);
+    const int repeats = 20;
+
+    const double rigid_ms = bench::bestMs(repeats, [&] {
+        for (int i = 0; i < N; i++)
+            out[i] = simd::rigidInverse(poses[i]);
+    });
+    bench::keep(out[N / 2].m[3]);
+    const double general_ms = bench::bestMs(repeats, [&] {
+        for (int i = 0; i < N; i++)
+            out[i] = generalInverse(poses[i]);
+    });
+    bench::keep(out[N / 2].m[3]);
+    const double multiply_ms = bench::bestMs(repeats, [&] {
+        for (int i = 0; i < N; i++)
+            out[i] = simd::multiply(poses[i], poses[(i + 1) % N]);
+    });
+    bench::keep(out[N / 2].m[3]);
+    const double scalar_ms = bench::bestMs(repeats, [&] {
+        for (int i = 0; i < N; i++)
+            out[i] = scalarMultiply(poses[i], poses[(i + 1) % N]);
+    });
+    bench::keep(out[N / 2].m[3]);
+
+#ifdef SIMD_MATH_SSE
+    std::cout << "[Bench] SSE path" << std::endl;
+#else
+    std::cout << "[Bench] plain C++ path" << std::endl;
+#endif
+    bench::report("simd::rigidInverse", rigid_ms, N, "matrices");
+    bench::report("general 4x4 inverse", general_ms, N, "matrices");
+    bench::report("simd::multiply", multiply_ms, N, "matrices");
+    bench::report("scalar 4x4 multiply", scalar_ms, N, "matrices");
+    return 0;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+/// Memory aligned beyond what operator new guarantees before C++17 (cache lines)
+namespace aligned
+{
+    /// bytes aligned on alignment (a power of two), null if out of memory
+    inline void *allocate(size_t bytes, size_t alignment)
+    {
+        if (alignment < sizeof(void *))
+            alignment = sizeof(void *);
+#if defined(_WIN32)
+        return _aligned_malloc(bytes ? bytes : 1, alignment);
+#else
+        void *p = nullptr;
+        return posix_memalign(&p, alignment, bytes ? bytes : 1) == 0 ? p : nullptr;
+#endif
+    }
+
+    inline void release(void *p)
+    {
+#if defined(_WIN32)
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
+
+    /// Deleter of the objects created by makeUnique
+    template <typename T>
+    struct Deleter
+    {
+        void operator()(T *p) const
+        {
+            p->~T();
+            release(p);
+        }
+    };
+
+    template <typename T>
+    using unique_ptr = std::unique_ptr<T, Deleter<T>>;
+
+    /// new T(args...) honouring alignof(T), e.g. a struct holding alignas(64) members
+    template <typename T, typename... Args>
+    unique_ptr<T> makeUnique(Args &&...args)
+    {
+        void *p = allocate(sizeof(T), alignof(T));
+        if (!p)
+            throw std::bad_alloc();
+        return unique_ptr<T>(new (p) T(std::forward<Args>(args)...));
+    }
+}
+
+/// Allocator of the standard containers honouring the alignment of T, e.g. alignas(64) nodes in a std::vector
+template <typename T, size_t Alignment = alignof(T)>
+class AlignedAllocator
+{
+public:
+    typedef T value_type;
+    template <typename U>
+    struct rebind
+    {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &) {}
+
+    T *allocate(size_t n)
+    {
+        void *p = aligned::allocate(n * sizeof(T), Alignment);
+        if (!p)
+            throw std::bad_alloc();
+        return static_cast<T *>(p);
+    }
+    void deallocate(T *p, size_t) { aligned::release(p); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment> &) const { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment> &) const { return false; }
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+/// Count of the heap allocations, to check that the processing of an update stays off the heap
+///
+/// Only counted when built with MAP_COUNT_ALLOCATIONS (CMake option COUNT_ALLOCATIONS), which
+/// replaces the global operator new; otherwise the counts stay at 0.
+namespace alloc_counter
+{
+    bool isEnabled();
+    /// Allocations made by the calling thread since it started
+    unsigned long long getThreadCount();
+    /// Allocations made by all the threads
+    unsigned long long getTotalCount();
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <sl/Camera.hpp>
+
+#include <string>
+#include <vector>
+
+#include "offscreen_recorder.h"
+
+/// All the tunable parameters of the sample
+///
+/// Every field can be set in a config file, one `key = value` per line (`#` starts a comment),
+/// and overridden on the command line with `--key=value` (or `--key` for booleans).
+/// The keys are listed in the README and next to each field.
+struct AppConfig
+{
+    // Input
+    /// input : SVO file, stream `<ip>[:<port>]` or camera resolution (HD2K, HD1080, HD720, VGA) optionally
+    /// followed by `@<id>` or `@sn<serial>` to select the camera, also accepted as the first argument which
+    /// is not an option. Several sources separated by commas are mapped together, each on its own thread.
+    std::string input;
+
+    // Camera
+    /// depth-mode : PERFORMANCE, QUALITY or ULTRA
+    sl::DEPTH_MODE depth_mode = sl::DEPTH_MODE::ULTRA;
+    /// camera-fps : 0 for the default frame rate of the resolution
+    int camera_fps = 0;
+    /// max-depth : maximum depth in meters, 0 for the SDK default
+    float max_depth = 0.f;
+    /// confidence : depth confidence threshold [1, 100], low values avoid introducing noise in the model
+    int confidence_threshold = 50;
+
+    // Spatial mapping
+    /// mapping-range : SHORT, MEDIUM, LONG or AUTO
+    sl::SpatialMappingParameters::MAPPING_RANGE mapping_range = sl::SpatialMappingParameters::MAPPING_RANGE::LONG;
+    /// mapping-resolution : voxel size in meters, 0 to deduce it from the range
+    float mapping_resolution = 0.f;
+    /// map-request-interval : minimum time between two spatial map requests, in milliseconds
+    int map_request_interval_ms = 30;
+    /// morton-order : sort the points of the merged chunks along a Z-order curve of voxels, for the memory locality of the viewer, the export and the compression
+    bool morton_order = true;
+
+    // Outputs
+    /// headless : run the grab/mapping loop without the OpenGL viewer and the OpenCV preview
+    bool headless = false;
+    /// export : if not empty, the fused point cloud is extracted and saved to this file on exit
+    /// (binary PLY, or a compressed map recording if it ends with .zmap)
+    std::string export_path;
+    /// export-box : only export the points in this box, `<xmin>,<ymin>,<zmin>,<xmax>,<ymax>,<zmax>` in meters, empty for all
+    std::vector<float> export_box;
+    /// page-dir : existing directory where the map chunks old and far from the cameras are paged out, empty to keep them all in memory
+    std::string page_dir;
+    /// page-after : chunks not updated nor viewed for this long can be paged out, in seconds
+    float page_after = 60.f;
+    /// page-distance : chunks closer than this to their camera stay in memory, in meters
+    float page_distance = 10.f;
+    /// serve : publish the poses and the map chunks to remote viewers on `<port>` or `unix:<path>`, empty to disable
+    std::string serve;
+    /// serve-buffer : data queued per client in KB before its chunks are decimated
+    int serve_buffer_kb = 1024;
+    /// serve-loopback : connect a client to the server in the same process and report what it rebuilt, to test the stream
+    bool serve_loopback = false;
+    /// codec-precision : quantization steps per voxel of the compressed chunks (stream and .zmap recordings)
+    float codec_precision = 8.f;
+    /// preview : display the left image in an OpenCV window (ignored when headless or offscreen)
+    bool preview = true;
+    /// preview-size : maximum size of the OpenCV image preview, `<width>x<height>`
+    int preview_width = 720;
+    int preview_height = 404;
+    /// preview-fps : maximum number of images displayed per second, fewer images are retrieved from the camera
+    float preview_fps = 15.f;
+
+    // Viewer
+    /// edl : enable the Eye-Dome Lighting shading of the point cloud at start
+    bool edl = false;
+    /// viewer-fps : maximum number of frames per second drawn by the viewer
+    float viewer_fps = 30.f;
+    /// vsync : synchronize the viewer with the display refresh
+    bool vsync = false;
+    /// path-buffer-size : number of camera path vertices allocated ahead
+    int path_buffer_size = 36000;
+    /// gpu-budget : maximum VRAM used by the map chunks in MB, the least recently visible ones are evicted, 0 for no limit
+    int gpu_budget_mb = 1024;
+    /// gpu-upload-budget : maximum size of the chunks uploaded per frame in MB, to keep frame times stable, 0 for no limit
+    int gpu_upload_budget_mb = 64;
+    /// lod-size : map chunks smaller than this on screen, in pixels, draw a part of their points as larger splats, 0 to draw them all
+    float lod_size = 64.f;
+    /// source-tint : how much the points are tinted with the color of their source when there are several, [0, 1]
+    float source_tint = 0.35f;
+    /// pose-queue-size : number of poses the grab loop can queue ahead of the viewer for the camera path
+    int pose_queue_size = 1024;
+    /// offscreen, offscreen-size, offscreen-fps, offscreen-raw, offscreen-queue-size :
+    /// offscreen rendering of the viewer, the image preview is disabled when it is enabled
+    OffscreenParameters offscreen;
+
+    // Threads
+    /// opencv-threads : number of threads used by OpenCV, -1 for its default
+    int opencv_threads = -1;
+    /// worker-threads : threads of the pool of the background stages (chunk sorting, compression, export, recording),
+    /// -1 for the cores left by the grab threads and the viewer
+    int worker_threads = -1;
+};
+
+/// Fill the configuration from the optional config file (`--config=<file>`) then from the command line
+/// @return false if an option is unknown or invalid, the errors are printed
+bool parse_args(int argc, char **argv, AppConfig &config);
+
+/// Set the value of one key of the configuration
+/// @return false if the key is unknown or the value invalid
+bool setConfigValue(AppConfig &config, const std::string &key, const std::string &value);
+
+/// Check the consistency of the configuration
+/// @return false if a value is out of range, the errors are printed
+bool validateConfig(const AppConfig &config);
+
+/// Split the input of the configuration in its sources, there is always at least one (possibly empty)
+std::vector<std::string> getInputs(const AppConfig &config);
+
+/// Apply the camera settings of the configuration and one of its inputs to the ZED initialization parameters
+void setInitParameters(const AppConfig &config, const std::string &input, sl::InitParameters &param);
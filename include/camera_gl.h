@@ -1,6 +1,7 @@
 #pragma once
 
-#include <sl/Camera.hpp>
+#include "simd_math.h"
+#include "viewer_math.h"
 
 /// CameralGL is mainly for calculating and updating View Projection Matrix
 class CameraGL
@@ -16,12 +17,13 @@ public:
         FORWARD,
         BACK
     };
-    CameraGL(sl::Translation position, sl::Translation direction, sl::Translation vertical = sl::Translation(0, 1, 0)); // vertical = Eigen::Vector3f(0, 1, 0)
+    CameraGL(vmath::Translation position, vmath::Translation direction, vmath::Translation vertical = vmath::Translation(0, 1, 0));
     ~CameraGL();
 
     void update();
     void setProjection(float horizontalFOV, float verticalFOV, float znear, float zfar);
-    const sl::Transform &getViewProjectionMatrix() const;
+    /// Row major
+    const simd::Mat4 &getViewProjectionMatrix() const;
 
     float getHorizontalFOV() const;
     float getVerticalFOV() const;
@@ -29,30 +31,28 @@ public:
     // Set an offset between the eye of the camera and its position
     // Note: Useful to use the camera as a trackball camera with z>0 and x = 0, y = 0
     // Note: coordinates are in local space
-    void setOffsetFromPosition(const sl::Translation &offset);
-    const sl::Translation &getOffsetFromPosition() const;
+    void setOffsetFromPosition(const vmath::Translation &offset);
+    const vmath::Translation &getOffsetFromPosition() const;
 
-    void setDirection(const sl::Translation &direction, const sl::Translation &vertical);
-    void translate(const sl::Translation &t);
-    void setPosition(const sl::Translation &p);
-    void rotate(const sl::Orientation &rot);
-    void rotate(const sl::Rotation &m);
-    void setRotation(const sl::Orientation &rot);
-    void setRotation(const sl::Rotation &m);
+    void setDirection(const vmath::Translation &direction, const vmath::Translation &vertical);
+    void translate(const vmath::Translation &t);
+    void setPosition(const vmath::Translation &p);
+    void rotate(const vmath::Orientation &rot);
+    void setRotation(const vmath::Orientation &rot);
 
-    const sl::Translation &getPosition() const;
-    const sl::Translation &getForward() const;
-    const sl::Translation &getRight() const;
-    const sl::Translation &getUp() const;
-    const sl::Translation &getVertical() const;
+    const vmath::Translation &getPosition() const;
+    const vmath::Translation &getForward() const;
+    const vmath::Translation &getRight() const;
+    const vmath::Translation &getUp() const;
+    const vmath::Translation &getVertical() const;
     float getZNear() const;
     float getZFar() const;
 
-    static const sl::Translation ORIGINAL_FORWARD;
-    static const sl::Translation ORIGINAL_UP;
-    static const sl::Translation ORIGINAL_RIGHT;
+    static const vmath::Translation ORIGINAL_FORWARD;
+    static const vmath::Translation ORIGINAL_UP;
+    static const vmath::Translation ORIGINAL_RIGHT;
 
-    sl::Transform projection_;
+    simd::Mat4 projection_;
 
 private:
     void updateVectors();
@@ -69,17 +69,17 @@ private:
     void updateView();
     void updateVPMatrix();
 
-    sl::Translation offset_;
-    sl::Translation position_;
-    sl::Translation forward_;
-    sl::Translation up_;
-    sl::Translation right_;
-    sl::Translation vertical_;
+    vmath::Translation offset_;
+    vmath::Translation position_;
+    vmath::Translation forward_;
+    vmath::Translation up_;
+    vmath::Translation right_;
+    vmath::Translation vertical_;
 
-    sl::Orientation rotation_;
+    vmath::Orientation rotation_;
 
-    sl::Transform view_;
-    sl::Transform vpMatrix_;
+    simd::Mat4 view_;
+    simd::Mat4 vpMatrix_;
     float horizontalFieldOfView_;
     float verticalFieldOfView_;
     float znear_;
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <sl/Camera.hpp>
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "app_config.h"
+#include "chunk_store.h"
+#include "image_preview.h"
+#include "utils.h"
+
+/// One camera, stream or SVO mapped on its own thread
+///
+/// The thread grabs, tracks and requests the fused point cloud of its camera, and merges the updated
+/// chunks in the shared ChunkStore as soon as they are retrieved. Nothing waits for the viewer.
+class CameraSource
+{
+public:
+    /// Called from the thread of the source for every new pose
+    typedef std::function<void(int source, const sl::Pose &pose, sl::POSITIONAL_TRACKING_STATE state)> PoseCallback;
+
+    explicit CameraSource(int id);
+    ~CameraSource();
+
+    /// Open the input and enable the positional tracking and the spatial mapping
+    bool open(const AppConfig &config, const std::string &input);
+    void close();
+
+    /// Start the ingest thread, preview may be null (only one source can feed it)
+    void start(ChunkStore &store, PoseCallback on_pose, ImagePreview *preview);
+    /// Stop the ingest thread, then merge the whole map in the store if whole_map is set
+    /// Note: the whole map is extracted in memory at once, avoid it when paging
+    void stop(bool whole_map);
+
+    /// False once the thread stopped by itself (end of the SVO)
+    bool isRunning() const { return running_; }
+
+    int getId() const { return id_; }
+    sl::CameraInformation getCameraInformation() { return zed_.getCameraInformation(); }
+    /// Voxel size of the map, in the coordinate units of the camera
+    float getMapResolution() const { return map_resolution_; }
+    /// Number of coordinate units in one meter
+    float getUnitsPerMeter() const { return units_per_meter_; }
+    /// Size of the images retrieved for the preview
+    sl::Resolution getPreviewResolution() const { return preview_resolution_; }
+    const LoopStats &getStats() const { return stats_; }
+
+private:
+    void run();
+    /// Merge the updated chunks of map_ in the store, or all of them
+    void mergeChunks(bool all);
+
+    int id_;
+    sl::Camera zed_;
+    sl::FusedPointCloud map_;
+    sl::RuntimeParameters runtime_parameters_;
+    sl::Resolution preview_resolution_;
+    int map_request_interval_ms_ = 30;
+    float map_resolution_ = 0.f;
+    float units_per_meter_ = 1.f;
+    /// Free the vertices of the chunks of map_ once merged, the store keeps (and pages) them
+    bool release_merged_ = false;
+
+    ChunkStore *store_ = nullptr;
+    PoseCallback on_pose_;
+    ImagePreview *preview_ = nullptr;
+    std::vector<ChunkInput> inputs_;
+
+    std::thread thread_;
+    std::atomic<bool> stop_requested_;
+    std::atomic<bool> running_;
+    LoopStats stats_;
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+/// Axis aligned bounding box
+struct ChunkBounds
+{
+    float min[3];
+    float max[3];
+};
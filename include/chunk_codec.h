@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "chunk_store.h"
+#include "thread_pool.h"
+
+/// Compression of the map chunks, for the recordings and the map stream
+///
+/// The positions are quantized on a grid of a given step, sorted in Morton order and their Morton
+/// codes are delta coded; the colors are decorrelated (R-G, G, B-G) and delta coded along the same
+/// order. Both streams use Rice codes with a parameter adapted per block of 64 points. Decoding gives
+/// back the grid positions and the colors exactly, in Morton order. Points which cannot be quantized
+/// (non-finite values, chunk larger than 2^21 steps) are stored raw.
+namespace chunk_codec
+{
+    /// Append the encoded points to out, one point out of stride
+    /// @param step : size of the quantization grid, in coordinate units
+    /// @return the encoded size in bytes
+    size_t encode(const MapPoint *points, size_t nb_points, float step, std::vector<uint8_t> &out, size_t stride = 1);
+
+    /// Points of an encoded chunk
+    /// @return false if the data is malformed
+    bool decode(const uint8_t *data, size_t size, std::vector<MapPoint> &points);
+
+    /// Encode every chunk in out[i], on nb_threads of the ThreadPool at most (0 for all of them)
+    /// @param priority : of the tasks and of the sorts of the large chunks they split in
+    void encode(const std::vector<const ChunkData *> &chunks, float step, std::vector<std::vector<uint8_t>> &out, int nb_threads = 0,
+                ThreadPool::Priority priority = ThreadPool::getCurrentPriority());
+
+    /// Decode every encoded chunk in points[i], on nb_threads of the ThreadPool at most (0 for all of them)
+    /// @return false if one of them is malformed
+    bool decode(const std::vector<std::vector<uint8_t>> &encoded, std::vector<std::vector<MapPoint>> &points, int nb_threads = 0);
+
+    /// Description of a recorded map
+    struct StreamInfo
+    {
+        int nbSources = 1;
+        /// Coordinate units in one meter
+        float unitsPerMeter = 1000.f;
+        /// Voxel size of the map, in coordinate units
+        float mapResolution = 50.f;
+        /// Quantization step of the positions, in coordinate units
+        float step = 6.25f;
+        /// Camera model of each source (CameraModel)
+        std::vector<int32_t> cameraModels;
+    };
+
+    /// Write a map to a file as a sequence of encoded chunks
+    ///
+    /// The chunks are buffered and encoded in parallel by batches, as low priority tasks of the worker
+    /// pool. A chunk written several times is replaced by its last content when the file is read.
+    class StreamWriter
+    {
+    public:
+        ~StreamWriter();
+
+        bool open(const std::string &path, const StreamInfo &info);
+        /// Add a chunk, the points are copied
+        bool write(int source, int index, const MapPoint *points, size_t nb_points);
+        /// Write the buffered chunks and close the file
+        /// @return false if a write failed
+        bool close();
+
+        size_t getNbPoints() const { return nbPoints_; }
+        /// Bytes written so far
+        size_t getSize() const { return size_; }
+
+    private:
+        bool flush();
+
+        FILE *file_ = nullptr;
+        StreamInfo info_;
+        std::vector<int> sources_;
+        std::vector<int> indices_;
+        std::vector<ChunkData> pending_;
+        size_t pendingPoints_ = 0;
+        size_t nbPoints_ = 0;
+        size_t size_ = 0;
+        bool ok_ = true;
+    };
+
+    /// Read a map written by a StreamWriter
+    class StreamReader
+    {
+    public:
+        /// Called for every chunk, in the order of the file
+        typedef std::function<void(int source, int index, std::vector<MapPoint> &points)> ChunkCallback;
+
+        ~StreamReader();
+
+        bool open(const std::string &path);
+        const StreamInfo &getInfo() const { return info_; }
+        /// Read and decode the next chunks (in parallel), up to max_points points
+        /// @return the number of chunks read, 0 at the end of the file or on error
+        size_t read(const ChunkCallback &f, size_t max_points = 1 << 22);
+        /// False if the file is truncated or malformed
+        bool isValid() const { return ok_; }
+        void close();
+
+    private:
+        FILE *file_ = nullptr;
+        StreamInfo info_;
+        bool ok_ = true;
+    };
+
+    /// Record all the chunks of a store, or only their points inside box if given
+    bool saveStore(ChunkStore &store, const std::string &path, const StreamInfo &info, const ChunkBounds *box = nullptr);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "aligned_allocator.h"
+#include "chunk_bounds.h"
+#include "frustum.h"
+
+/// Node of a ChunkOctree, one cache line (stored with an AlignedAllocator, std::allocator ignores the alignment before C++17)
+struct alignas(64) OctreeNode
+{
+    float center[3];
+    /// Half size of the cube, the node holds chunks within twice this distance of its center (loose octree)
+    float half;
+    /// -1 if there is no child in the octant
+    int32_t children[8];
+    /// First chunk of the node, -1 if none
+    int32_t firstItem;
+    int32_t parent;
+    /// Number of chunks in the subtree
+    uint32_t nbItems;
+    /// Size of the node in powers of 2 of the smallest node size
+    uint32_t level;
+};
+static_assert(sizeof(OctreeNode) == 64, "OctreeNode must fit in a cache line");
+
+/// Loose octree over the bounds of the map chunks, built incrementally
+///
+/// A chunk is stored in the deepest node whose loose cube (twice the node size) contains it, so it is
+/// never split and moving it only touches two nodes. The root grows as the map extends. Used for the
+/// hierarchical frustum culling of the viewer and for the CPU range queries of the store.
+class ChunkOctree
+{
+public:
+    /// min_half : half size of the smallest nodes, in coordinate units
+    explicit ChunkOctree(float min_half = 1000.f);
+
+    /// Change the size of the smallest nodes, only before the first update
+    void setMinHalf(float min_half)
+    {
+        if (nodes_.empty())
+            minHalf_ = min_half;
+    }
+
+    /// Insert a chunk or update its bounds, a chunk with non-finite bounds is removed (it cannot be placed)
+    void update(int source, int index, const ChunkBounds &bounds);
+    void remove(int source, int index);
+
+    /// Call f on every chunk in the frustum, inside is set if the chunk is entirely in it
+    void queryFrustum(const Frustum &frustum, const std::function<void(int source, int index, bool inside)> &f) const;
+    /// Call f on every chunk intersecting the box
+    void queryBox(const ChunkBounds &box, const std::function<void(int source, int index)> &f) const;
+
+    size_t getNbItems() const { return itemOf_.size(); }
+    size_t getNbNodes() const { return nodes_.size(); }
+    /// Number of levels from the root to the deepest node
+    uint32_t getDepth() const;
+
+    /// Print the size of the tree and the average cost of the updates and of the queries
+    void report(const std::string &name) const;
+
+private:
+    struct Item
+    {
+        int source;
+        int index;
+        ChunkBounds bounds;
+        int32_t node;
+        int32_t next;
+    };
+
+    static uint64_t key(int source, int index) { return ((uint64_t)(uint32_t)source << 32) | (uint32_t)index; }
+
+    int32_t allocNode(const float *center, float half, int32_t parent, uint32_t level);
+    /// Grow the root until its cube contains the center of the box and its loose cube the box
+    void grow(const float *center, float extent);
+    /// Deepest node able to hold a box, created if needed
+    int32_t findNode(const float *center, float extent);
+    void link(int32_t item, int32_t node);
+    void unlink(int32_t item);
+
+    void queryFrustum(int32_t node, bool inside, const Frustum &frustum, const std::function<void(int, int, bool)> &f) const;
+
+    std::vector<OctreeNode, AlignedAllocator<OctreeNode>> nodes_;
+    int32_t root_ = -1;
+    uint32_t minLevel_ = 0;
+    float minHalf_;
+
+    std::vector<Item> items_;
+    std::vector<int32_t> freeItems_;
+    std::unordered_map<uint64_t, int32_t> itemOf_;
+
+    // Statistics
+    unsigned long long nbUpdates_ = 0;
+    double updateNs_ = 0.;
+    mutable unsigned long long nbQueries_ = 0;
+    mutable double queryNs_ = 0.;
+    mutable unsigned long long nbNodesVisited_ = 0;
+};
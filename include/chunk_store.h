@@ -0,0 +1,204 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chunk_bounds.h"
+#include "chunk_octree.h"
+#include "map_point.h"
+#include "seq_lock.h"
+
+/// Content of a chunk, immutable once published in the store
+struct ChunkData
+{
+    std::vector<MapPoint> points;
+    ChunkBounds bounds;
+};
+
+/// Points of one chunk to merge in the store, they are copied
+struct ChunkInput
+{
+    int index;
+    const MapPoint *points;
+    size_t nb_points;
+};
+
+/// Chunk updated since the last ChunkStore::consumeUpdates()
+struct ChunkUpdate
+{
+    int source;
+    int index;
+    std::shared_ptr<const ChunkData> data;
+};
+
+/// Out-of-core settings of the ChunkStore
+struct PagingParameters
+{
+    /// Existing directory of the page files, paging is disabled if empty
+    std::string directory;
+    /// Chunks not updated nor read for this long are candidates, in seconds
+    float after = 60.f;
+    /// Chunks closer than this to the position of their source stay in memory, in coordinate units
+    float distance = 10000.f;
+};
+
+/// Thread-safe container of the map chunks of several sources (cameras)
+///
+/// Each source merges its chunks from its own thread. The chunks are copied and their bounds computed
+/// without any lock, then published by swapping pointers under the lock of the source only, so the
+/// sources do not contend with each other. Readers share the published chunks and keep them as long
+/// as they need, without copy.
+///
+/// The bounds of all the chunks are indexed in an octree for the range queries.
+///
+/// With the Morton order, the points of every chunk are sorted along a Z-order curve while they are
+/// copied, so everything reading the store gets spatially coherent arrays.
+///
+/// With paging, a background thread writes the chunks which are old and far from their source to one
+/// page file per source and releases them. They are read back on demand by get() and forEach().
+class ChunkStore
+{
+public:
+    /// min_node_size : size of the smallest cells of the chunk index, in coordinate units
+    explicit ChunkStore(int nb_sources, float min_node_size = 2000.f);
+    ~ChunkStore();
+
+    int getNbSources() const { return (int)sources_.size(); }
+
+    /// Start the paging thread, returns false if the page files cannot be created
+    bool startPaging(const PagingParameters &params);
+
+    /// Sort the points of the chunks along a Morton curve of cells of this size, in coordinate units,
+    /// 0 to keep the order of the sources. Must be set before the sources start
+    void setMortonOrder(float cell_size) { mortonCell_ = cell_size; }
+
+    /// Replace the content of the given chunks of a source, must always be called from the same thread for a source
+    void update(int source, const std::vector<ChunkInput> &chunks);
+
+    /// Current position of a source, chunks far from it can be paged out
+    void setPosition(int source, float x, float y, float z);
+
+    /// Register a reader of the updates (viewer, network server...), before the sources start
+    /// @return its id for consumeUpdates()
+    int addConsumer();
+
+    /// Call f on every chunk updated since the previous call of this consumer, must always be called from the same thread
+    /// @return the number of chunks updated
+    size_t consumeUpdates(int consumer, const std::function<void(const ChunkUpdate &)> &f);
+
+    /// Content of a chunk, read back from its page file if needed (null if it does not exist)
+    /// @param keep : keep the chunk in memory once read back
+    std::shared_ptr<const ChunkData> get(int source, int index, bool keep = true);
+
+    /// Number of chunk indices of a source, some may be empty
+    int getNbChunks(int source) const;
+
+    /// Incremented by every update(), to poll for new chunks without locking
+    unsigned long long getVersion() const { return version_.load(std::memory_order_acquire); }
+
+    /// Call f on every chunk of every source, the paged out chunks are read but not kept in memory
+    void forEach(const std::function<void(int source, int index, const ChunkData &data)> &f);
+
+    /// Call f on every chunk intersecting the box, the paged out chunks are read but not kept in memory
+    void queryBox(const ChunkBounds &box, const std::function<void(int source, int index, const ChunkData &data)> &f);
+
+    size_t getNbPoints() const;
+
+    /// Save all the points in a binary PLY file, only those inside box if given
+    bool savePLY(const std::string &path, const ChunkBounds *box = nullptr);
+
+    /// Print the merge cost of every source and the paging activity
+    void report() const;
+
+private:
+    struct Chunk
+    {
+        /// Null while paged out
+        std::shared_ptr<const ChunkData> data;
+        size_t nb_points = 0;
+        ChunkBounds bounds;
+        /// Last update or read
+        std::chrono::steady_clock::time_point last_used;
+        /// Slot in the page file, in points
+        long long file_offset = -1;
+        size_t file_capacity = 0;
+        /// The slot holds the current content
+        bool file_valid = false;
+        /// Incremented before the slot is written again, a read started earlier is discarded
+        unsigned file_generation = 0;
+        /// Number of consumers which did not read the current content yet
+        int nb_dirty = 0;
+    };
+
+    /// Chunks updated since the last consumeUpdates() of a consumer
+    struct Updates
+    {
+        std::vector<int> dirty;
+        std::vector<bool> isDirty;
+    };
+
+    struct Position
+    {
+        float xyz[3];
+    };
+
+    struct Source
+    {
+        mutable std::mutex mtx;
+        std::vector<Chunk> chunks;
+        /// One per consumer
+        std::vector<Updates> updates;
+        SeqLock<Position> position;
+        /// Contents replaced by the previous update, the next one reuses those nobody references anymore (only used by update())
+        std::vector<std::shared_ptr<ChunkData>> retired;
+
+        /// Page file, only accessed under file_mtx
+        std::mutex file_mtx;
+        FILE *file = nullptr;
+        long long file_end = 0;
+
+        // Merge statistics, written under mtx
+        unsigned long long nb_merges = 0;
+        unsigned long long nb_chunks = 0;
+        unsigned long long nb_points = 0;
+        double merge_ms = 0.;
+        double lock_ms = 0.;
+        /// Heap allocations of the updates made by the updating thread, when counted (alloc_counter)
+        unsigned long long nb_allocations = 0;
+
+        // Paging statistics, written under mtx
+        unsigned long long nb_page_outs = 0;
+        unsigned long long nb_page_ins = 0;
+        size_t paged_points = 0;
+    };
+
+    /// Content of a chunk, read from the page file if needed and kept in memory if keep is set
+    std::shared_ptr<const ChunkData> fetch(int source, int index, bool keep);
+    void pagingLoop();
+    /// Write the candidates of a source to its page file and release them
+    void pageOut(Source &s);
+
+    std::vector<std::unique_ptr<Source>> sources_;
+    std::atomic<unsigned long long> version_;
+    int nbConsumers_ = 0;
+    float mortonCell_ = 0.f;
+
+    /// Bounds of the chunks of all the sources
+    mutable std::mutex indexMtx_;
+    ChunkOctree index_;
+
+    PagingParameters paging_;
+    std::thread pagingThread_;
+    std::mutex pagingMtx_;
+    std::condition_variable pagingCv_;
+    bool stopPaging_ = false;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "frame_buffer.h"
+#include "render_state.h"
+#include "shader.h"
+
+/// Eye-Dome Lighting: screen-space shading of the scene computed from its depth buffer only
+///
+/// The scene is drawn into an intermediate framebuffer between begin() and end(), then a single
+/// full-screen pass darkens each pixel according to how much it lies behind its neighbours,
+/// which outlines the geometry of the point cloud without normals.
+class EyeDomeLighting
+{
+public:
+    EyeDomeLighting();
+    ~EyeDomeLighting();
+
+    void init();
+
+    /// Redirect the rendering into the intermediate framebuffer of the given size
+    void begin(int width, int height, float znear, float zfar);
+    /// Compose the shaded scene into the framebuffer that was bound before begin()
+    void end(RenderState &state);
+
+    /// Shading strength, 0 disables the darkening
+    float strength;
+    /// Distance in pixels of the sampled neighbours
+    float radius;
+
+private:
+    FrameBuffer scene_;
+    Shader shader_;
+    GLuint vaoID_;
+    GLint previousFbo_;
+    float znear_;
+    float zfar_;
+
+    GLint uColor_;
+    GLint uDepth_;
+    GLint uPixelSize_;
+    GLint uZNear_;
+    GLint uZFar_;
+    GLint uStrength_;
+    GLint uRadius_;
+};
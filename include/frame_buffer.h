@@ -0,0 +1,34 @@
+#pragma once
+
+#include <GL/glew.h>
+
+/// Framebuffer object with a color and a depth texture attachment, used as an offscreen render target
+class FrameBuffer
+{
+public:
+    FrameBuffer();
+    ~FrameBuffer();
+
+    /// (Re)allocate the attachments, does nothing if the size did not change
+    /// @return false if the framebuffer is not complete
+    bool resize(int width, int height);
+    /// Bind the framebuffer for drawing and set the viewport to its size
+    void bind();
+    /// Bind back the default (window) framebuffer
+    static void unbind();
+
+    GLuint getId() const { return fboID_; }
+    GLuint getColorTexture() const { return colorTexID_; }
+    GLuint getDepthTexture() const { return depthTexID_; }
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+
+private:
+    void release();
+
+    GLuint fboID_;
+    GLuint colorTexID_;
+    GLuint depthTexID_;
+    int width_;
+    int height_;
+};
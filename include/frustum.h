@@ -0,0 +1,49 @@
+#pragma once
+
+#include "chunk_bounds.h"
+
+/// View frustum as 6 planes, extracted from a view-projection matrix
+struct Frustum
+{
+    enum Side
+    {
+        OUTSIDE = -1,
+        INTERSECTS = 0,
+        INSIDE = 1
+    };
+
+    /// Planes a, b, c, d with the normal pointing inwards
+    float planes[6][4];
+
+    /// vp is row major
+    void set(const float *vp)
+    {
+        // Sums and differences of the last row with the 3 others (Gribb & Hartmann)
+        for (int row = 0; row < 3; row++)
+            for (int i = 0; i < 4; i++)
+            {
+                planes[row * 2][i] = vp[12 + i] + vp[row * 4 + i];
+                planes[row * 2 + 1][i] = vp[12 + i] - vp[row * 4 + i];
+            }
+    }
+
+    Side classify(const ChunkBounds &b) const
+    {
+        Side side = INSIDE;
+        for (const auto &p : planes)
+        {
+            // Corners of the box the furthest along the normal and the furthest against it
+            float d_max = p[3], d_min = p[3];
+            for (int i = 0; i < 3; i++)
+            {
+                d_max += p[i] * (p[i] > 0.f ? b.max[i] : b.min[i]);
+                d_min += p[i] * (p[i] > 0.f ? b.min[i] : b.max[i]);
+            }
+            if (d_max < 0.f)
+                return OUTSIDE;
+            if (d_min < 0.f)
+                side = INTERSECTS;
+        }
+        return side;
+    }
+};
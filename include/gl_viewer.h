@@ -3,13 +3,25 @@
 #include <GL/glew.h>
 #include <GL/freeglut.h>
 
-#include <list>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
 
+#include "aligned_allocator.h"
 #include "simple_3d_object.h"
 #include "camera_gl.h"
-#include "sub_map_obj.h"
+#include "gpu_chunk_cache.h"
 #include "shader.h"
-
+#include "offscreen_recorder.h"
+#include "eye_dome_lighting.h"
+#include "gpu_timer.h"
+#include "render_state.h"
+#include "spsc_ring.h"
+#include "seq_lock.h"
+#include "chunk_store.h"
 #include "zed_model.h"
 
 #ifndef M_PI
@@ -22,29 +34,107 @@ const float MOUSE_DZ_SENSITIVITY = 1.25f;
 const float MOUSE_T_SENSITIVITY = 80.f;
 const float KEY_T_SENSITIVITY = 0.1f;
 
+/// Positional tracking state, same values as sl::POSITIONAL_TRACKING_STATE
+enum class TrackingState : int
+{
+    SEARCHING = 0,
+    OK = 1,
+    OFF = 2,
+    FPS_TOO_LOW = 3,
+    SEARCHING_FLOOR_PLANE = 4
+};
+
+/// Camera pose handed from the grab loop (or the network) to the viewer
+struct PoseSample
+{
+    float translation[3];
+    /// Quaternion x, y, z, w
+    float orientation[4];
+    TrackingState state;
+};
+
 /// This class manages input events, window and Opengl rendering pipeline
 class GLViewer
 {
 public:
     GLViewer();
     ~GLViewer();
+    /// Process the window events and draw a new frame if something changed and the frame is due
     bool isAvailable();
+    /// Sleep until the pending frame is due, or when nothing is pending until a pose arrives, for at
+    /// most the period of the window events and of the chunk updates polling. To call between isAvailable()
+    void waitForFrame();
+
+    /// Display the chunks of store, one camera model and path per source (camera_models gives their models)
+    ///
+    /// If offscreen.output is set, the window is hidden and the frames are rendered offscreen
+    /// at offscreen.fps instead of being displayed
+    GLenum init(int argc, char **argv, ChunkStore *store, const std::vector<CameraModel> &camera_models,
+                const OffscreenParameters &offscreen = OffscreenParameters());
+    /// Hand a new pose of a source to the viewer, never blocks
+    ///
+    /// Must always be called from the same thread for a source. The position is queued for the camera path
+    /// (dropped if the viewer is late by more than the queue size) and published as the latest pose.
+    void updatePose(int source_id, const PoseSample &pose);
+
+    /// Number of positions queued for the camera path ahead of rendering, call before the first updatePose()
+    void setPoseQueueSize(size_t size)
+    {
+        for (auto &it : sources_)
+            it->poseQueue.reset(size);
+    }
+
+    /// Maximum VRAM used by the map chunks and maximum size uploaded per frame, in bytes (0 for no limit)
+    ///
+    /// Only the chunks in view are uploaded, the least recently visible ones are evicted when needed
+    void setGpuBudget(size_t bytes, size_t upload_bytes_per_frame)
+    {
+        chunkCache_.setBudget(bytes);
+        chunkCache_.setUploadBudget(upload_bytes_per_frame);
+    }
+
+    /// With several sources, points are tinted with the color of their source by this amount [0, 1]
+    void setSourceTint(float amount)
+    {
+        sourceTint_ = amount;
+    }
 
-    GLenum init(int argc, char **argv, sl::CameraParameters param,
-                sl::FusedPointCloud *ptr, sl::MODEL zed_model);
-    void updatePose(sl::Pose pose_, sl::POSITIONAL_TRACKING_STATE tracking_state);
+    /// Set the voxel size of the fused point cloud (in the coordinate units of the camera),
+    /// the points are drawn as splats of this size in world space
+    void setMapResolution(float voxel_size)
+    {
+        voxelSize_ = voxel_size;
+        // A chunk spans a few voxels at least
+        chunkCache_.setMinNodeSize(voxel_size * 16.f);
+    }
 
-    /// Set GLViewer::new_chunks (private) to true
-    /// Set GLViewer::chunks_pushed (private) to false
-    void updateChunks()
+    /// Chunks smaller than this on screen (in pixels) draw a part of their points as larger splats, 0 to disable
+    void setLodSize(float pixels)
     {
-        new_chunks = true;
-        chunks_pushed = false;
+        chunkCache_.setLodSize(pixels);
     }
 
-    bool chunksUpdated()
+    /// Allocate the camera path of each source for nb_points poses ahead
+    void reservePath(size_t nb_points)
     {
-        return chunks_pushed;
+        for (auto &it : sources_)
+            it->path.reserve(nb_points);
+    }
+
+    /// Maximum number of frames drawn per second, frames are only drawn when new data or inputs arrived
+    void setTargetFPS(float fps)
+    {
+        frameInterval_ = std::chrono::duration<double>(fps > 0.f ? 1. / fps : 0.);
+    }
+
+    /// Enable the synchronization of the buffer swaps with the display refresh
+    /// Note: the swap then blocks the grab loop until the next refresh
+    void setVSync(bool enable);
+
+    /// Enable the Eye-Dome Lighting post-pass (can also be toggled with 'E')
+    void setEDL(bool enable)
+    {
+        edlEnabled_ = enable;
     }
 
     void exit();
@@ -94,13 +184,29 @@ private:
         FREE = 'f'
     };
 
-    Simple3DObject zedModel_;
-    Simple3DObject zedPath_;
-    std::vector<sl::float3> vecPath;
+    /// Camera model, path and pose channel of one source (aligned on the cache lines of poseQueue, created with aligned::makeUnique)
+    struct SourceView
+    {
+        Simple3DObject model;
+        Simple3DObject path;
+        vmath::float3 color;
+        /// Positions of the camera path, from the grab loop of the source to the viewer
+        SpscRing<PoseSample> poseQueue;
+        /// Latest pose, for the camera model and the follow mode
+        SeqLock<PoseSample> latestPose;
+        /// Version of the latest pose already applied
+        unsigned poseVersion = 0;
+        /// Positions which did not fit in poseQueue, only written by the grab loop
+        unsigned long long droppedPoses = 0;
+        TrackingState trackingState = TrackingState::OFF;
+    };
+
+    /// Apply the latest pose of a source and append its new positions to its path
+    void updateSource(SourceView &source, bool follow);
 
-    std::mutex mtx;
-    bool updateZEDposition = false;
-    ;
+    std::vector<aligned::unique_ptr<SourceView>> sources_;
+    /// Positions drained from a pose queue, only used by the rendering thread
+    std::vector<vmath::float3> vecPath;
 
     bool mouseButton_[3];
     int mouseWheelPosition_;
@@ -108,19 +214,44 @@ private:
     int mouseMotion_[2];
     int previousMouseMotion_[2];
     KEY_STATE keyStates_[256];
-    sl::float3 bckgrnd_clr;
-    sl::Pose pose_;
-
-    sl::POSITIONAL_TRACKING_STATE tracking_state;
+    vmath::float3 bckgrnd_clr;
 
     bool followCamera = true;
-    bool new_chunks = false;
-    bool chunks_pushed = false;
+    bool edlEnabled_ = false;
+
+    /// Set when a new pose, new chunks or an input must be displayed
+    std::atomic<bool> needsRedraw_;
+    /// Wakes waitForFrame() when a redraw becomes needed
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    bool wake_ = false;
+    std::chrono::duration<double> frameInterval_;
+    std::chrono::steady_clock::time_point nextFrame_;
+    /// Version of the chunk store already displayed
+    unsigned long long storeVersion_ = 0;
 
     CameraGL camera_;
     ShaderData mainShader;
     ShaderData pcf_shader;
+    RenderState renderState_;
+    float voxelSize_ = 50.f;
+    float maxPointSize_ = 1.f;
+    float sourceTint_ = 0.35f;
+    GLint tintLoc_ = -1;
+    GLint lodScaleLoc_ = -1;
+
+    ChunkStore *store_ = nullptr;
+    int storeConsumer_ = -1;
+    /// GPU copies of the chunks in view
+    GpuChunkCache chunkCache_;
+
+    OffscreenRecorder offscreen_;
+    EyeDomeLighting edl_;
+    int windowWidth_ = 1280;
+    int windowHeight_ = 720;
 
-    sl::FusedPointCloud *p_fpc;
-    std::list<SubMapObj> sub_maps; // Opengl mesh container
+    GpuTimer pointsTimer_;
+    GpuTimer edlTimer_;
+    /// Average CPU time spent in draw(), in milliseconds
+    double drawCpuMs_ = 0.;
 };
\ No newline at end of file
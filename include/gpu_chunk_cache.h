@@ -0,0 +1,108 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "chunk_store.h"
+#include "chunk_octree.h"
+#include "frustum.h"
+#include "render_state.h"
+#include "sub_map_obj.h"
+
+/// Keep the visible map chunks on the GPU within a memory budget
+///
+/// Only the bounds of the chunks are kept, in an octree, their content is released once uploaded. Each
+/// frame the octree is culled against the view frustum, the visible chunks missing on the GPU are
+/// uploaded (within a per-frame upload budget, the others wait for the next frames), read again from
+/// the ChunkStore if they had been evicted, and the least recently visible ones are evicted when the
+/// VRAM budget would be exceeded.
+///
+/// With LOD, the points are uploaded in an order where every prefix is spread over the whole chunk,
+/// and the chunks which are small on screen only draw a prefix with larger splats.
+class GpuChunkCache
+{
+public:
+    struct Stats
+    {
+        /// Visible chunks already on the GPU
+        unsigned long long hits = 0;
+        /// Visible chunks which had to be uploaded again after an eviction
+        unsigned long long misses = 0;
+        unsigned long long evictions = 0;
+        /// New content uploaded for visible chunks
+        unsigned long long updates = 0;
+        size_t residentBytes = 0;
+        size_t nbResident = 0;
+        /// Chunks in the view frustum at the last frame
+        size_t nbVisible = 0;
+        /// Points drawn at the last frame, after LOD
+        size_t nbPointsDrawn = 0;
+    };
+
+    /// Maximum size of the chunks on the GPU, 0 for no limit
+    void setBudget(size_t bytes) { budget_ = bytes; }
+    /// Maximum size uploaded per frame, 0 for no limit
+    void setUploadBudget(size_t bytes) { uploadBudget_ = bytes; }
+    /// Chunks smaller than this on screen (in pixels) draw a part of their points, 0 to disable
+    /// Note: must be set before the first update
+    void setLodSize(float pixels) { lodSize_ = pixels; }
+    /// Size of the smallest octree nodes, before the first update
+    void setMinNodeSize(float size) { octree_.setMinHalf(size * 0.5f); }
+
+    /// Keep the latest content of a chunk until it is uploaded, the next time it is visible
+    void update(const ChunkUpdate &update);
+
+    /// Cull the chunks with the row major view-projection matrix vp, then upload and evict
+    /// The evicted chunks coming back into view are read from store
+    /// @param point_scale : pixels per unit of size at a distance of 1 unit, for the LOD
+    /// @param state : binds the vertex arrays of the chunks, must outlive the cache
+    void prepare(const float *vp, float point_scale, ChunkStore &store, RenderState &state);
+
+    /// Draw the visible chunks of a source which are on the GPU, lod_scale_loc receives the splat scale of the LOD
+    void draw(int source, RenderState &state, GLint lod_scale_loc);
+
+    const Stats &getStats() const { return stats_; }
+    const ChunkOctree &getOctree() const { return octree_; }
+
+private:
+    struct Entry
+    {
+        int source;
+        int index;
+        ChunkBounds bounds;
+        size_t nbPoints = 0;
+        /// Content waiting for its upload
+        std::shared_ptr<const ChunkData> data;
+        std::unique_ptr<SubMapObj> gpu;
+        size_t gpuBytes = 0;
+        /// data changed since the upload
+        bool stale = true;
+        bool visible = false;
+        bool evicted = false;
+        /// Fraction of the points drawn
+        float lod = 1.f;
+        /// Position in lru_, valid while on the GPU
+        std::list<Entry *>::iterator lru;
+    };
+
+    void upload(Entry &entry, RenderState &state);
+    void evict(Entry &entry);
+
+    std::vector<std::vector<std::unique_ptr<Entry>>> sources_;
+    ChunkOctree octree_;
+    Frustum frustum_;
+    /// Chunks visible at the last frame
+    std::vector<Entry *> visible_;
+    /// Chunks holding content to upload
+    std::vector<Entry *> pending_;
+    /// Chunks on the GPU, most recently visible first
+    std::list<Entry *> lru_;
+    /// Points reordered for the LOD
+    std::vector<MapPoint> lodOrder_;
+
+    size_t budget_ = 0;
+    size_t uploadBudget_ = 0;
+    float lodSize_ = 0.f;
+    Stats stats_;
+};
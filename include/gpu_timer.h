@@ -0,0 +1,35 @@
+#pragma once
+
+#include <GL/glew.h>
+
+/// Measure the GPU time of a sequence of draw calls with GL_TIME_ELAPSED queries
+///
+/// Several queries are used in turn and their results are only read once available,
+/// so measuring never stalls the pipeline (a frame is skipped if all queries are still in flight).
+class GpuTimer
+{
+public:
+    GpuTimer();
+    ~GpuTimer();
+
+    void begin();
+    void end();
+
+    /// Average GPU time in milliseconds over the last completed measurements
+    double getAverageMs() const { return average_ms_; }
+    /// Number of completed measurements
+    unsigned long long getCount() const { return count_; }
+
+private:
+    static const int NB_QUERIES = 4;
+
+    void collect();
+
+    GLuint queryID_[NB_QUERIES];
+    bool pending_[NB_QUERIES];
+    int next_;
+    bool active_;
+
+    double average_ms_;
+    unsigned long long count_;
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <sl/Camera.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+/// Display the left image in an OpenCV window from its own thread
+///
+/// The grab loop only retrieves an image when the preview is due (at most fps images per second),
+/// into a buffer that the display thread is not using. Buffers are exchanged through a lock-free
+/// triple buffer: the grab loop never waits for the display, and an image not yet displayed is
+/// simply replaced by the next one (latest frame wins).
+class ImagePreview
+{
+public:
+    ImagePreview();
+    ~ImagePreview();
+
+    void start(sl::Resolution resolution, float fps);
+    void stop();
+    bool isRunning() const { return running_; }
+
+    /// True if the preview runs and a new image should be retrieved
+    bool frameDue() const;
+    /// Buffer in which the next image must be retrieved
+    sl::Mat &writeBuffer() { return buffers_[write_]; }
+    /// Hand over the image retrieved in writeBuffer() to the display thread
+    void publish();
+
+private:
+    /// Flag set in latest_ when the buffer it designates has not been displayed yet
+    static const int NEW_FRAME = 4;
+
+    void displayLoop();
+
+    sl::Mat buffers_[3];
+    /// Buffer owned by the grab loop
+    int write_;
+    /// Buffer last published, with the NEW_FRAME flag
+    std::atomic<int> latest_;
+    /// Buffer owned by the display thread
+    int display_;
+
+    std::chrono::duration<double> interval_;
+    std::chrono::steady_clock::time_point ts_last_;
+
+    std::atomic<bool> running_;
+    std::thread thread_;
+    unsigned long long nb_published_;
+    std::atomic<unsigned long long> nb_displayed_;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chunk_store.h"
+#include "map_protocol.h"
+
+/// Receive the map published by a MapServer and rebuild it in a ChunkStore
+///
+/// The messages are read and decoded on a thread of the client, the chunks are merged in its store
+/// as they arrive, so any reader of a ChunkStore (viewer, export) works the same on the remote map.
+class MapClient
+{
+public:
+    /// Called from the thread of the client for every received pose
+    typedef std::function<void(const map_protocol::Pose &pose)> PoseCallback;
+
+    MapClient() = default;
+    ~MapClient();
+
+    /// Connect to a server (`<host>:<port>` or `unix:<path>`) and read its HELLO
+    bool connect(const std::string &endpoint, int timeout_ms = 5000);
+    /// Start receiving the poses and the chunks, on_pose may be null
+    void start(PoseCallback on_pose);
+    /// Stop receiving and disconnect
+    void stop();
+    /// False once the server closed the connection
+    bool isConnected() const { return connected_; }
+    /// True once the map as it was at the connection has been received
+    bool hasSnapshot() const { return snapshotReceived_; }
+
+    const map_protocol::Hello &getHello() const { return hello_; }
+    /// Camera model of each source, as sent in the HELLO
+    const std::vector<int32_t> &getCameraModels() const { return cameraModels_; }
+    /// Map received so far, valid after connect()
+    ChunkStore &getStore() { return *store_; }
+
+    /// Print the traffic received until the snapshot (startup) and after it (steady state),
+    /// the decimation and the latency of the poses
+    void report() const;
+
+private:
+    void run();
+    /// Read from the socket and handle the complete messages
+    /// @return false if the connection is closed
+    bool receive(int timeout_ms);
+    /// @return false if the message cannot come from a valid stream, the connection is then dropped
+    bool handle(const map_protocol::MessageHeader &header, const uint8_t *payload);
+    /// Close a connection which does not carry a valid stream
+    /// @return false, for receive()
+    bool drop(const std::string &reason);
+
+    int fd_ = -1;
+    map_protocol::Hello hello_ = {};
+    std::vector<int32_t> cameraModels_;
+    bool helloReceived_ = false;
+    bool streamError_ = false;
+    std::unique_ptr<ChunkStore> store_;
+    map_protocol::MessageReader reader_;
+    PoseCallback onPose_;
+
+    std::thread thread_;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> connected_{false};
+    std::atomic<bool> snapshotReceived_{false};
+
+    // Statistics, written by the thread of the client
+    std::chrono::steady_clock::time_point connectedAt_;
+    std::chrono::steady_clock::time_point snapshotAt_;
+    unsigned long long snapshotBytes_ = 0;
+    unsigned long long snapshotPoints_ = 0;
+    unsigned long long bytes_ = 0;
+    unsigned long long chunks_ = 0;
+    unsigned long long decimated_ = 0;
+    unsigned long long points_ = 0;
+    unsigned long long poses_ = 0;
+    unsigned long long errors_ = 0;
+    double latencyMs_ = 0.;
+    double maxLatencyMs_ = 0.;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+/// Point of the fused point cloud, same layout as the vertices of the ZED map chunks
+struct MapPoint
+{
+    float x, y, z;
+    /// Color packed as 0x00RRGGBB
+    uint32_t color;
+};
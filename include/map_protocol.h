@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "chunk_store.h"
+
+/// Wire format of the map stream, independent of the ZED SDK
+///
+/// A stream is a sequence of messages, each one a MessageHeader followed by its payload. All the
+/// values are little endian. The server starts with a HELLO and the whole map followed by a
+/// SNAPSHOT_END, then sends the latest pose of every source and the chunks updated since the
+/// previous messages. Chunks are compressed with chunk_codec on the quantization grid given in the
+/// HELLO and may be decimated (one point out of 2^lod) for slow clients.
+namespace map_protocol
+{
+    const uint32_t MAGIC = 0x50414d5a; // "ZMAP"
+    const uint32_t VERSION = 3;
+
+    /// Limits of a valid stream, a message beyond them means a corrupted or hostile stream and the
+    /// connection is dropped: the receiver would otherwise allocate for whatever the header says
+    /// Chunk indices are in [0, MAX_CHUNK_INDEX], far more chunks than a mapping session produces
+    const int32_t MAX_CHUNK_INDEX = (1 << 20) - 1;
+    /// Largest payload, more than a chunk of 4 million points sent raw
+    const uint32_t MAX_MESSAGE_SIZE = 64u << 20;
+
+    enum MessageType : uint16_t
+    {
+        HELLO = 1,
+        POSE = 2,
+        CHUNK = 3,
+        /// Empty, the map as it was at the connection has been sent
+        SNAPSHOT_END = 4
+    };
+
+    struct MessageHeader
+    {
+        /// Size of the payload, without this header
+        uint32_t size;
+        uint16_t type;
+        uint16_t flags;
+    };
+    static_assert(sizeof(MessageHeader) == 8, "MessageHeader is sent as is");
+
+    /// Followed by nbSources int32, the camera model of each source (CameraModel, same values as sl::MODEL)
+    struct Hello
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t nbSources;
+        /// Coordinate units in one meter
+        float unitsPerMeter;
+        /// Voxel size of the map, in coordinate units
+        float mapResolution;
+        /// Quantization step of the chunk positions, in coordinate units
+        float quantizationStep;
+    };
+    static_assert(sizeof(Hello) == 24, "Hello is sent as is");
+
+    struct Pose
+    {
+        int32_t source;
+        /// sl::POSITIONAL_TRACKING_STATE
+        int32_t state;
+        /// Capture time, in nanoseconds
+        uint64_t timestamp;
+        /// Time the server received the pose, in nanoseconds since the epoch, to measure the latency
+        uint64_t publishTime;
+        float translation[3];
+        /// Quaternion x, y, z, w
+        float orientation[4];
+    };
+    static_assert(sizeof(Pose) == 56, "Pose is sent as is");
+
+    /// Followed by the nbPoints points encoded by chunk_codec
+    struct ChunkHeader
+    {
+        int32_t source;
+        int32_t index;
+        /// Every 2^lod points of the chunk are sent
+        uint32_t lod;
+        /// Points sent
+        uint32_t nbPoints;
+        /// Points in the chunk
+        uint32_t nbPointsFull;
+        ChunkBounds bounds;
+    };
+    static_assert(sizeof(ChunkHeader) == 44, "ChunkHeader is sent as is");
+
+    /// Append a HELLO message to out, camera_models holds hello.nbSources values
+    void encodeHello(const Hello &hello, const std::vector<int32_t> &camera_models, std::vector<uint8_t> &out);
+    /// Fields and camera models of a HELLO payload
+    /// @return false if the payload is malformed or from an unsupported version
+    bool decodeHello(const uint8_t *payload, size_t size, Hello &hello, std::vector<int32_t> &camera_models);
+    /// Append a SNAPSHOT_END message to out
+    void encodeSnapshotEnd(std::vector<uint8_t> &out);
+    /// Append a POSE message to out
+    void encodePose(const Pose &pose, std::vector<uint8_t> &out);
+    /// Append a CHUNK message to out, with one point out of 2^lod quantized on a grid of size step
+    void encodeChunk(int source, int index, const ChunkData &data, unsigned lod, float step, std::vector<uint8_t> &out);
+
+    /// Points of a CHUNK payload
+    /// @return false if the payload is malformed
+    bool decodeChunk(const uint8_t *payload, size_t size, ChunkHeader &header, std::vector<MapPoint> &points);
+
+    /// Split a received byte stream in messages
+    class MessageReader
+    {
+    public:
+        /// Add received bytes
+        void append(const uint8_t *data, size_t size);
+        /// Next complete message, the payload is valid until the next call
+        /// @return false if none is complete yet, or if the stream is invalid
+        bool next(MessageHeader &header, const uint8_t *&payload);
+        /// A message larger than MAX_MESSAGE_SIZE was announced, nothing more is read
+        bool hasError() const { return error_; }
+
+    private:
+        std::vector<uint8_t> buffer_;
+        /// Start of the next message in buffer_
+        size_t offset_ = 0;
+        bool error_ = false;
+    };
+}
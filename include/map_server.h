@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "chunk_store.h"
+#include "map_protocol.h"
+#include "seq_lock.h"
+
+/// Publish the map being built to remote viewers over TCP or a Unix socket
+///
+/// A single thread serves all the clients with non blocking sockets: it sends the latest pose of
+/// every source and the chunks updated in the ChunkStore. Nothing of it runs on the mapping threads,
+/// which only store their latest pose.
+///
+/// Each client has a bounded send buffer and a queue of chunks to send, read from the store when
+/// they are sent, so a chunk updated many times is sent once with its latest content. When a client
+/// cannot keep up, its chunks are decimated (lower LOD) and sent again at full resolution once it
+/// caught up. The chunks are compressed by batches on the worker pool, with a high priority.
+class MapServer
+{
+public:
+    MapServer() = default;
+    ~MapServer();
+
+    /// Listen on endpoint (`<port>` or `unix:<path>`) and start serving the chunks of store
+    /// @param camera_models : model of each source, drawn by the remote viewers
+    /// @param client_buffer : bytes queued per client before lowering its LOD
+    bool start(const std::string &endpoint, ChunkStore &store, const map_protocol::Hello &hello,
+               const std::vector<int32_t> &camera_models, size_t client_buffer);
+    /// Stop serving, after sending what is queued for at most flush_seconds
+    void stop(float flush_seconds = 0.f);
+    bool isRunning() const { return thread_.joinable(); }
+
+    /// Endpoint to connect to the server from this machine
+    std::string getLocalEndpoint() const;
+
+    /// Latest pose of a source, called from its thread, never blocks
+    void updatePose(const map_protocol::Pose &pose);
+
+private:
+    struct Client
+    {
+        int fd = -1;
+        std::string peer;
+        /// Encoded messages, sent from offset sent
+        std::vector<uint8_t> out;
+        size_t sent = 0;
+        /// Chunks to send, each one only once
+        std::deque<uint64_t> queue;
+        std::unordered_set<uint64_t> queued;
+        /// Chunks of the map at the connection still in the queue, they are at its front
+        size_t snapshotLeft = 0;
+        /// Chunks sent decimated, sent again when the client catches up
+        std::unordered_set<uint64_t> degraded;
+        std::vector<unsigned> poseVersions;
+        unsigned lod = 0;
+        std::chrono::steady_clock::time_point congestedSince;
+        std::chrono::steady_clock::time_point idleSince;
+        std::chrono::steady_clock::time_point connectedAt;
+
+        // Statistics
+        unsigned long long bytes = 0;
+        unsigned long long chunks = 0;
+        unsigned long long decimated = 0;
+        /// Updates merged with an update still queued
+        unsigned long long coalesced = 0;
+        unsigned long long poses = 0;
+        unsigned maxLod = 0;
+
+        size_t getBuffered() const { return out.size() - sent; }
+    };
+
+    /// Chunk being compressed for a client
+    struct Outgoing
+    {
+        uint64_t chunk = 0;
+        std::shared_ptr<const ChunkData> data;
+        /// Last chunk of the map at the connection
+        bool snapshotEnd = false;
+        std::vector<uint8_t> message;
+    };
+
+    static uint64_t key(int source, int index) { return ((uint64_t)(uint32_t)source << 32) | (uint32_t)index; }
+
+    void run();
+    void accept();
+    void enqueue(Client &client, uint64_t chunk);
+    /// Encode the poses and as many chunks as the buffer of the client allows
+    void fill(Client &client);
+    /// Adapt the LOD of a client to its backlog
+    void adaptLod(Client &client);
+    /// @return false if the client disconnected
+    bool flush(Client &client);
+    void disconnect(Client &client, const char *reason);
+    /// Print the traffic of a client
+    void printStats(const Client &client) const;
+
+    std::string endpoint_;
+    int listenFd_ = -1;
+    ChunkStore *store_ = nullptr;
+    int storeConsumer_ = -1;
+    map_protocol::Hello hello_;
+    std::vector<int32_t> cameraModels_;
+    size_t clientBuffer_ = 1 << 20;
+
+    std::vector<std::unique_ptr<SeqLock<map_protocol::Pose>>> poses_;
+    std::vector<std::unique_ptr<Client>> clients_;
+    /// Batch of fill(), kept to reuse the message buffers
+    std::vector<Outgoing> outgoing_;
+
+    std::thread thread_;
+    /// Set after flushDeadline_
+    std::atomic<bool> stopping_{false};
+    std::chrono::steady_clock::time_point flushDeadline_;
+};
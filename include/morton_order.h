@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "map_point.h"
+
+/// Morton (Z-order) layout of the points: points close in space are close in memory
+///
+/// The store sorts the points of every updated chunk this way, so the GPU upload, the export, the
+/// compression and the LOD prefixes all read spatially coherent arrays.
+namespace morton
+{
+    /// Cells per axis of a Morton code, 21 bits each in 63 bits
+    const uint32_t MAX_CELLS = 1u << 21;
+
+    /// Spread the 21 low bits of v to every third bit
+    inline uint64_t spread3(uint32_t v)
+    {
+        uint64_t x = v & 0x1fffff;
+        x = (x | x << 32) & 0x1f00000000ffffull;
+        x = (x | x << 16) & 0x1f0000ff0000ffull;
+        x = (x | x << 8) & 0x100f00f00f00f00full;
+        x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+        x = (x | x << 2) & 0x1249249249249249ull;
+        return x;
+    }
+
+    /// Inverse of spread3()
+    inline uint32_t compact3(uint64_t x)
+    {
+        x &= 0x1249249249249249ull;
+        x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3ull;
+        x = (x ^ (x >> 4)) & 0x100f00f00f00f00full;
+        x = (x ^ (x >> 8)) & 0x1f0000ff0000ffull;
+        x = (x ^ (x >> 16)) & 0x1f00000000ffffull;
+        x = (x ^ (x >> 32)) & 0x1fffff;
+        return (uint32_t)x;
+    }
+
+    /// Morton code of a cell, x in the lowest bit
+    inline uint64_t encode(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return spread3(x) | spread3(y) << 1 | spread3(z) << 2;
+    }
+
+    /// Indices of the points along the Morton curve of cells of cell_size from origin, in order[n]
+    ///
+    /// The cells are clamped to [0, MAX_CELLS), points in the same cell keep their order. Chunks
+    /// larger than parallel::MIN_BLOCK are sorted on the thread pool, the codes are scratch memory.
+    void sortOrder(const MapPoint *points, size_t n, const float origin[3], float cell_size, uint32_t *order);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/// Minimal stream sockets over TCP or Unix domain sockets (POSIX only)
+///
+/// Endpoints are `<port>` (listen on all interfaces), `<host>:<port>` or `unix:<path>`.
+/// The functions return -1 and print the error on failure.
+namespace net
+{
+    /// Listening socket, non blocking
+    int listenSocket(const std::string &endpoint);
+    /// Accept a pending connection, non blocking, -1 if none
+    /// @param peer : set to the address of the client
+    int acceptSocket(int listen_fd, std::string &peer);
+    /// Connected socket, blocking
+    int connectSocket(const std::string &endpoint);
+    /// Endpoint to connect to a listening endpoint from the same machine
+    std::string localEndpoint(const std::string &endpoint);
+
+    bool setNonBlocking(int fd);
+    /// Size of the kernel send buffer, small buffers let the sender see the backlog
+    void setSendBuffer(int fd, int bytes);
+    /// Wait until data can be read
+    /// @return false on timeout
+    bool waitReadable(int fd, int timeout_ms);
+    void closeSocket(int fd);
+
+    struct PollEntry
+    {
+        int fd;
+        bool wantWrite;
+        /// Set by pollSockets()
+        bool readable;
+        bool writable;
+        bool error;
+    };
+    /// Wait until one of the sockets can be read, or written if wantWrite is set
+    /// @return false on timeout
+    bool pollSockets(std::vector<PollEntry> &entries, int timeout_ms);
+
+    /// Send without blocking and without SIGPIPE
+    /// @return the number of bytes sent, 0 if the socket is full, -1 if it is closed
+    long sendSome(int fd, const void *data, size_t size);
+    /// Receive what is available (blocking sockets wait for at least one byte)
+    /// @return the number of bytes received, 0 if nothing is available, -1 if it is closed
+    long receiveSome(int fd, void *data, size_t size);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_buffer.h"
+
+/// Parameters of the offscreen rendering, disabled while output is empty
+struct OffscreenParameters
+{
+    /// Directory where the frames are written, or "|<command>" to pipe raw RGBA frames to an encoder
+    std::string output;
+    /// Write raw RGBA files instead of PNG (ignored when piping)
+    bool raw = false;
+    int width = 1280;
+    int height = 720;
+    /// Maximum number of frames rendered per second
+    float fps = 10.f;
+    /// Maximum number of frames waiting to be written, frames are dropped beyond
+    int queue_size = 4;
+};
+
+/// Render the viewer into a framebuffer object and write the frames to disk or to a pipe
+///
+/// The pixels are read back asynchronously: glReadPixels targets one of a ring of pixel pack buffers
+/// and a buffer is only mapped once its fence has signaled, a few frames later, so the render loop never
+/// waits for the GPU. Encoding and writing are done on a separate thread.
+class OffscreenRecorder
+{
+public:
+    OffscreenRecorder();
+    ~OffscreenRecorder();
+
+    bool init(const OffscreenParameters &params);
+    bool isEnabled() const { return enabled_; }
+
+    /// True if enough time has elapsed since the last rendered frame
+    bool frameDue() const;
+    /// Time at which the next frame is due
+    std::chrono::steady_clock::time_point nextFrameTime() const;
+    /// Bind the offscreen framebuffer as render target
+    void begin();
+    /// Start the readback of the frame just rendered and hand over the completed ones to the writer
+    void end();
+
+    int getWidth() const { return params_.width; }
+    int getHeight() const { return params_.height; }
+
+private:
+    static const int NB_PBO = 3;
+
+    void collect(bool wait);
+    void writerLoop();
+    void writeFrame(const std::vector<unsigned char> &frame, unsigned long long id);
+
+    bool enabled_;
+    OffscreenParameters params_;
+    FrameBuffer target_;
+
+    GLuint pboID_[NB_PBO];
+    GLsync fences_[NB_PBO];
+    int nextPbo_;
+
+    std::chrono::steady_clock::time_point ts_last_;
+    unsigned long long nb_captured_;
+    unsigned long long nb_dropped_;
+
+    FILE *pipe_;
+    std::thread writer_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<std::pair<unsigned long long, std::vector<unsigned char>>> frames_;
+    bool stop_;
+};
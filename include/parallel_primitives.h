@@ -0,0 +1,249 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "scratch_arena.h"
+#include "thread_pool.h"
+
+/// Data parallel building blocks of the point processing, on the ThreadPool
+///
+/// The arrays are cut in contiguous blocks of at least MIN_BLOCK items, so small inputs (most chunks)
+/// run in the calling thread without any synchronization, and the results never depend on the
+/// number of threads.
+namespace parallel
+{
+    /// Smallest block handed to a task, below this the synchronization costs more than it saves
+    const size_t MIN_BLOCK = 1 << 14;
+
+    /// Run f(i) for i in [0, n), one index at a time, on max_threads threads at most (0 for all the pool)
+    ///
+    /// For items of uneven cost such as chunks; the calling thread takes part. By default the tasks have
+    /// the priority of the calling task (NORMAL outside of the pool), like all the primitives below.
+    template <typename F>
+    void forEach(size_t n, const F &f, int max_threads = 0, ThreadPool::Priority priority = ThreadPool::getCurrentPriority())
+    {
+        ThreadPool &pool = ThreadPool::global();
+        size_t nb_tasks = std::min<size_t>(n, pool.getNbWorkers() + 1);
+        if (max_threads > 0)
+            nb_tasks = std::min<size_t>(nb_tasks, max_threads);
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            for (size_t i; (i = next.fetch_add(1)) < n;)
+                f(i);
+        };
+        ThreadPool::TaskGroup group;
+        // One task per worker, none of them has to steal to start. The task only holds a reference to
+        // worker so it fits in the small buffer of std::function and is not allocated
+        for (size_t i = 1; i < nb_tasks; i++)
+            pool.submit(group, [&worker]() { worker(); }, priority, (int)i - 1);
+        {
+            // The loops nested in the share of the calling thread have the priority of this one
+            ThreadPool::PriorityScope scope(priority);
+            worker();
+        }
+        pool.wait(group);
+    }
+
+    /// Number of blocks of [0, n) for blocks of at least min_block items
+    inline size_t getNbBlocks(size_t n, size_t min_block = MIN_BLOCK)
+    {
+        const size_t max_blocks = 4 * (size_t)(ThreadPool::global().getNbWorkers() + 1);
+        return std::max<size_t>(1, std::min(n / std::max<size_t>(min_block, 1), max_blocks));
+    }
+
+    /// Run f(block, begin, end) on the nb_blocks contiguous blocks of [0, n), in parallel
+    template <typename F>
+    void forBlocks(size_t n, size_t nb_blocks, const F &f)
+    {
+        auto run = [&](size_t block) { f(block, n * block / nb_blocks, n * (block + 1) / nb_blocks); };
+        if (nb_blocks <= 1)
+        {
+            run(0);
+            return;
+        }
+        forEach(nb_blocks, run);
+    }
+
+    /// out[i] = in[0] + ... + in[i - 1], in and out may be the same array
+    /// @return the sum of all the items
+    template <typename T>
+    T exclusiveScan(const T *in, T *out, size_t n)
+    {
+        ScratchScope scope;
+        const size_t nb_blocks = getNbBlocks(n);
+        ScratchVector<T> sums(nb_blocks, T());
+        if (nb_blocks > 1)
+            forBlocks(n, nb_blocks, [&](size_t block, size_t begin, size_t end) {
+                T sum = T();
+                for (size_t i = begin; i < end; i++)
+                    sum += in[i];
+                sums[block] = sum;
+            });
+        T total = T();
+        for (auto &it : sums)
+        {
+            const T sum = it;
+            it = total;
+            total += sum;
+        }
+        forBlocks(n, nb_blocks, [&](size_t block, size_t begin, size_t end) {
+            T sum = sums[block];
+            for (size_t i = begin; i < end; i++)
+            {
+                const T v = in[i];
+                out[i] = sum;
+                sum += v;
+            }
+            if (nb_blocks == 1)
+                total = sum;
+        });
+        return total;
+    }
+
+    /// Copy the items of in for which keep(item) is true to out, in the same order
+    ///
+    /// keep is evaluated twice per item (count, then copy), out needs room for n items.
+    /// @return the number of items copied
+    template <typename T, typename P>
+    size_t compact(const T *in, size_t n, T *out, const P &keep)
+    {
+        const size_t nb_blocks = getNbBlocks(n);
+        if (nb_blocks == 1)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < n; i++)
+                if (keep(in[i]))
+                    out[count++] = in[i];
+            return count;
+        }
+        ScratchScope scope;
+        ScratchVector<size_t> offsets(nb_blocks);
+        forBlocks(n, nb_blocks, [&](size_t block, size_t begin, size_t end) {
+            size_t count = 0;
+            for (size_t i = begin; i < end; i++)
+                count += keep(in[i]) ? 1 : 0;
+            offsets[block] = count;
+        });
+        const size_t total = exclusiveScan(offsets.data(), offsets.data(), nb_blocks);
+        forBlocks(n, nb_blocks, [&](size_t block, size_t begin, size_t end) {
+            T *dst = out + offsets[block];
+            for (size_t i = begin; i < end; i++)
+                if (keep(in[i]))
+                    *dst++ = in[i];
+        });
+        return total;
+    }
+
+    /// Stable sort of keys by increasing value, values (optional, may be null) are moved along
+    ///
+    /// Least significant digit radix sort, 11 bits per pass. Only the digits which differ between the
+    /// keys are sorted, so the small codes of a chunk take 2 or 3 passes. Each pass counts the digits
+    /// of every block, scans the counts digit by digit and block by block, and scatters every block
+    /// from its own offsets, which keeps the sort stable. The buffers come from the scratch arena.
+    template <typename K, typename V>
+    void radixSort(K *keys, V *values, size_t n)
+    {
+        static_assert(std::is_unsigned<K>::value, "radixSort() sorts unsigned keys");
+        const int DIGIT_BITS = 11;
+        const size_t RADIX = (size_t)1 << DIGIT_BITS;
+        const K DIGIT_MASK = (K)(RADIX - 1);
+        const int KEY_BITS = (int)sizeof(K) * 8;
+
+        if (n < 64)
+        {
+            // Insertion sort, the histograms would cost more
+            for (size_t i = 1; i < n; i++)
+            {
+                const K key = keys[i];
+                V value = values ? values[i] : V();
+                size_t j = i;
+                for (; j > 0 && keys[j - 1] > key; j--)
+                {
+                    keys[j] = keys[j - 1];
+                    if (values)
+                        values[j] = values[j - 1];
+                }
+                keys[j] = key;
+                if (values)
+                    values[j] = value;
+            }
+            return;
+        }
+
+        // Bits which are not the same in all the keys
+        ScratchScope scope;
+        ScratchArena &arena = scope.getArena();
+        const size_t nb_blocks = getNbBlocks(n);
+        ScratchVector<K> ors(nb_blocks, 0), ands(nb_blocks, (K)~(K)0);
+        forBlocks(n, nb_blocks, [&](size_t block, size_t begin, size_t end) {
+            K o = 0, a = (K)~(K)0;
+            for (size_t i = begin; i < end; i++)
+            {
+                o |= keys[i];
+                a &= keys[i];
+            }
+            ors[block] = o;
+            ands[block] = a;
+        });
+        K varying = 0, all_and = (K)~(K)0;
+        for (size_t b = 0; b < nb_blocks; b++)
+        {
+            varying |= ors[b];
+            all_and &= ands[b];
+        }
+        varying ^= all_and;
+
+        K *const tmp_keys = arena.allocate<K>(n);
+        V *const tmp_values = values ? arena.allocate<V>(n) : nullptr;
+        size_t *const counts = arena.allocate<size_t>(nb_blocks * RADIX);
+        K *src_keys = keys, *dst_keys = tmp_keys;
+        V *src_values = values, *dst_values = tmp_values;
+        for (int shift = 0; shift < KEY_BITS; shift += DIGIT_BITS)
+        {
+            if (!((varying >> shift) & DIGIT_MASK))
+                continue;
+            forBlocks(n, nb_blocks, [&](size_t block, size_t begin, size_t end) {
+                size_t *count = counts + block * RADIX;
+                std::fill(count, count + RADIX, 0);
+                for (size_t i = begin; i < end; i++)
+                    count[(src_keys[i] >> shift) & DIGIT_MASK]++;
+            });
+            // Offsets: digit major, block minor
+            size_t offset = 0;
+            for (size_t d = 0; d < RADIX; d++)
+                for (size_t block = 0; block < nb_blocks; block++)
+                {
+                    const size_t c = counts[block * RADIX + d];
+                    counts[block * RADIX + d] = offset;
+                    offset += c;
+                }
+            forBlocks(n, nb_blocks, [&](size_t block, size_t begin, size_t end) {
+                size_t *count = counts + block * RADIX;
+                for (size_t i = begin; i < end; i++)
+                {
+                    const size_t to = count[(src_keys[i] >> shift) & DIGIT_MASK]++;
+                    dst_keys[to] = src_keys[i];
+                    if (dst_values)
+                        dst_values[to] = src_values[i];
+                }
+            });
+            std::swap(src_keys, dst_keys);
+            std::swap(src_values, dst_values);
+        }
+        if (src_keys != keys)
+        {
+            memcpy(keys, src_keys, n * sizeof(K));
+            if (values)
+                memcpy(values, src_values, n * sizeof(V));
+        }
+        // Back to the arena for the next sort of an enclosing scope
+        arena.deallocate(counts, nb_blocks * RADIX * sizeof(size_t));
+        arena.deallocate(tmp_values, values ? n * sizeof(V) : 0);
+        arena.deallocate(tmp_keys, n * sizeof(K));
+    }
+}
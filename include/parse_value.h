@@ -0,0 +1,11 @@
+#pragma once
+
+#include <string>
+
+/// Values of the options of the sample and of the remote viewer, the whole string must be the value
+namespace parse_value
+{
+    bool toInt(const std::string &value, int &out);
+    /// Finite values only: "inf" and "nan" are read by %f but would pass any range check (nan compares false)
+    bool toFloat(const std::string &value, float &out);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <functional>
+#include <vector>
+
+/// Per-frame data shared by all the shaders through the "FrameData" uniform block (std140 layout)
+struct FrameUniforms
+{
+    /// View projection matrix, row major like sl::Transform
+    float vpMatrix[16];
+    /// Pixels covered by one unit at a distance of one unit
+    float pointScale;
+    /// Size of the fused point cloud voxels, in coordinate units
+    float voxelSize;
+    float maxPointSize;
+    float padding_;
+};
+
+/// Thin layer over the OpenGL state used by GLViewer
+///
+/// The per-frame uniforms are uploaded once in a uniform buffer bound to every program, the draws
+/// submitted during a frame are executed grouped by program, and program / vertex array binds are
+/// skipped when they would not change anything, from one frame to the next too. Every program and
+/// vertex array bind of the viewer goes through it, so the cached bindings are always the actual ones.
+class RenderState
+{
+public:
+    RenderState();
+    ~RenderState();
+
+    static const GLuint FRAME_DATA_BINDING = 0;
+
+    void init();
+    /// Bind the "FrameData" block of the program (if it declares it) to the shared uniform buffer
+    void registerProgram(GLuint program);
+
+    /// Upload the per-frame uniforms, to be called once before the draws of the frame
+    void beginFrame(const FrameUniforms &uniforms);
+    /// Queue a draw to be executed by the given program
+    void submit(GLuint program, std::function<void()> draw);
+    /// Execute the queued draws sorted by program, the bindings are kept for the next frame
+    void endFrame();
+
+    void useProgram(GLuint program);
+    void bindVertexArray(GLuint vao);
+    /// Delete a vertex array, forgotten if bound (its name can be given again to a new one)
+    void deleteVertexArray(GLuint vao);
+
+    /// Draw calls, counted for the statistics
+    void drawArrays(GLenum mode, GLint first, GLsizei count);
+    void drawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
+
+    /// Print the average draw calls and state changes per frame
+    void report() const;
+
+private:
+    struct DrawItem
+    {
+        GLuint program;
+        std::function<void()> draw;
+    };
+
+    GLuint uboID_;
+    GLuint currentProgram_;
+    GLuint currentVao_;
+    std::vector<DrawItem> queue_;
+
+    // Statistics
+    unsigned long long nbFrames_;
+    unsigned long long nbDraws_;
+    unsigned long long nbProgramChanges_;
+    unsigned long long nbVaoChanges_;
+    /// Binds which would not have changed anything
+    unsigned long long nbSkippedBinds_;
+};
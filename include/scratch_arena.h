@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/// Scratch memory of the processing stages (store updates, sorting, compression), one per thread
+///
+/// Allocations bump a pointer in large blocks which are kept from one use to the next, so once warm
+/// the processing of an update does not touch the heap. Freed buffers (e.g. the old storage of a
+/// growing vector) go to a free list per power of two size class and are reused before bumping.
+/// Everything is released at once, in O(1), when the outermost ScratchScope of the thread ends: the
+/// scratch memory must not be used past it. Every TRIM_PERIOD uses, the blocks beyond the ones touched
+/// during the period are freed, so a burst (first map, relocalization) does not keep its memory forever.
+class ScratchArena
+{
+public:
+    explicit ScratchArena(size_t block_size = 1 << 20);
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    /// Arena of the calling thread
+    static ScratchArena &local();
+
+    /// At least bytes, aligned on a cache line
+    void *allocate(size_t bytes);
+    /// Give a buffer back to its size class
+    void deallocate(void *p, size_t bytes);
+
+    template <typename T>
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(allocate(n * sizeof(T)));
+    }
+
+    /// Release all the allocations, the blocks are kept (trimmed every TRIM_PERIOD resets)
+    void reset();
+
+    /// Free the blocks beyond the first keep_bytes of capacity, only while nothing is allocated
+    void trim(size_t keep_bytes = 0);
+
+    /// Bytes reserved in the blocks
+    size_t getCapacity() const;
+    /// Largest number of bytes used between two resets
+    size_t getPeak() const { return peak_; }
+
+private:
+    friend class ScratchScope;
+
+    /// Size classes from 64 bytes to 2^63
+    static const int MIN_CLASS = 6;
+    static const int NB_CLASSES = 64 - MIN_CLASS;
+    /// Resets between two trims
+    static const int TRIM_PERIOD = 64;
+
+    struct Block
+    {
+        std::unique_ptr<unsigned char[]> storage;
+        /// First cache line of storage
+        unsigned char *data;
+        size_t size;
+    };
+
+    /// Free the blocks after the first nb_kept ones
+    void releaseBlocks(size_t nb_kept);
+
+    std::vector<Block> blocks_;
+    size_t blockSize_;
+    /// Bump position: block and offset in it
+    size_t block_ = 0;
+    size_t offset_ = 0;
+    size_t used_ = 0;
+    size_t peak_ = 0;
+    /// Number of blocks touched since the last trim
+    size_t periodBlocks_ = 0;
+    int nbResets_ = 0;
+    /// Singly linked lists of the freed buffers, the link is stored in the buffer
+    void *freeLists_[NB_CLASSES] = {};
+    int depth_ = 0;
+};
+
+/// Section of code using the scratch arena of its thread, nested scopes share it until the outermost one ends
+class ScratchScope
+{
+public:
+    ScratchScope() : arena_(ScratchArena::local()) { arena_.depth_++; }
+    ~ScratchScope()
+    {
+        if (--arena_.depth_ == 0)
+            arena_.reset();
+    }
+    ScratchScope(const ScratchScope &) = delete;
+    ScratchScope &operator=(const ScratchScope &) = delete;
+
+    ScratchArena &getArena() { return arena_; }
+
+private:
+    ScratchArena &arena_;
+};
+
+/// Allocator of the standard containers on the scratch arena of the thread, they must be declared inside a ScratchScope
+template <typename T>
+class ScratchAllocator
+{
+public:
+    typedef T value_type;
+
+    ScratchAllocator() : arena_(&ScratchArena::local()) {}
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U> &other) : arena_(other.arena_) {}
+
+    T *allocate(size_t n) { return arena_->allocate<T>(n); }
+    void deallocate(T *p, size_t n) { arena_->deallocate(p, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const ScratchAllocator<U> &other) const { return arena_ == other.arena_; }
+    template <typename U>
+    bool operator!=(const ScratchAllocator<U> &other) const { return arena_ != other.arena_; }
+
+private:
+    template <typename U>
+    friend class ScratchAllocator;
+    ScratchArena *arena_;
+};
+
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/// Latest value written by a single writer thread, read by any thread without locking
+///
+/// The writer never waits. A reader copies the value and retries if the writer changed it in the
+/// meantime (odd or different sequence number), so it always gets a consistent value. The value is
+/// stored in atomic words to keep the concurrent copy well defined.
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock values are copied word by word");
+
+public:
+    SeqLock() : seq_(0)
+    {
+        for (auto &it : data_)
+            it.store(0, std::memory_order_relaxed);
+    }
+
+    /// Writer side
+    void store(const T &value)
+    {
+        uint64_t words[NB_WORDS] = {};
+        memcpy(words, &value, sizeof(T));
+        const unsigned seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < NB_WORDS; i++)
+            data_[i].store(words[i], std::memory_order_relaxed);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /// Reader side, returns the version of the value read (0 if nothing has been written yet,
+    /// value is then left untouched)
+    unsigned load(T &value) const
+    {
+        uint64_t words[NB_WORDS];
+        unsigned seq;
+        for (;;)
+        {
+            seq = seq_.load(std::memory_order_acquire);
+            if (seq & 1)
+                continue;
+            for (size_t i = 0; i < NB_WORDS; i++)
+                words[i] = data_[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == seq)
+                break;
+        }
+        if (seq != 0)
+            memcpy(&value, words, sizeof(T));
+        return seq / 2;
+    }
+
+private:
+    static const size_t NB_WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<unsigned> seq_;
+    std::atomic<uint64_t> data_[NB_WORDS];
+};
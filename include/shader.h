@@ -7,6 +7,12 @@ extern GLchar *VERTEX_SHADER;
 /// F - Fused
 extern GLchar *FPC_VERTEX_SHADER;
 extern GLchar *FRAGMENT_SHADER;
+/// Round point splats
+extern GLchar *FPC_FRAGMENT_SHADER;
+/// Full-screen triangle generated from gl_VertexID, for post-processing passes
+extern GLchar *FULLSCREEN_VERTEX_SHADER;
+/// EDL - Eye-Dome Lighting
+extern GLchar *EDL_FRAGMENT_SHADER;
 
 class Shader
 {
@@ -29,9 +35,10 @@ private:
 /// @brief A struct to represent ShaderData
 ///
 /// @param it::Shader the shader object itself
-/// @param MVP_Mat::GLuint the uniform id of the MVP Matrix
+/// @param Model_Mat::GLint the uniform id of the Model Matrix (-1 if unused),
+///        the view projection matrix is shared by all shaders in the FrameData uniform block
 struct ShaderData
 {
     Shader it;
-    GLuint MVP_Mat;
+    GLint Model_Mat;
 };
\ No newline at end of file
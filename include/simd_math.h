@@ -0,0 +1,28 @@
+#pragma once
+
+// SIMD_MATH_NO_SSE forces the plain C++ path, to test it on x86
+#if !defined(SIMD_MATH_NO_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SIMD_MATH_SSE 1
+#endif
+
+/// Small 4x4 matrix layer for the rigid transforms computed every frame (view matrix, model matrices).
+/// Uses SSE when available, plain C++ otherwise (e.g. Jetson).
+namespace simd
+{
+    /// 4x4 matrix, row major like sl::Transform::m so both can be copied into each other
+    struct alignas(16) Mat4
+    {
+        float m[16];
+    };
+
+    Mat4 identity();
+
+    /// Rigid transform from a unit quaternion (x, y, z, w) and a translation (x, y, z)
+    Mat4 fromQuatTranslation(const float *q, const float *t);
+
+    /// Closed-form inverse of a rigid transform: [R t]^-1 = [R^T -R^T.t]
+    Mat4 rigidInverse(const Mat4 &a);
+
+    /// a * b
+    Mat4 multiply(const Mat4 &a, const Mat4 &b);
+}
@@ -1,62 +1,82 @@
 #pragma once
 
-#include <sl/Camera.hpp>
 #include <GL/glew.h>
 
+#include <vector>
+
 #include "shader.h"
+#include "render_state.h"
+#include "simd_math.h"
+#include "viewer_math.h"
 
 /// Generate, update model of the camera and its moving path, and issue draw call.
 class Simple3DObject
 {
 public:
     Simple3DObject();
-    Simple3DObject(sl::Translation position, bool isStatic);
+    Simple3DObject(vmath::Translation position, bool isStatic);
     ~Simple3DObject();
 
+    /// Reserve the CPU storage for nb_vertices vertices in total
+    void reserve(size_t nb_vertices);
     void addPoint(float x, float y, float z, float r, float g, float b);
-    void addLine(sl::float3 p1, sl::float3 p2, sl::float3 clr);
-    void addPoint(sl::float3 position, sl::float3 color);
+    void addLine(vmath::float3 p1, vmath::float3 p2, vmath::float3 clr);
+    void addPoint(vmath::float3 position, vmath::float3 color);
+    /// Add nb points of the same color at once
+    void addPoints(const vmath::float3 *positions, size_t nb, vmath::float3 color);
     /// Generate & bind vertex array, push data to vertex buffer,
     /// then link the data to vao by specifing the layout of the data using glVertexAttribPointer
-    void pushToGPU();
+    ///
+    /// Vertices are drawn in order with glDrawArrays. If only points were added since the last call,
+    /// only those are uploaded, the GPU buffer grows geometrically.
+    void pushToGPU(RenderState &state);
+    /// Upload an indexed mesh of interleaved position and color (6 floats per vertex) in a single
+    /// static buffer, without copying it in the object
+    void setMesh(RenderState &state, const float *vertices, int nb_vertices, const unsigned short *indices, int nb_indices);
     void clear();
 
     void setDrawingType(GLenum type);
 
-    void draw();
-
-    void translate(const sl::Translation &t);
-    void setPosition(const sl::Translation &p);
+    void draw(RenderState &state);
 
-    void setRT(const sl::Transform &mRT);
+    void translate(const vmath::Translation &t);
+    void setPosition(const vmath::Translation &p);
 
-    void rotate(const sl::Orientation &rot);
-    void rotate(const sl::Rotation &m);
-    void setRotation(const sl::Orientation &rot);
-    void setRotation(const sl::Rotation &m);
+    void rotate(const vmath::Orientation &rot);
+    void setRotation(const vmath::Orientation &rot);
 
-    const sl::Translation &getPosition() const;
+    const vmath::Translation &getPosition() const;
 
-    sl::Transform getModelMatrix() const;
+    /// Row major
+    simd::Mat4 getModelMatrix() const;
 
 private:
+    static const int VERTEX_SIZE = 6;
+
+    void createBuffers(RenderState &state);
+
+    /// Interleaved vertices: x, y, z, r, g, b
     std::vector<float> vertices_;
-    std::vector<float> colors_;
-    std::vector<unsigned int> indices_;
 
     bool isStatic_;
 
     GLenum drawingType_;
 
+    /// Number of vertices in the GPU buffer and its capacity
+    GLsizei nbVertices_;
+    GLsizei gpuCapacity_;
+    /// Number and type of the indices in the GPU buffer, 0 when drawn with glDrawArrays
+    GLsizei nbIndices_;
+    GLenum indexType_;
+
     GLuint vaoID_;
     /*
     Vertex buffer IDs:
-    - [0]: Vertices coordinates;
-    - [1]: RGB color values;
-    - [2]: Indices;
+    - [0]: Interleaved vertices coordinates and RGB color values;
+    - [1]: Indices (only for meshes);
     */
-    GLuint vboID_[3];
+    GLuint vboID_[2];
 
-    sl::Translation position_;
-    sl::Orientation rotation_;
+    vmath::Translation position_;
+    vmath::Orientation rotation_;
 };
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/// Lock-free bounded queue between exactly one producer thread and one consumer thread
+///
+/// The capacity is rounded up to a power of two. The producer never waits: push() fails when the
+/// consumer is too late and the queue is full. Head and tail live on separate cache lines so the
+/// two threads do not invalidate each other's line on every operation.
+template <typename T>
+class SpscRing
+{
+public:
+    explicit SpscRing(size_t capacity = 1024)
+    {
+        reset(capacity);
+    }
+
+    /// Reallocate the queue, must not be called while a producer or a consumer is running
+    void reset(size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        buffer_.assign(size, T());
+        mask_ = size - 1;
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+    }
+
+    size_t capacity() const { return buffer_.size(); }
+
+    /// Producer side, returns false if the queue is full
+    bool push(const T &value)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == buffer_.size())
+            return false;
+        buffer_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer side, returns false if the queue is empty
+    bool pop(T &value)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire))
+            return false;
+        value = buffer_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer side, call f on every queued element in order and release them all at once
+    template <typename F>
+    size_t consume(F &&f)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_acquire);
+        for (size_t i = tail; i != head; i++)
+            f(buffer_[i & mask_]);
+        tail_.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+private:
+    std::vector<T> buffer_;
+    size_t mask_;
+
+    /// Next slot written by the producer
+    alignas(64) std::atomic<size_t> head_;
+    /// Next slot read by the consumer
+    alignas(64) std::atomic<size_t> tail_;
+};
@@ -1,25 +1,30 @@
 #pragma once
 
-#include <sl/Camera.hpp>
 #include <GL/glew.h>
 
+#include "chunk_store.h"
+
 #include "shader.h"
+#include "render_state.h"
 
 class SubMapObj
 {
+    RenderState &state_;
     GLuint vaoID_;
-    GLuint vboID_[2];
+    GLuint vboID_;
 
     /// represent the current count of fused point cloud chunk
     int current_fpc_count_;
 
-    std::vector<sl::uint1> index;
-
 public:
-    SubMapObj();
+    /// state : binds the vertex array of the object, must outlive it
+    explicit SubMapObj(RenderState &state);
     ~SubMapObj();
+    SubMapObj(const SubMapObj &) = delete;
+    SubMapObj &operator=(const SubMapObj &) = delete;
 
-    /// Take the chunk of point cloud data, set up vao then push the data to GPU
-    void update(sl::PointCloudChunk &chunks);
-    void draw();
+    /// Take the points of a chunk, set up vao on the first call then push the data to GPU
+    void update(const MapPoint *points, size_t nb_points);
+    /// Draw the first max_points points, all of them if negative
+    void draw(RenderState &state, int max_points = -1);
 };
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Work-stealing scheduler shared by the background stages of the map (chunk sorting, compression of
+/// the stream, export and recording)
+///
+/// Every worker has a queue per priority: it runs its newest task first (cache warm), idle workers
+/// steal the oldest task of the others (largest remaining work), and a waiting high priority task is
+/// always taken before a lower one. A thread waiting for a group of tasks runs the queued tasks of
+/// that group meanwhile and sleeps once they all run elsewhere, so parallel operations can be nested
+/// (a parallel sort in a parallel export) without deadlock nor extra threads, and a grab thread
+/// waiting for its sort never picks up an export batch. The parallel loops nested in a task inherit its
+/// priority, so the sorts of a low priority export do not compete with the mapping.
+///
+/// The number of workers is capped so that the grab threads keep their cores.
+class ThreadPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    enum Priority
+    {
+        /// Interactive: chunks sent to the remote viewers
+        HIGH,
+        /// Mapping: chunk sorting, decoding
+        NORMAL,
+        /// Bulk work which can wait: export, recording
+        LOW,
+        NB_PRIORITIES
+    };
+
+    /// Tasks waited for together
+    class TaskGroup
+    {
+    public:
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+    private:
+        friend class ThreadPool;
+        /// Tasks submitted and not done, under mtx_
+        size_t pending_ = 0;
+        /// Tasks still in a queue
+        std::atomic<size_t> queued_{0};
+        std::mutex mtx_;
+        /// Signaled when a task of the group is queued or done
+        std::condition_variable cv_;
+    };
+
+    /// Activity of a worker since the pool started
+    struct WorkerStats
+    {
+        unsigned long long tasks = 0;
+        /// Tasks taken from the queue of another worker
+        unsigned long long stolen = 0;
+        double busyMs = 0.;
+    };
+
+    /// nb_workers : threads started, 0 for none (the tasks then run in the calling thread)
+    explicit ThreadPool(int nb_workers);
+    ~ThreadPool();
+
+    /// Priority of the work of the calling thread: the one of the task it runs, NORMAL outside of the tasks
+    static Priority getCurrentPriority();
+
+    /// Priority of the work of the calling thread while in scope, e.g. its share of a parallel loop
+    class PriorityScope
+    {
+    public:
+        explicit PriorityScope(Priority priority);
+        ~PriorityScope();
+        PriorityScope(const PriorityScope &) = delete;
+        PriorityScope &operator=(const PriorityScope &) = delete;
+
+    private:
+        Priority previous_;
+    };
+
+    /// Number of workers of the global pool, must be called before its first use
+    /// @param nb_workers : negative for one per core besides the calling thread
+    static void configure(int nb_workers);
+
+    /// Pool shared by the whole process
+    static ThreadPool &global();
+
+    int getNbWorkers() const { return (int)workers_.size(); }
+
+    /// Queue a task, on the queue of the calling worker or spread over the workers from other threads
+    /// @param affinity : worker preferred for the task (modulo the number of workers), -1 for any.
+    /// Only a hint, other workers steal it when they are idle
+    void submit(TaskGroup &group, Task task, Priority priority = NORMAL, int affinity = -1);
+
+    /// Run the queued tasks of the group until all its tasks are done, sleep while the last ones run on other threads
+    void wait(TaskGroup &group);
+
+    /// Per worker activity, the last item gathers the tasks run by the threads outside the pool while they wait
+    std::vector<WorkerStats> getStats() const;
+
+    /// Print the utilization of every worker
+    void report() const;
+
+private:
+    struct Counters
+    {
+        std::atomic<unsigned long long> tasks{0};
+        std::atomic<unsigned long long> stolen{0};
+        std::atomic<long long> busyNs{0};
+    };
+
+    /// Oldest task first. A vector rather than a deque: the queues are short and keep their capacity,
+    /// so a warm pool queues tasks without allocating (a deque frees and allocates blocks as it drains)
+    typedef std::vector<std::pair<TaskGroup *, Task>> Queue;
+
+    struct Worker
+    {
+        std::mutex mtx;
+        Queue tasks[NB_PRIORITIES];
+        std::thread thread;
+        Counters counters;
+    };
+
+    void loop(int index);
+    /// Run the task of highest priority, of the worker self first (-1 for a thread outside the pool), then stolen from the others
+    /// @param group : only take the tasks of this group, null for any
+    bool runOne(int self, TaskGroup *group);
+    /// Take a task of the group (any if null) from a queue of a worker, under its lock, the newest one if back is set
+    bool pop(Queue &tasks, TaskGroup *group, bool back, std::pair<TaskGroup *, Task> &task);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    /// Tasks run by threads outside the pool
+    Counters callers_;
+    std::atomic<size_t> nbQueued_;
+    std::atomic<unsigned> nextWorker_;
+    std::mutex sleepMtx_;
+    std::condition_variable sleepCv_;
+    bool stop_ = false;
+    std::chrono::steady_clock::time_point startedAt_;
+};
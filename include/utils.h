@@ -2,6 +2,34 @@
 
 #include <sl/Camera.hpp>
 
-void parse_args(int argc, char **argv, sl::InitParameters &param);
+#include <chrono>
+#include <string>
 
-void print(std::string msg_prefix, sl::ERROR_CODE err_code = sl::ERROR_CODE::SUCCESS, std::string msg_suffix = "");
\ No newline at end of file
+/// Number of coordinate units in one meter
+float getUnitScale(sl::UNIT unit);
+
+void print(std::string msg_prefix, sl::ERROR_CODE err_code = sl::ERROR_CODE::SUCCESS, std::string msg_suffix = "");
+
+/// Count grabbed frames and map updates to report the sustained rates of the main loop
+class LoopStats
+{
+public:
+    void start();
+    /// Freeze the elapsed time, otherwise it runs until report()
+    void stop();
+    void addGrab() { nb_grabs_++; }
+    void addMapUpdate() { nb_map_updates_++; }
+    /// Grab rate since start()
+    double getGrabFPS() const;
+    /// Print the grab FPS and the map update rate since start(), prefixed by name if not empty
+    void report(const std::string &name = "") const;
+
+private:
+    double getElapsed() const;
+
+    std::chrono::steady_clock::time_point ts_start_;
+    std::chrono::steady_clock::time_point ts_stop_;
+    bool stopped_ = false;
+    unsigned long long nb_grabs_ = 0;
+    unsigned long long nb_map_updates_ = 0;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cmath>
+
+/// Vector and quaternion types of the viewer, so that it builds without the ZED SDK
+///
+/// They follow the conventions of sl::Translation and sl::Orientation: quaternions are x, y, z, w,
+/// `v * q` rotates v by q and `a * b` applies b then a. Matrices are simd::Mat4.
+namespace vmath
+{
+    const float PI = 3.14159265358979f;
+
+    struct float3
+    {
+        float x, y, z;
+
+        float3() : x(0.f), y(0.f), z(0.f) {}
+        float3(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+
+        float &operator[](int i) { return (&x)[i]; }
+        float operator[](int i) const { return (&x)[i]; }
+
+        float3 operator+(const float3 &b) const { return float3(x + b.x, y + b.y, z + b.z); }
+        float3 operator-(const float3 &b) const { return float3(x - b.x, y - b.y, z - b.z); }
+        float3 operator*(float s) const { return float3(x * s, y * s, z * s); }
+        float3 operator/(float s) const { return float3(x / s, y / s, z / s); }
+
+        static float dot(const float3 &a, const float3 &b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+        static float3 cross(const float3 &a, const float3 &b)
+        {
+            return float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+        }
+        float norm() const { return std::sqrt(dot(*this, *this)); }
+        void normalize()
+        {
+            const float n = norm();
+            if (n > 0.f)
+                *this = *this / n;
+        }
+    };
+
+    /// Position, same type as a vector like in the ZED SDK
+    typedef float3 Translation;
+
+    /// Unit quaternion
+    struct Orientation
+    {
+        float x, y, z, w;
+
+        /// Identity
+        Orientation() : x(0.f), y(0.f), z(0.f), w(1.f) {}
+        Orientation(float x_, float y_, float z_, float w_) : x(x_), y(y_), z(z_), w(w_) {}
+        /// Shortest rotation bringing the direction from onto the direction to
+        Orientation(const float3 &from, const float3 &to);
+
+        /// Rotation of angle radians around axis
+        static Orientation fromAxisAngle(float angle, const float3 &axis);
+
+        /// Apply b then this
+        Orientation operator*(const Orientation &b) const;
+        void normalize();
+    };
+
+    /// Rotate v by q
+    float3 operator*(const float3 &v, const Orientation &q);
+}
@@ -0,0 +1,106 @@
+#include "alloc_counter.h"
+
+#if defined(MAP_COUNT_ALLOCATIONS)
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local unsigned long long threadCount = 0;
+    std::atomic<unsigned long long> totalCount(0);
+
+    void *countedAlloc(std::size_t size)
+    {
+        threadCount++;
+        totalCount.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+}
+
+void *operator new(std::size_t size)
+{
+    void *p = countedAlloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](std::size_t size)
+{
+    void *p = countedAlloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAlloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAlloc(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace alloc_counter
+{
+    bool isEnabled()
+    {
+        return true;
+    }
+
+    unsigned long long getThreadCount()
+    {
+        return threadCount;
+    }
+
+    unsigned long long getTotalCount()
+    {
+        return totalCount.load(std::memory_order_relaxed);
+    }
+}
+
+#else
+
+namespace alloc_counter
+{
+    bool isEnabled()
+    {
+        return false;
+    }
+
+    unsigned long long getThreadCount()
+    {
+        return 0;
+    }
+
+    unsigned long long getTotalCount()
+    {
+        return 0;
+    }
+}
+
+#endif
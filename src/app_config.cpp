@@ -0,0 +1,383 @@
+#include "app_config.h"
+#include "parse_value.h"
+#include "utils.h"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    std::string trim(const std::string &s)
+    {
+        const char *spaces = " \t\r\n";
+        size_t begin = s.find_first_not_of(spaces);
+        if (begin == std::string::npos)
+            return "";
+        size_t end = s.find_last_not_of(spaces);
+        return s.substr(begin, end - begin + 1);
+    }
+
+    bool parseBool(const std::string &value, bool &out)
+    {
+        if (value == "true" || value == "1" || value == "on" || value == "yes")
+            out = true;
+        else if (value == "false" || value == "0" || value == "off" || value == "no")
+            out = false;
+        else
+            return false;
+        return true;
+    }
+
+    bool parseSize(const std::string &value, int &width, int &height)
+    {
+        char end;
+        return sscanf(value.c_str(), "%dx%d%c", &width, &height, &end) == 2;
+    }
+
+    bool parseBox(const std::string &value, std::vector<float> &box)
+    {
+        float v[6];
+        char end;
+        if (sscanf(value.c_str(), "%f,%f,%f,%f,%f,%f%c", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &end) != 6)
+            return false;
+        for (float it : v)
+            if (!std::isfinite(it))
+                return false;
+        box.assign(v, v + 6);
+        return true;
+    }
+
+    bool loadConfigFile(const std::string &path, AppConfig &config)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            std::cout << "[Sample][Error] Unable to open the config file " << path << std::endl;
+            return false;
+        }
+
+        bool ok = true;
+        std::string line;
+        int line_number = 0;
+        while (std::getline(file, line))
+        {
+            line_number++;
+            line = trim(line.substr(0, line.find('#')));
+            if (line.empty())
+                continue;
+            size_t sep = line.find('=');
+            if (sep == std::string::npos)
+            {
+                std::cout << "[Sample][Error] " << path << ":" << line_number << " : expected 'key = value'" << std::endl;
+                ok = false;
+                continue;
+            }
+            if (!setConfigValue(config, trim(line.substr(0, sep)), trim(line.substr(sep + 1))))
+            {
+                std::cout << "[Sample][Error] " << path << ":" << line_number << std::endl;
+                ok = false;
+            }
+        }
+        std::cout << "[Sample] Using config file: " << path << std::endl;
+        return ok;
+    }
+}
+
+bool setConfigValue(AppConfig &config, const std::string &key, const std::string &value)
+{
+    bool ok = true;
+    if (key == "input")
+        config.input = value;
+    else if (key == "depth-mode")
+    {
+        if (value == "PERFORMANCE")
+            config.depth_mode = sl::DEPTH_MODE::PERFORMANCE;
+        else if (value == "QUALITY")
+            config.depth_mode = sl::DEPTH_MODE::QUALITY;
+        else if (value == "ULTRA")
+            config.depth_mode = sl::DEPTH_MODE::ULTRA;
+        else
+            ok = false;
+    }
+    else if (key == "camera-fps")
+        ok = parse_value::toInt(value, config.camera_fps);
+    else if (key == "max-depth")
+        ok = parse_value::toFloat(value, config.max_depth);
+    else if (key == "confidence")
+        ok = parse_value::toInt(value, config.confidence_threshold);
+    else if (key == "mapping-range")
+    {
+        typedef sl::SpatialMappingParameters::MAPPING_RANGE RANGE;
+        if (value == "SHORT")
+            config.mapping_range = RANGE::SHORT;
+        else if (value == "MEDIUM")
+            config.mapping_range = RANGE::MEDIUM;
+        else if (value == "LONG")
+            config.mapping_range = RANGE::LONG;
+        else if (value == "AUTO")
+            config.mapping_range = RANGE::AUTO;
+        else
+            ok = false;
+    }
+    else if (key == "mapping-resolution")
+        ok = parse_value::toFloat(value, config.mapping_resolution);
+    else if (key == "map-request-interval")
+        ok = parse_value::toInt(value, config.map_request_interval_ms);
+    else if (key == "morton-order")
+        ok = parseBool(value, config.morton_order);
+    else if (key == "headless")
+        ok = parseBool(value, config.headless);
+    else if (key == "export")
+        config.export_path = value;
+    else if (key == "export-box")
+        ok = value.empty() ? (config.export_box.clear(), true) : parseBox(value, config.export_box);
+    else if (key == "page-dir")
+        config.page_dir = value;
+    else if (key == "page-after")
+        ok = parse_value::toFloat(value, config.page_after);
+    else if (key == "page-distance")
+        ok = parse_value::toFloat(value, config.page_distance);
+    else if (key == "serve")
+        config.serve = value;
+    else if (key == "serve-buffer")
+        ok = parse_value::toInt(value, config.serve_buffer_kb);
+    else if (key == "serve-loopback")
+        ok = parseBool(value, config.serve_loopback);
+    else if (key == "codec-precision")
+        ok = parse_value::toFloat(value, config.codec_precision);
+    else if (key == "preview")
+        ok = parseBool(value, config.preview);
+    else if (key == "preview-fps")
+        ok = parse_value::toFloat(value, config.preview_fps);
+    else if (key == "preview-size")
+        ok = parseSize(value, config.preview_width, config.preview_height);
+    else if (key == "edl")
+        ok = parseBool(value, config.edl);
+    else if (key == "viewer-fps")
+        ok = parse_value::toFloat(value, config.viewer_fps);
+    else if (key == "vsync")
+        ok = parseBool(value, config.vsync);
+    else if (key == "gpu-budget")
+        ok = parse_value::toInt(value, config.gpu_budget_mb);
+    else if (key == "gpu-upload-budget")
+        ok = parse_value::toInt(value, config.gpu_upload_budget_mb);
+    else if (key == "lod-size")
+        ok = parse_value::toFloat(value, config.lod_size);
+    else if (key == "source-tint")
+        ok = parse_value::toFloat(value, config.source_tint);
+    else if (key == "pose-queue-size")
+        ok = parse_value::toInt(value, config.pose_queue_size);
+    else if (key == "path-buffer-size")
+        ok = parse_value::toInt(value, config.path_buffer_size);
+    else if (key == "offscreen")
+        config.offscreen.output = value;
+    else if (key == "offscreen-size")
+        ok = parseSize(value, config.offscreen.width, config.offscreen.height);
+    else if (key == "offscreen-fps")
+        ok = parse_value::toFloat(value, config.offscreen.fps);
+    else if (key == "offscreen-raw")
+        ok = parseBool(value, config.offscreen.raw);
+    else if (key == "offscreen-queue-size")
+        ok = parse_value::toInt(value, config.offscreen.queue_size);
+    else if (key == "opencv-threads")
+        ok = parse_value::toInt(value, config.opencv_threads);
+    else if (key == "worker-threads")
+        ok = parse_value::toInt(value, config.worker_threads);
+    else
+    {
+        std::cout << "[Sample][Error] Unknown option '" << key << "'" << std::endl;
+        return false;
+    }
+
+    if (!ok)
+        std::cout << "[Sample][Error] Invalid value '" << value << "' for option '" << key << "'" << std::endl;
+    return ok;
+}
+
+bool validateConfig(const AppConfig &config)
+{
+    bool ok = true;
+    auto check = [&ok](bool condition, const char *msg) {
+        if (!condition)
+        {
+            std::cout << "[Sample][Error] Invalid configuration: " << msg << std::endl;
+            ok = false;
+        }
+    };
+    check(config.camera_fps >= 0, "camera-fps must be positive");
+    check(config.max_depth >= 0.f, "max-depth must be positive");
+    check(config.confidence_threshold >= 1 && config.confidence_threshold <= 100, "confidence must be in [1, 100]");
+    check(config.mapping_resolution >= 0.f, "mapping-resolution must be positive");
+    check(config.map_request_interval_ms >= 0, "map-request-interval must be positive");
+    check(config.preview_width > 0 && config.preview_height > 0, "preview-size must be positive");
+    check(config.export_box.empty() || (config.export_box[0] <= config.export_box[3] && config.export_box[1] <= config.export_box[4] &&
+                                        config.export_box[2] <= config.export_box[5]),
+          "export-box minimum must be lower than its maximum");
+    check(config.page_after >= 0.f, "page-after must be positive");
+    check(config.page_distance >= 0.f, "page-distance must be positive");
+    check(config.serve_buffer_kb > 0, "serve-buffer must be strictly positive");
+    check(!config.serve_loopback || !config.serve.empty(), "serve-loopback needs serve");
+    check(config.codec_precision > 0.f, "codec-precision must be strictly positive");
+    check(config.preview_fps >= 0.f, "preview-fps must be positive");
+    check(config.viewer_fps >= 0.f, "viewer-fps must be positive");
+    check(config.path_buffer_size >= 0, "path-buffer-size must be positive");
+    check(config.gpu_budget_mb >= 0, "gpu-budget must be positive");
+    check(config.gpu_upload_budget_mb >= 0, "gpu-upload-budget must be positive");
+    check(config.lod_size >= 0.f, "lod-size must be positive");
+    check(config.source_tint >= 0.f && config.source_tint <= 1.f, "source-tint must be in [0, 1]");
+    check(config.pose_queue_size > 0, "pose-queue-size must be strictly positive");
+    check(config.offscreen.width > 0 && config.offscreen.height > 0, "offscreen-size must be positive");
+    check(config.offscreen.fps >= 0.f, "offscreen-fps must be positive");
+    check(config.offscreen.queue_size > 0, "offscreen-queue-size must be at least 1");
+    check(config.opencv_threads >= -1, "opencv-threads must be -1 or positive");
+    check(config.worker_threads >= -1, "worker-threads must be -1 or positive");
+    check(!(config.headless && !config.offscreen.output.empty()), "offscreen rendering needs the viewer, it cannot be headless");
+    return ok;
+}
+
+bool parse_args(int argc, char **argv, AppConfig &config)
+{
+    bool ok = true;
+    // The config file is read first so that the command line overrides it, wherever it is given
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = std::string(argv[i]);
+        if (arg.find("--config=") == 0)
+            ok &= loadConfigFile(arg.substr(std::string("--config=").size()), config);
+    }
+
+    bool has_input = false;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = std::string(argv[i]);
+        if (arg.find("--config=") == 0)
+            continue;
+        if (arg.find("--") == 0)
+        {
+            size_t sep = arg.find('=');
+            // an option without value is a boolean switched on
+            if (sep == std::string::npos)
+                ok &= setConfigValue(config, arg.substr(2), "true");
+            else
+                ok &= setConfigValue(config, arg.substr(2, sep - 2), arg.substr(sep + 1));
+        }
+        else if (!has_input)
+        {
+            config.input = arg;
+            has_input = true;
+        }
+        else
+        {
+            std::cout << "[Sample][Error] Unexpected argument '" << arg << "'" << std::endl;
+            ok = false;
+        }
+    }
+
+    if (!ok || !validateConfig(config))
+        return false;
+
+    if (config.headless)
+        std::cout << "[Sample] Running headless (no viewer, no preview)" << std::endl;
+    if (!config.export_path.empty())
+        std::cout << "[Sample] Fused point cloud will be saved to: " << config.export_path << std::endl;
+    if (!config.offscreen.output.empty())
+        std::cout << "[Sample] Rendering offscreen to: " << config.offscreen.output << std::endl;
+    return true;
+}
+
+std::vector<std::string> getInputs(const AppConfig &config)
+{
+    std::vector<std::string> inputs;
+    size_t begin = 0;
+    for (;;)
+    {
+        size_t end = config.input.find(',', begin);
+        inputs.push_back(trim(config.input.substr(begin, end == std::string::npos ? std::string::npos : end - begin)));
+        if (end == std::string::npos)
+            break;
+        begin = end + 1;
+    }
+    return inputs;
+}
+
+void setInitParameters(const AppConfig &config, const std::string &arg, sl::InitParameters &param)
+{
+    param.depth_mode = config.depth_mode;
+    if (config.camera_fps)
+        param.camera_fps = config.camera_fps;
+    if (config.max_depth > 0.f)
+    {
+        param.depth_maximum_distance = config.max_depth * getUnitScale(param.coordinate_units);
+    }
+
+    if (arg.empty())
+        return;
+
+    if (arg.find(".svo") != std::string::npos)
+    {
+        // SVO input mode
+        param.input.setFromSVOFile(arg.c_str());
+        // Headless runs process the SVO as fast as possible
+        param.svo_real_time_mode = !config.headless;
+
+        std::cout << "[Sample] Using SVO File input: " << arg << std::endl;
+        return;
+    }
+
+    unsigned int a, b, c, d, port;
+    if (sscanf(arg.c_str(), "%u.%u.%u.%u:%d", &a, &b, &c, &d, &port) == 5)
+    {
+        // Stream input mode - IP + port
+        std::string ip_adress = std::to_string(a) + "." + std::to_string(b) + "." + std::to_string(c) + "." + std::to_string(d);
+        param.input.setFromStream(sl::String(ip_adress.c_str()), port);
+        std::cout << "[Sample] Using Stream input, IP : " << ip_adress << ", port : " << port << std::endl;
+    }
+    else if (sscanf(arg.c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) == 4)
+    {
+        // Stream input mode - IP only
+        param.input.setFromStream(sl::String(arg.c_str()));
+        std::cout << "[Sample] Using Stream input, IP : " << arg << std::endl;
+    }
+    else
+    {
+        // Camera selection, the first camera by default
+        size_t at = arg.find('@');
+        if (at != std::string::npos)
+        {
+            unsigned int serial;
+            int id;
+            if (sscanf(arg.c_str() + at + 1, "sn%u", &serial) == 1)
+            {
+                param.input.setFromSerialNumber(serial);
+                std::cout << "[Sample] Using Camera with serial number " << serial << std::endl;
+            }
+            else if (sscanf(arg.c_str() + at + 1, "%d", &id) == 1)
+            {
+                param.input.setFromCameraID(id);
+                std::cout << "[Sample] Using Camera " << id << std::endl;
+            }
+        }
+    }
+
+    if (arg.find("HD2K") != std::string::npos)
+    {
+        param.camera_resolution = sl::RESOLUTION::HD2K;
+        std::cout << "[Sample] Using Camera in resolution HD2K" << std::endl;
+    }
+    else if (arg.find("HD1080") != std::string::npos)
+    {
+        param.camera_resolution = sl::RESOLUTION::HD1080;
+        std::cout << "[Sample] Using Camera in resolution HD1080" << std::endl;
+    }
+    else if (arg.find("HD720") != std::string::npos)
+    {
+        param.camera_resolution = sl::RESOLUTION::HD720;
+        std::cout << "[Sample] Using Camera in resolution HD720" << std::endl;
+    }
+    else if (arg.find("VGA") != std::string::npos)
+    {
+        param.camera_resolution = sl::RESOLUTION::VGA;
+        std::cout << "[Sample] Using Camera in resolution VGA" << std::endl;
+    }
+}
@@ -0,0 +1,169 @@
+#include "camera_source.h"
+
+static_assert(sizeof(MapPoint) == sizeof(sl::float4), "MapPoint must match the layout of the ZED chunk vertices");
+
+CameraSource::CameraSource(int id) : id_(id), stop_requested_(false), running_(false) {}
+
+CameraSource::~CameraSource()
+{
+    stop(false);
+    close();
+}
+
+bool CameraSource::open(const AppConfig &config, const std::string &input)
+{
+    sl::InitParameters init_parameters;
+    init_parameters.coordinate_system = sl::COORDINATE_SYSTEM::RIGHT_HANDED_Y_UP; // OpenGL's coordinate system is right_handed
+    setInitParameters(config, input, init_parameters);
+
+    // Open the camera
+    auto returned_state = zed_.open(init_parameters);
+    if (returned_state != sl::ERROR_CODE::SUCCESS)
+    {
+        print("Open Camera " + std::to_string(id_), returned_state);
+        return false;
+    }
+
+    // Setup and start positional tracking
+    sl::PositionalTrackingParameters positional_tracking_parameters;
+    positional_tracking_parameters.enable_area_memory = false;
+    returned_state = zed_.enablePositionalTracking(positional_tracking_parameters);
+    if (returned_state != sl::ERROR_CODE::SUCCESS)
+    {
+        print("Enabling positional tracking failed: ", returned_state);
+        zed_.close();
+        return false;
+    }
+
+    // Set spatial mapping parameters
+    sl::SpatialMappingParameters spatial_mapping_parameters;
+    // Request a Point Cloud
+    spatial_mapping_parameters.map_type = sl::SpatialMappingParameters::SPATIAL_MAP_TYPE::FUSED_POINT_CLOUD;
+    // Set mapping range, it will set the resolution accordingly (a higher range, a lower resolution)
+    spatial_mapping_parameters.set(config.mapping_range);
+    if (config.mapping_resolution > 0.f)
+        spatial_mapping_parameters.resolution_meter = config.mapping_resolution;
+    // Request partial updates only (only the lastest updated chunks need to be re-draw)
+    spatial_mapping_parameters.use_chunk_only = true;
+    // Start the spatial mapping
+    zed_.enableSpatialMapping(spatial_mapping_parameters);
+    units_per_meter_ = getUnitScale(init_parameters.coordinate_units);
+    map_resolution_ = spatial_mapping_parameters.resolution_meter * units_per_meter_;
+    map_request_interval_ms_ = config.map_request_interval_ms;
+    release_merged_ = !config.page_dir.empty();
+
+    // Use low depth confidence avoid introducing noise in the constructed model
+    runtime_parameters_.confidence_threshold = config.confidence_threshold;
+
+    // Define display resolution and check that it fit at least the image resolution
+    auto resolution = zed_.getCameraInformation().camera_configuration.resolution;
+    preview_resolution_ = sl::Resolution(std::min((int)resolution.width, config.preview_width),
+                                         std::min((int)resolution.height, config.preview_height));
+    return true;
+}
+
+void CameraSource::close()
+{
+    zed_.close();
+}
+
+void CameraSource::start(ChunkStore &store, PoseCallback on_pose, ImagePreview *preview)
+{
+    store_ = &store;
+    on_pose_ = on_pose;
+    preview_ = preview;
+    stop_requested_ = false;
+    running_ = true;
+    stats_.start();
+    thread_ = std::thread(&CameraSource::run, this);
+}
+
+void CameraSource::stop(bool whole_map)
+{
+    if (!thread_.joinable())
+        return;
+    stop_requested_ = true;
+    thread_.join();
+
+    if (whole_map)
+    {
+        zed_.extractWholeSpatialMap(map_);
+        mergeChunks(true);
+    }
+}
+
+void CameraSource::run()
+{
+    sl::Pose pose;
+    // Timestamp of the last fused point cloud requested
+    std::chrono::steady_clock::time_point ts_last;
+    // Whether the last spatial map request has been retrieved
+    bool map_retrieved = true;
+
+    while (!stop_requested_)
+    {
+        // Grab a new image
+        auto grab_state = zed_.grab(runtime_parameters_);
+        if (grab_state == sl::ERROR_CODE::SUCCESS)
+        {
+            stats_.addGrab();
+            // Retrieve the left image, only at the preview rate
+            if (preview_ && preview_->frameDue())
+            {
+                zed_.retrieveImage(preview_->writeBuffer(), sl::VIEW::LEFT, sl::MEM::CPU, preview_resolution_);
+                preview_->publish();
+            }
+            // Retrieve the camera pose data
+            auto tracking_state = zed_.getPosition(pose);
+            if (on_pose_)
+                on_pose_(id_, pose, tracking_state);
+            const sl::Translation position = pose.pose_data.getTranslation();
+            store_->setPosition(id_, position.x, position.y, position.z);
+
+            if (tracking_state == sl::POSITIONAL_TRACKING_STATE::OK)
+            {
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - ts_last).count();
+
+                // Ask for a fused point cloud update if enough time has elapsed since last request
+                // Note: the retrieved chunks are copied in the store, a new request can be sent right away
+                if ((duration > map_request_interval_ms_) && map_retrieved)
+                {
+                    zed_.requestSpatialMapAsync();
+                    ts_last = std::chrono::steady_clock::now();
+                    map_retrieved = false;
+                }
+
+                // If the requested point cloud is ready to be retrieved
+                if (!map_retrieved && zed_.getSpatialMapRequestStatusAsync() == sl::ERROR_CODE::SUCCESS)
+                {
+                    zed_.retrieveSpatialMapAsync(map_);
+                    stats_.addMapUpdate();
+                    map_retrieved = true;
+                    mergeChunks(false);
+                }
+            }
+        }
+        else if (grab_state == sl::ERROR_CODE::END_OF_SVOFILE_REACHED)
+            break;
+    }
+    stats_.stop();
+    running_ = false;
+}
+
+void CameraSource::mergeChunks(bool all)
+{
+    inputs_.clear();
+    for (int c = 0; c < (int)map_.chunks.size(); c++)
+    {
+        auto &chunk = map_.chunks[c];
+        if (all || chunk.has_been_updated)
+            inputs_.push_back({c, reinterpret_cast<const MapPoint *>(chunk.vertices.data()), chunk.vertices.size()});
+    }
+    if (inputs_.empty())
+        return;
+    store_->update(id_, inputs_);
+    // Only the updated chunks are retrieved, the others can be released
+    if (release_merged_)
+        for (const auto &it : inputs_)
+            std::vector<sl::float4>().swap(map_.chunks[it.index].vertices);
+}
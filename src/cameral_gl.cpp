@@ -1,16 +1,18 @@
 #include "camera_gl.h"
 
-const sl::Translation CameraGL::ORIGINAL_FORWARD = sl::Translation(0, 0, 1);
-const sl::Translation CameraGL::ORIGINAL_UP = sl::Translation(0, 1, 0);
-const sl::Translation CameraGL::ORIGINAL_RIGHT = sl::Translation(1, 0, 0);
+#include <cmath>
 
-CameraGL::CameraGL(sl::Translation position, sl::Translation direction, sl::Translation vertical)
+const vmath::Translation CameraGL::ORIGINAL_FORWARD = vmath::Translation(0, 0, 1);
+const vmath::Translation CameraGL::ORIGINAL_UP = vmath::Translation(0, 1, 0);
+const vmath::Translation CameraGL::ORIGINAL_RIGHT = vmath::Translation(1, 0, 0);
+
+CameraGL::CameraGL(vmath::Translation position, vmath::Translation direction, vmath::Translation vertical)
 {
     this->position_ = position;
     setDirection(direction, vertical);
 
-    offset_ = sl::Translation(0, 0, 0);
-    view_.setIdentity();
+    offset_ = vmath::Translation(0, 0, 0);
+    view_ = simd::identity();
     updateView();
     setProjection(80, 80, 100.f, 900000.f);
     updateVPMatrix();
@@ -20,7 +22,7 @@ CameraGL::~CameraGL() {}
 
 void CameraGL::update()
 {
-    if (sl::Translation::dot(vertical_, up_) < 0)
+    if (vmath::Translation::dot(vertical_, up_) < 0)
         vertical_ = vertical_ * -1.f;
     updateView();
     updateVPMatrix();
@@ -33,19 +35,20 @@ void CameraGL::setProjection(float horizontalFOV, float verticalFOV, float znear
     znear_ = znear;
     zfar_ = zfar;
 
-    float fov_y = verticalFOV * M_PI / 180.f;
-    float fov_x = horizontalFOV * M_PI / 180.f;
+    float fov_y = verticalFOV * vmath::PI / 180.f;
+    float fov_x = horizontalFOV * vmath::PI / 180.f;
 
-    projection_.setIdentity();
-    projection_(0, 0) = 1.0f / tanf(fov_x * 0.5f);
-    projection_(1, 1) = 1.0f / tanf(fov_y * 0.5f);
-    projection_(2, 2) = -(zfar + znear) / (zfar - znear);
-    projection_(3, 2) = -1;
-    projection_(2, 3) = -(2.f * zfar * znear) / (zfar - znear);
-    projection_(3, 3) = 0;
+    // Row major
+    projection_ = simd::identity();
+    projection_.m[0] = 1.0f / tanf(fov_x * 0.5f);
+    projection_.m[5] = 1.0f / tanf(fov_y * 0.5f);
+    projection_.m[10] = -(zfar + znear) / (zfar - znear);
+    projection_.m[14] = -1;
+    projection_.m[11] = -(2.f * zfar * znear) / (zfar - znear);
+    projection_.m[15] = 0;
 }
 
-const sl::Transform &CameraGL::getViewProjectionMatrix() const
+const simd::Mat4 &CameraGL::getViewProjectionMatrix() const
 {
     return vpMatrix_;
 }
@@ -60,80 +63,70 @@ float CameraGL::getVerticalFOV() const
     return verticalFieldOfView_;
 }
 
-void CameraGL::setOffsetFromPosition(const sl::Translation &o)
+void CameraGL::setOffsetFromPosition(const vmath::Translation &o)
 {
     offset_ = o;
 }
 
-const sl::Translation &CameraGL::getOffsetFromPosition() const
+const vmath::Translation &CameraGL::getOffsetFromPosition() const
 {
     return offset_;
 }
 
-void CameraGL::setDirection(const sl::Translation &direction, const sl::Translation &vertical)
+void CameraGL::setDirection(const vmath::Translation &direction, const vmath::Translation &vertical)
 {
-    sl::Translation dirNormalized = direction;
+    vmath::Translation dirNormalized = direction;
     dirNormalized.normalize();
-    this->rotation_ = sl::Orientation(ORIGINAL_FORWARD, dirNormalized * -1.f);
+    this->rotation_ = vmath::Orientation(ORIGINAL_FORWARD, dirNormalized * -1.f);
     updateVectors();
     this->vertical_ = vertical;
-    if (sl::Translation::dot(vertical_, up_) < 0)
-        rotate(sl::Rotation(M_PI, ORIGINAL_FORWARD));
+    if (vmath::Translation::dot(vertical_, up_) < 0)
+        rotate(vmath::Orientation::fromAxisAngle(vmath::PI, ORIGINAL_FORWARD));
 }
 
-void CameraGL::translate(const sl::Translation &t)
+void CameraGL::translate(const vmath::Translation &t)
 {
     position_ = position_ + t;
 }
 
-void CameraGL::setPosition(const sl::Translation &p)
+void CameraGL::setPosition(const vmath::Translation &p)
 {
     position_ = p;
 }
 
-void CameraGL::rotate(const sl::Orientation &rot)
+void CameraGL::rotate(const vmath::Orientation &rot)
 {
     rotation_ = rot * rotation_;
     updateVectors();
 }
 
-void CameraGL::rotate(const sl::Rotation &m)
-{
-    this->rotate(sl::Orientation(m));
-}
-
-void CameraGL::setRotation(const sl::Orientation &rot)
+void CameraGL::setRotation(const vmath::Orientation &rot)
 {
     rotation_ = rot;
     updateVectors();
 }
 
-void CameraGL::setRotation(const sl::Rotation &m)
-{
-    this->setRotation(sl::Orientation(m));
-}
-
-const sl::Translation &CameraGL::getPosition() const
+const vmath::Translation &CameraGL::getPosition() const
 {
     return position_;
 }
 
-const sl::Translation &CameraGL::getForward() const
+const vmath::Translation &CameraGL::getForward() const
 {
     return forward_;
 }
 
-const sl::Translation &CameraGL::getRight() const
+const vmath::Translation &CameraGL::getRight() const
 {
     return right_;
 }
 
-const sl::Translation &CameraGL::getUp() const
+const vmath::Translation &CameraGL::getUp() const
 {
     return up_;
 }
 
-const sl::Translation &CameraGL::getVertical() const
+const vmath::Translation &CameraGL::getVertical() const
 {
     return vertical_;
 }
@@ -152,18 +145,26 @@ void CameraGL::updateVectors()
 {
     forward_ = ORIGINAL_FORWARD * rotation_;
     up_ = ORIGINAL_UP * rotation_;
-    right_ = sl::Translation(ORIGINAL_RIGHT * -1.f) * rotation_;
+    right_ = (ORIGINAL_RIGHT * -1.f) * rotation_;
 }
 
 void CameraGL::updateView()
 {
     // camera's model matrix in world space
-    sl::Transform transformation(rotation_, (offset_ * rotation_) + position_);
+    const float q[4] = {rotation_.x, rotation_.y, rotation_.z, rotation_.w};
+    const float t[3] = {position_.x, position_.y, position_.z};
+    // the eye is offset from the position in the camera's local space
+    simd::Mat4 offset = simd::identity();
+    offset.m[3] = offset_.x;
+    offset.m[7] = offset_.y;
+    offset.m[11] = offset_.z;
+    const simd::Mat4 transformation = simd::multiply(simd::fromQuatTranslation(q, t), offset);
     // get view matrix by transforms vertices from world space to camera space, or view space.
-    view_ = sl::Transform::inverse(transformation);
+    // Note: the model matrix is rigid, its inverse is computed in closed form
+    view_ = simd::rigidInverse(transformation);
 }
 
 void CameraGL::updateVPMatrix()
 {
-    vpMatrix_ = projection_ * view_;
+    vpMatrix_ = simd::multiply(projection_, view_);
 }
\ No newline at end of file
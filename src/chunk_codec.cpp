@@ -0,0 +1,704 @@
+#include "chunk_codec.h"
+#include "map_protocol.h"
+#include "morton_order.h"
+#include "parallel_primitives.h"
+#include "scratch_arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace chunk_codec
+{
+    namespace
+    {
+        enum Mode : uint32_t
+        {
+            QUANTIZED = 0,
+            /// MapPoint array, for the points which cannot be quantized
+            RAW = 1
+        };
+
+        struct EncodedHeader
+        {
+            uint32_t nbPoints;
+            uint32_t mode;
+            float step;
+            /// Position of the grid origin, in steps
+            int32_t origin[3];
+            /// Sizes of the position stream and of the first two color streams, the last one takes the rest
+            uint32_t streamSize[3];
+        };
+        static_assert(sizeof(EncodedHeader) == 36, "EncodedHeader is stored as is");
+
+        const uint32_t FILE_MAGIC = 0x43504d5a; // "ZMPC"
+        const uint32_t FILE_VERSION = 1;
+
+        struct FileHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t nbSources;
+            float unitsPerMeter;
+            float mapResolution;
+            float step;
+        };
+        static_assert(sizeof(FileHeader) == 24, "FileHeader is stored as is");
+
+        struct RecordHeader
+        {
+            int32_t source;
+            int32_t index;
+            uint32_t size;
+        };
+        static_assert(sizeof(RecordHeader) == 12, "RecordHeader is stored as is");
+
+        /// Points per Rice parameter
+        const size_t BLOCK_SIZE = 64;
+        /// 21 bits per axis in a 63 bits Morton code
+        const int64_t MAX_COORD = morton::MAX_CELLS - 1;
+        /// Grid coordinates are below this in absolute value, origin + coordinate then fits in an int32_t
+        const int32_t MAX_ORIGIN = 1 << 30;
+        /// Rice quotients from this value are escaped, the value is then stored with its bit width
+        const uint32_t ESCAPE = 32;
+
+        inline int countTrailingZeros(uint64_t v)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, v);
+            return (int)index;
+#else
+            return __builtin_ctzll(v);
+#endif
+        }
+
+        inline int bitWidth(uint64_t v)
+        {
+            if (!v)
+                return 0;
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanReverse64(&index, v);
+            return (int)index + 1;
+#else
+            return 64 - __builtin_clzll(v);
+#endif
+        }
+
+        /// Small signed deltas (as two's complement bytes) to small unsigned values
+        inline uint8_t zigzag(uint8_t delta)
+        {
+            return (uint8_t)(((uint32_t)delta << 1) ^ (0u - (delta >> 7)));
+        }
+
+        inline uint8_t unzigzag(uint32_t z)
+        {
+            return (uint8_t)((z >> 1) ^ (0u - (z & 1)));
+        }
+
+        /// Little endian bit stream, least significant bits first, appended to a byte vector
+        template <typename Buffer>
+        class BitWriter
+        {
+        public:
+            explicit BitWriter(Buffer &out) : out_(out) {}
+
+            /// bits <= 32, value must fit in bits
+            void put(uint32_t value, int bits)
+            {
+                acc_ |= (uint64_t)value << n_;
+                n_ += bits;
+                if (n_ >= 32)
+                {
+                    const uint32_t word = (uint32_t)acc_;
+                    const size_t offset = out_.size();
+                    out_.resize(offset + 4);
+                    memcpy(&out_[offset], &word, 4);
+                    acc_ >>= 32;
+                    n_ -= 32;
+                }
+            }
+
+            void put64(uint64_t value, int bits)
+            {
+                if (bits > 32)
+                {
+                    put((uint32_t)value, 32);
+                    put((uint32_t)(value >> 32), bits - 32);
+                }
+                else
+                    put((uint32_t)value, bits);
+            }
+
+            /// q zeros and a one for the quotient, then the k low bits
+            void putRice(uint64_t value, int k)
+            {
+                const uint64_t q = value >> k;
+                if (q < ESCAPE)
+                {
+                    put(1u << q, (int)q + 1);
+                    put64(value & ((1ull << k) - 1), k);
+                }
+                else
+                {
+                    put(0, ESCAPE);
+                    const int width = bitWidth(value);
+                    put(width - 1, 6);
+                    put64(value, width);
+                }
+            }
+
+            void flush()
+            {
+                while (n_ > 0)
+                {
+                    out_.push_back((uint8_t)acc_);
+                    acc_ >>= 8;
+                    n_ -= 8;
+                }
+                acc_ = 0;
+                n_ = 0;
+            }
+
+        private:
+            Buffer &out_;
+            uint64_t acc_ = 0;
+            int n_ = 0;
+        };
+
+        class BitReader
+        {
+        public:
+            BitReader(const uint8_t *data, size_t size) : begin_(data), p_(data), end_(data + size) {}
+
+            /// At least 56 bits available, zeros past the end
+            void refill()
+            {
+                if (end_ - p_ >= 8)
+                {
+                    uint64_t v;
+                    memcpy(&v, p_, 8);
+                    acc_ |= v << n_;
+                    p_ += (63 - n_) >> 3;
+                    n_ |= 56;
+                }
+                else
+                    refillEnd();
+            }
+
+            /// bits <= 32
+            uint32_t get(int bits)
+            {
+                if (n_ < bits)
+                    refill();
+                const uint32_t v = (uint32_t)(acc_ & ((1ull << bits) - 1));
+                acc_ >>= bits;
+                n_ -= bits;
+                return v;
+            }
+
+            uint64_t get64(int bits)
+            {
+                if (bits <= 32)
+                    return get(bits);
+                const uint64_t low = get(32);
+                return low | ((uint64_t)get(bits - 32) << 32);
+            }
+
+            uint64_t getRice(int k)
+            {
+                if (n_ < (int)ESCAPE + 1)
+                    refill();
+                const int q = countTrailingZeros(acc_ | (1ull << ESCAPE));
+                // Usual case, the whole code is in the accumulator
+                if (q < (int)ESCAPE && q + 1 + k <= n_)
+                {
+                    acc_ >>= q + 1;
+                    const uint64_t low = acc_ & ((1ull << k) - 1);
+                    acc_ >>= k;
+                    n_ -= q + 1 + k;
+                    return ((uint64_t)q << k) | low;
+                }
+                if (q < (int)ESCAPE)
+                {
+                    acc_ >>= q + 1;
+                    n_ -= q + 1;
+                    return ((uint64_t)q << k) | get64(k);
+                }
+                acc_ >>= ESCAPE;
+                n_ -= ESCAPE;
+                return get64((int)get(6) + 1);
+            }
+
+            /// False if more bits were read than available
+            bool isValid() const
+            {
+                return (size_t)(p_ - begin_) * 8 + padding_ - n_ <= (size_t)(end_ - begin_) * 8;
+            }
+
+        private:
+            /// Last bytes, one at a time
+            void refillEnd()
+            {
+                while (n_ <= 56)
+                {
+                    if (p_ < end_)
+                        acc_ |= (uint64_t)*p_++ << n_;
+                    else
+                        padding_ += 8;
+                    n_ += 8;
+                }
+            }
+
+            const uint8_t *begin_;
+            const uint8_t *p_;
+            const uint8_t *end_;
+            uint64_t acc_ = 0;
+            int n_ = 0;
+            size_t padding_ = 0;
+        };
+
+        /// Rice parameter with the smallest cost around the mean of the values
+        int chooseRice(const uint64_t *values, size_t n, int max_k)
+        {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < n; i++)
+                sum += values[i];
+            const int mean_k = bitWidth(sum / n);
+            int best_k = 0;
+            uint64_t best_cost = ~0ull;
+            for (int k = std::max(mean_k - 2, 0); k <= std::min(mean_k + 1, max_k); k++)
+            {
+                uint64_t cost = 0;
+                for (size_t i = 0; i < n; i++)
+                {
+                    const uint64_t q = values[i] >> k;
+                    cost += q < ESCAPE ? q + 1 + k : ESCAPE + 6 + bitWidth(values[i]);
+                }
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_k = k;
+                }
+            }
+            return best_k;
+        }
+
+        size_t encodeRaw(const MapPoint *points, size_t nb_points, float step, std::vector<uint8_t> &out, size_t stride)
+        {
+            const size_t n = (nb_points + stride - 1) / stride;
+            EncodedHeader header = {};
+            header.nbPoints = (uint32_t)n;
+            header.mode = RAW;
+            header.step = step;
+            header.streamSize[0] = (uint32_t)(n * sizeof(MapPoint));
+            const size_t offset = out.size();
+            out.resize(offset + sizeof(header) + header.streamSize[0]);
+            memcpy(&out[offset], &header, sizeof(header));
+            MapPoint *dst = reinterpret_cast<MapPoint *>(&out[offset + sizeof(header)]);
+            for (size_t i = 0; i < nb_points; i += stride)
+                memcpy(dst++, &points[i], sizeof(MapPoint));
+            return out.size() - offset;
+        }
+    }
+
+    size_t encode(const MapPoint *points, size_t nb_points, float step, std::vector<uint8_t> &out, size_t stride)
+    {
+        stride = std::max<size_t>(stride, 1);
+        const size_t n = (nb_points + stride - 1) / stride;
+        // All the temporaries are scratch memory, only out grows on the heap
+        ScratchScope scope;
+
+        // Grid coordinates, the chunk must fit in 21 bits per axis
+        ScratchVector<int64_t> grid(n * 3);
+        int64_t lo[3] = {INT64_MAX, INT64_MAX, INT64_MAX};
+        int64_t hi[3] = {INT64_MIN, INT64_MIN, INT64_MIN};
+        const double inv_step = step > 0.f ? 1. / step : 0.;
+        for (size_t i = 0; i < n; i++)
+        {
+            const MapPoint &p = points[i * stride];
+            const float xyz[3] = {p.x, p.y, p.z};
+            for (int j = 0; j < 3; j++)
+            {
+                const double v = std::floor(xyz[j] * inv_step + 0.5);
+                if (!(std::fabs(v) < (double)MAX_ORIGIN))
+                    return encodeRaw(points, nb_points, step, out, stride);
+                grid[i * 3 + j] = (int64_t)v;
+                lo[j] = std::min(lo[j], grid[i * 3 + j]);
+                hi[j] = std::max(hi[j], grid[i * 3 + j]);
+            }
+        }
+        for (int j = 0; j < 3 && n; j++)
+            if (hi[j] - lo[j] > MAX_COORD)
+                return encodeRaw(points, nb_points, step, out, stride);
+
+        // Morton order
+        ScratchVector<uint64_t> codes(n);
+        ScratchVector<uint32_t> order(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            const int64_t *g = &grid[i * 3];
+            codes[i] = morton::encode((uint32_t)(g[0] - lo[0]), (uint32_t)(g[1] - lo[1]), (uint32_t)(g[2] - lo[2]));
+            order[i] = (uint32_t)(i * stride);
+        }
+        parallel::radixSort(codes.data(), order.data(), n);
+
+        const size_t offset = out.size();
+        EncodedHeader header = {};
+        header.nbPoints = (uint32_t)n;
+        header.mode = QUANTIZED;
+        header.step = step;
+        for (int j = 0; j < 3; j++)
+            header.origin[j] = n ? (int32_t)lo[j] : 0;
+        out.resize(offset + sizeof(header));
+
+        // Deltas of the Morton codes
+        {
+            BitWriter<std::vector<uint8_t>> writer(out);
+            uint64_t deltas[BLOCK_SIZE];
+            uint64_t previous = 0;
+            for (size_t block = 0; block < n; block += BLOCK_SIZE)
+            {
+                const size_t count = std::min(BLOCK_SIZE, n - block);
+                for (size_t i = 0; i < count; i++)
+                {
+                    deltas[i] = codes[block + i] - previous;
+                    previous = codes[block + i];
+                }
+                const int k = chooseRice(deltas, count, 63);
+                writer.put(k, 6);
+                for (size_t i = 0; i < count; i++)
+                    writer.putRice(deltas[i], k);
+            }
+            writer.flush();
+        }
+        header.streamSize[0] = (uint32_t)(out.size() - offset - sizeof(header));
+
+        // Colors: G, R-G, B-G, each one delta coded in its own stream so that they are decoded in parallel
+        {
+            // Reserved to the raw size of a channel, which they hardly ever exceed
+            ScratchVector<uint8_t> streams[3];
+            for (auto &it : streams)
+                it.reserve(n + 16);
+            typedef BitWriter<ScratchVector<uint8_t>> ColorWriter;
+            ColorWriter writers[3] = {ColorWriter(streams[0]), ColorWriter(streams[1]), ColorWriter(streams[2])};
+            uint64_t values[3][BLOCK_SIZE];
+            uint8_t previous[3] = {0, 0, 0};
+            for (size_t block = 0; block < n; block += BLOCK_SIZE)
+            {
+                const size_t count = std::min(BLOCK_SIZE, n - block);
+                for (size_t i = 0; i < count; i++)
+                {
+                    const uint32_t color = points[order[block + i]].color;
+                    const uint8_t r = (uint8_t)(color >> 16), g = (uint8_t)(color >> 8), b = (uint8_t)color;
+                    const uint8_t c[3] = {g, (uint8_t)(r - g), (uint8_t)(b - g)};
+                    for (int j = 0; j < 3; j++)
+                    {
+                        values[j][i] = zigzag((uint8_t)(c[j] - previous[j]));
+                        previous[j] = c[j];
+                    }
+                }
+                for (int j = 0; j < 3; j++)
+                {
+                    const int k = chooseRice(values[j], count, 7);
+                    writers[j].put(k, 3);
+                    for (size_t i = 0; i < count; i++)
+                        writers[j].putRice(values[j][i], k);
+                }
+            }
+            for (int j = 0; j < 3; j++)
+            {
+                writers[j].flush();
+                if (j < 2)
+                    header.streamSize[j + 1] = (uint32_t)streams[j].size();
+                out.insert(out.end(), streams[j].begin(), streams[j].end());
+            }
+        }
+
+        memcpy(&out[offset], &header, sizeof(header));
+        return out.size() - offset;
+    }
+
+    bool decode(const uint8_t *data, size_t size, std::vector<MapPoint> &points)
+    {
+        EncodedHeader header;
+        if (size < sizeof(header))
+            return false;
+        memcpy(&header, data, sizeof(header));
+        data += sizeof(header);
+        size -= sizeof(header);
+        if ((size_t)header.streamSize[0] + header.streamSize[1] + header.streamSize[2] > size)
+            return false;
+
+        if (header.mode == RAW)
+        {
+            if (header.streamSize[0] != (size_t)header.nbPoints * sizeof(MapPoint) || size != header.streamSize[0])
+                return false;
+            points.resize(header.nbPoints);
+            memcpy(points.data(), data, header.streamSize[0]);
+            return true;
+        }
+        if (header.mode != QUANTIZED)
+            return false;
+
+        const size_t n = header.nbPoints;
+        // Every point takes four bits at least, reject sizes which cannot be right before allocating
+        if (n > (size_t)size * 2)
+            return false;
+        for (int j = 0; j < 3; j++)
+            if (header.origin[j] <= -MAX_ORIGIN || header.origin[j] >= MAX_ORIGIN)
+                return false;
+        points.resize(n);
+        const uint8_t *color_data = data + header.streamSize[0];
+        BitReader positions(data, header.streamSize[0]);
+        BitReader g_stream(color_data, header.streamSize[1]);
+        BitReader rg_stream(color_data + header.streamSize[1], header.streamSize[2]);
+        BitReader bg_stream(color_data + header.streamSize[1] + header.streamSize[2],
+                            size - header.streamSize[0] - header.streamSize[1] - header.streamSize[2]);
+        const float step = header.step;
+        const int32_t *origin = header.origin;
+        uint64_t code = 0;
+        uint8_t g = 0, rg = 0, bg = 0;
+        for (size_t block = 0; block < n; block += BLOCK_SIZE)
+        {
+            const size_t count = std::min(BLOCK_SIZE, n - block);
+            const int k = (int)positions.get(6);
+            const int k_g = (int)g_stream.get(3), k_rg = (int)rg_stream.get(3), k_bg = (int)bg_stream.get(3);
+            MapPoint *p = &points[block];
+            for (size_t i = 0; i < count; i++, p++)
+            {
+                // Four independent streams, their decoding overlaps
+                code += positions.getRice(k);
+                g = (uint8_t)(g + unzigzag((uint32_t)g_stream.getRice(k_g)));
+                rg = (uint8_t)(rg + unzigzag((uint32_t)rg_stream.getRice(k_rg)));
+                bg = (uint8_t)(bg + unzigzag((uint32_t)bg_stream.getRice(k_bg)));
+                p->x = (float)(origin[0] + (int32_t)morton::compact3(code)) * step;
+                p->y = (float)(origin[1] + (int32_t)morton::compact3(code >> 1)) * step;
+                p->z = (float)(origin[2] + (int32_t)morton::compact3(code >> 2)) * step;
+                p->color = ((uint32_t)(uint8_t)(rg + g) << 16) | ((uint32_t)g << 8) | (uint8_t)(bg + g);
+            }
+        }
+        return positions.isValid() && g_stream.isValid() && rg_stream.isValid() && bg_stream.isValid();
+    }
+
+    void encode(const std::vector<const ChunkData *> &chunks, float step, std::vector<std::vector<uint8_t>> &out, int nb_threads,
+                ThreadPool::Priority priority)
+    {
+        out.resize(chunks.size());
+        parallel::forEach(chunks.size(), [&](size_t i) {
+            out[i].clear();
+            encode(chunks[i]->points.data(), chunks[i]->points.size(), step, out[i]);
+        }, nb_threads, priority);
+    }
+
+    bool decode(const std::vector<std::vector<uint8_t>> &encoded, std::vector<std::vector<MapPoint>> &points, int nb_threads)
+    {
+        points.resize(encoded.size());
+        std::atomic<bool> ok(true);
+        parallel::forEach(encoded.size(), [&](size_t i) {
+            if (!decode(encoded[i].data(), encoded[i].size(), points[i]))
+                ok = false;
+        }, nb_threads);
+        return ok;
+    }
+
+    StreamWriter::~StreamWriter()
+    {
+        close();
+    }
+
+    bool StreamWriter::open(const std::string &path, const StreamInfo &info)
+    {
+        close();
+        file_ = fopen(path.c_str(), "wb");
+        if (!file_)
+        {
+            std::cout << "[Sample][Error] Unable to create " << path << std::endl;
+            return false;
+        }
+        info_ = info;
+        info_.cameraModels.resize(info.nbSources, 0);
+        FileHeader header;
+        header.magic = FILE_MAGIC;
+        header.version = FILE_VERSION;
+        header.nbSources = (uint32_t)info.nbSources;
+        header.unitsPerMeter = info.unitsPerMeter;
+        header.mapResolution = info.mapResolution;
+        header.step = info.step;
+        ok_ = fwrite(&header, sizeof(header), 1, file_) == 1 &&
+              fwrite(info_.cameraModels.data(), sizeof(int32_t), info_.cameraModels.size(), file_) == info_.cameraModels.size();
+        size_ = sizeof(header) + info_.cameraModels.size() * sizeof(int32_t);
+        nbPoints_ = 0;
+        return ok_;
+    }
+
+    bool StreamWriter::write(int source, int index, const MapPoint *points, size_t nb_points)
+    {
+        if (!file_)
+            return false;
+        sources_.push_back(source);
+        indices_.push_back(index);
+        pending_.emplace_back();
+        pending_.back().points.assign(points, points + nb_points);
+        pendingPoints_ += nb_points;
+        // Batches large enough to keep every core busy
+        if (pendingPoints_ >= (1 << 22) || pending_.size() >= 1024)
+            return flush();
+        return ok_;
+    }
+
+    bool StreamWriter::flush()
+    {
+        std::vector<const ChunkData *> chunks;
+        for (const auto &it : pending_)
+            chunks.push_back(&it);
+        std::vector<std::vector<uint8_t>> encoded;
+        encode(chunks, info_.step, encoded, 0, ThreadPool::LOW);
+        for (size_t i = 0; i < encoded.size() && ok_; i++)
+        {
+            const RecordHeader record = {sources_[i], indices_[i], (uint32_t)encoded[i].size()};
+            ok_ = fwrite(&record, sizeof(record), 1, file_) == 1 && fwrite(encoded[i].data(), 1, encoded[i].size(), file_) == encoded[i].size();
+            size_ += sizeof(record) + encoded[i].size();
+            nbPoints_ += pending_[i].points.size();
+        }
+        sources_.clear();
+        indices_.clear();
+        pending_.clear();
+        pendingPoints_ = 0;
+        return ok_;
+    }
+
+    bool StreamWriter::close()
+    {
+        if (!file_)
+            return ok_;
+        flush();
+        ok_ &= fclose(file_) == 0;
+        file_ = nullptr;
+        return ok_;
+    }
+
+    StreamReader::~StreamReader()
+    {
+        close();
+    }
+
+    bool StreamReader::open(const std::string &path)
+    {
+        close();
+        file_ = fopen(path.c_str(), "rb");
+        if (!file_)
+        {
+            std::cout << "[Sample][Error] Unable to open " << path << std::endl;
+            return false;
+        }
+        FileHeader header;
+        ok_ = fread(&header, sizeof(header), 1, file_) == 1 && header.magic == FILE_MAGIC && header.version == FILE_VERSION &&
+              header.nbSources > 0 && header.nbSources < 1024;
+        if (ok_)
+        {
+            info_.nbSources = (int)header.nbSources;
+            info_.unitsPerMeter = header.unitsPerMeter;
+            info_.mapResolution = header.mapResolution;
+            info_.step = header.step;
+            info_.cameraModels.resize(header.nbSources);
+            ok_ = fread(info_.cameraModels.data(), sizeof(int32_t), header.nbSources, file_) == header.nbSources;
+        }
+        if (!ok_)
+        {
+            std::cout << "[Sample][Error] " << path << " is not a map recording" << std::endl;
+            close();
+        }
+        return ok_;
+    }
+
+    size_t StreamReader::read(const ChunkCallback &f, size_t max_points)
+    {
+        if (!file_ || !ok_)
+            return 0;
+        std::vector<RecordHeader> records;
+        std::vector<std::vector<uint8_t>> encoded;
+        size_t nb_points = 0;
+        RecordHeader record;
+        while (nb_points < max_points && fread(&record, sizeof(record), 1, file_) == 1)
+        {
+            // Same limits as the map stream, the index sizes the chunk table of the store
+            if (record.source < 0 || record.source >= info_.nbSources || record.index < 0 || record.index > map_protocol::MAX_CHUNK_INDEX ||
+                record.size < sizeof(EncodedHeader) || record.size > map_protocol::MAX_MESSAGE_SIZE)
+            {
+                ok_ = false;
+                break;
+            }
+            encoded.emplace_back(record.size);
+            if (fread(encoded.back().data(), 1, record.size, file_) != record.size)
+            {
+                ok_ = false;
+                break;
+            }
+            records.push_back(record);
+            uint32_t n;
+            memcpy(&n, encoded.back().data(), sizeof(n));
+            nb_points += n;
+        }
+        if (!ok_)
+            encoded.resize(records.size());
+        else if (!feof(file_) && ferror(file_))
+            ok_ = false;
+
+        std::vector<std::vector<MapPoint>> points;
+        if (!decode(encoded, points))
+        {
+            ok_ = false;
+            return 0;
+        }
+        for (size_t i = 0; i < records.size(); i++)
+            f(records[i].source, records[i].index, points[i]);
+        return records.size();
+    }
+
+    void StreamReader::close()
+    {
+        if (file_)
+            fclose(file_);
+        file_ = nullptr;
+    }
+
+    bool saveStore(ChunkStore &store, const std::string &path, const StreamInfo &info, const ChunkBounds *box)
+    {
+        StreamWriter writer;
+        if (!writer.open(path, info))
+            return false;
+        std::vector<MapPoint> inside;
+        auto write = [&](int source, int index, const ChunkData &data) {
+            if (!box)
+            {
+                writer.write(source, index, data.points.data(), data.points.size());
+                return;
+            }
+            inside.resize(data.points.size());
+            const size_t n = parallel::compact(data.points.data(), data.points.size(), inside.data(), [box](const MapPoint &p) {
+                return p.x >= box->min[0] && p.x <= box->max[0] && p.y >= box->min[1] && p.y <= box->max[1] && p.z >= box->min[2] &&
+                       p.z <= box->max[2];
+            });
+            if (n)
+                writer.write(source, index, inside.data(), n);
+        };
+        if (box)
+            store.queryBox(*box, write);
+        else
+            store.forEach(write);
+        if (!writer.close())
+            return false;
+        const size_t nb_points = writer.getNbPoints();
+        std::cout << "[Sample] Map recorded: " << nb_points << " points, " << (writer.getSize() >> 10) << " KB ("
+                  << (nb_points ? writer.getSize() * 1. / nb_points : 0.) << " bytes per point)" << std::endl;
+        return true;
+    }
+}
@@ -0,0 +1,297 @@
+#include "chunk_octree.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+    void boxCenterExtent(const ChunkBounds &b, float *center, float &extent)
+    {
+        extent = 0.f;
+        for (int i = 0; i < 3; i++)
+        {
+            center[i] = (b.min[i] + b.max[i]) * 0.5f;
+            extent = std::max(extent, (b.max[i] - b.min[i]) * 0.5f);
+        }
+    }
+
+    /// Loose cube of a node
+    ChunkBounds looseBounds(const OctreeNode &node)
+    {
+        ChunkBounds b;
+        for (int i = 0; i < 3; i++)
+        {
+            b.min[i] = node.center[i] - 2.f * node.half;
+            b.max[i] = node.center[i] + 2.f * node.half;
+        }
+        return b;
+    }
+
+    bool overlaps(const ChunkBounds &a, const ChunkBounds &b)
+    {
+        for (int i = 0; i < 3; i++)
+            if (a.max[i] < b.min[i] || b.max[i] < a.min[i])
+                return false;
+        return true;
+    }
+
+    bool isFinite(const ChunkBounds &b)
+    {
+        for (int i = 0; i < 3; i++)
+            if (!std::isfinite(b.min[i]) || !std::isfinite(b.max[i]))
+                return false;
+        return true;
+    }
+
+    int octant(const OctreeNode &node, const float *p)
+    {
+        return (p[0] >= node.center[0] ? 1 : 0) | (p[1] >= node.center[1] ? 2 : 0) | (p[2] >= node.center[2] ? 4 : 0);
+    }
+}
+
+ChunkOctree::ChunkOctree(float min_half) : minHalf_(min_half) {}
+
+void ChunkOctree::update(int source, int index, const ChunkBounds &bounds)
+{
+    // The root would grow forever to contain a NaN or infinite box
+    if (!isFinite(bounds))
+    {
+        remove(source, index);
+        return;
+    }
+    auto ts_start = std::chrono::steady_clock::now();
+
+    float center[3], extent;
+    boxCenterExtent(bounds, center, extent);
+    grow(center, extent);
+    const int32_t node = findNode(center, extent);
+
+    int32_t item;
+    auto it = itemOf_.find(key(source, index));
+    if (it == itemOf_.end())
+    {
+        if (freeItems_.empty())
+        {
+            item = (int32_t)items_.size();
+            items_.push_back(Item());
+        }
+        else
+        {
+            item = freeItems_.back();
+            freeItems_.pop_back();
+        }
+        itemOf_[key(source, index)] = item;
+        items_[item].source = source;
+        items_[item].index = index;
+        items_[item].node = -1;
+    }
+    else
+        item = it->second;
+
+    items_[item].bounds = bounds;
+    if (items_[item].node != node)
+    {
+        if (items_[item].node >= 0)
+            unlink(item);
+        link(item, node);
+    }
+
+    nbUpdates_++;
+    updateNs_ += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - ts_start).count();
+}
+
+void ChunkOctree::remove(int source, int index)
+{
+    auto it = itemOf_.find(key(source, index));
+    if (it == itemOf_.end())
+        return;
+    unlink(it->second);
+    freeItems_.push_back(it->second);
+    itemOf_.erase(it);
+}
+
+int32_t ChunkOctree::allocNode(const float *center, float half, int32_t parent, uint32_t level)
+{
+    OctreeNode node;
+    std::copy(center, center + 3, node.center);
+    node.half = half;
+    std::fill(node.children, node.children + 8, -1);
+    node.firstItem = -1;
+    node.parent = parent;
+    node.nbItems = 0;
+    node.level = level;
+    nodes_.push_back(node);
+    return (int32_t)nodes_.size() - 1;
+}
+
+void ChunkOctree::grow(const float *center, float extent)
+{
+    if (root_ < 0)
+    {
+        // Smallest root able to hold the first chunk
+        float half = minHalf_;
+        uint32_t level = 0;
+        while (half * 2.f < extent)
+        {
+            half *= 2.f;
+            level++;
+        }
+        root_ = allocNode(center, half, -1, level);
+        minLevel_ = level;
+        return;
+    }
+
+    for (;;)
+    {
+        // The center must be in the cube of the root so that it stays in the cube of the octants when descending
+        const OctreeNode &root = nodes_[root_];
+        bool contained = true;
+        for (int i = 0; i < 3; i++)
+        {
+            const float d = std::fabs(center[i] - root.center[i]);
+            contained &= d <= root.half && d + extent <= 2.f * root.half;
+        }
+        if (contained)
+            return;
+
+        // The old root becomes the octant of a twice larger root, extended towards the box
+        float new_center[3];
+        for (int i = 0; i < 3; i++)
+            new_center[i] = root.center[i] + (center[i] >= root.center[i] ? root.half : -root.half);
+        const int32_t old_root = root_;
+        root_ = allocNode(new_center, nodes_[old_root].half * 2.f, -1, nodes_[old_root].level + 1);
+        nodes_[old_root].parent = root_;
+        nodes_[root_].children[octant(nodes_[root_], nodes_[old_root].center)] = old_root;
+        nodes_[root_].nbItems = nodes_[old_root].nbItems;
+    }
+}
+
+int32_t ChunkOctree::findNode(const float *center, float extent)
+{
+    int32_t node = root_;
+    // A child of half size h/2 holds the boxes of its octant up to an extent of h/2
+    while (nodes_[node].half * 0.5f >= extent && nodes_[node].half * 0.5f >= minHalf_)
+    {
+        const int o = octant(nodes_[node], center);
+        if (nodes_[node].children[o] < 0)
+        {
+            const float half = nodes_[node].half * 0.5f;
+            float child_center[3];
+            for (int i = 0; i < 3; i++)
+                child_center[i] = nodes_[node].center[i] + ((o >> i) & 1 ? half : -half);
+            const uint32_t level = nodes_[node].level - 1;
+            // nodes_ may be reallocated
+            const int32_t child = allocNode(child_center, half, node, level);
+            nodes_[node].children[o] = child;
+            minLevel_ = std::min(minLevel_, level);
+        }
+        node = nodes_[node].children[o];
+    }
+    return node;
+}
+
+void ChunkOctree::link(int32_t item, int32_t node)
+{
+    items_[item].node = node;
+    items_[item].next = nodes_[node].firstItem;
+    nodes_[node].firstItem = item;
+    for (int32_t n = node; n >= 0; n = nodes_[n].parent)
+        nodes_[n].nbItems++;
+}
+
+void ChunkOctree::unlink(int32_t item)
+{
+    const int32_t node = items_[item].node;
+    // Lists are short, a chunk only shares its node with its neighbours
+    int32_t *link = &nodes_[node].firstItem;
+    while (*link != item)
+        link = &items_[*link].next;
+    *link = items_[item].next;
+    items_[item].node = -1;
+    for (int32_t n = node; n >= 0; n = nodes_[n].parent)
+        nodes_[n].nbItems--;
+}
+
+void ChunkOctree::queryFrustum(const Frustum &frustum, const std::function<void(int, int, bool)> &f) const
+{
+    auto ts_start = std::chrono::steady_clock::now();
+    if (root_ >= 0)
+        queryFrustum(root_, false, frustum, f);
+    nbQueries_++;
+    queryNs_ += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - ts_start).count();
+}
+
+void ChunkOctree::queryFrustum(int32_t node_id, bool inside, const Frustum &frustum, const std::function<void(int, int, bool)> &f) const
+{
+    const OctreeNode &node = nodes_[node_id];
+    if (!node.nbItems)
+        return;
+    nbNodesVisited_++;
+    // Below a node entirely in the frustum, nothing needs to be tested
+    if (!inside)
+    {
+        const Frustum::Side side = frustum.classify(looseBounds(node));
+        if (side == Frustum::OUTSIDE)
+            return;
+        inside = side == Frustum::INSIDE;
+    }
+
+    for (int32_t item = node.firstItem; item >= 0; item = items_[item].next)
+    {
+        const Item &it = items_[item];
+        if (inside)
+            f(it.source, it.index, true);
+        else
+        {
+            const Frustum::Side side = frustum.classify(it.bounds);
+            if (side != Frustum::OUTSIDE)
+                f(it.source, it.index, side == Frustum::INSIDE);
+        }
+    }
+    for (int32_t child : node.children)
+        if (child >= 0)
+            queryFrustum(child, inside, frustum, f);
+}
+
+void ChunkOctree::queryBox(const ChunkBounds &box, const std::function<void(int, int)> &f) const
+{
+    auto ts_start = std::chrono::steady_clock::now();
+    std::vector<int32_t> stack;
+    if (root_ >= 0)
+        stack.push_back(root_);
+    while (!stack.empty())
+    {
+        const OctreeNode &node = nodes_[stack.back()];
+        stack.pop_back();
+        if (!node.nbItems || !overlaps(looseBounds(node), box))
+            continue;
+        nbNodesVisited_++;
+        for (int32_t item = node.firstItem; item >= 0; item = items_[item].next)
+            if (overlaps(items_[item].bounds, box))
+                f(items_[item].source, items_[item].index);
+        for (int32_t child : node.children)
+            if (child >= 0)
+                stack.push_back(child);
+    }
+    nbQueries_++;
+    queryNs_ += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - ts_start).count();
+}
+
+uint32_t ChunkOctree::getDepth() const
+{
+    return root_ < 0 ? 0 : nodes_[root_].level - minLevel_ + 1;
+}
+
+void ChunkOctree::report(const std::string &name) const
+{
+    if (!nbUpdates_)
+        return;
+    std::cout << "[Sample] " << name << " octree: " << getNbItems() << " chunks, " << getNbNodes() << " nodes ("
+              << ((getNbNodes() * sizeof(OctreeNode)) >> 10) << " KB), depth " << getDepth() << " | "
+              << updateNs_ / nbUpdates_ / 1000. << " us per update";
+    if (nbQueries_)
+        std::cout << ", " << queryNs_ / nbQueries_ / 1000. << " us and " << (double)nbNodesVisited_ / nbQueries_ << " nodes per query";
+    std::cout << std::endl;
+}
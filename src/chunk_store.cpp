@@ -0,0 +1,582 @@
+#include "chunk_store.h"
+#include "alloc_counter.h"
+#include "morton_order.h"
+#include "parallel_primitives.h"
+#include "scratch_arena.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#if defined(_WIN32)
+#define fseek64 _fseeki64
+#else
+#define fseek64 fseeko
+#endif
+
+namespace
+{
+    /// Updates with more points are sorted on all the cores
+    const size_t PARALLEL_SORT_POINTS = 1 << 18;
+
+    /// Copy of the points and their bounds, in Morton order if cell_size > 0
+    /// @param data : retired content to reuse, allocated if null or much larger than needed
+    std::shared_ptr<ChunkData> copyChunk(const MapPoint *points, size_t nb_points, float cell_size, std::shared_ptr<ChunkData> data)
+    {
+        if (!data || data->points.capacity() > 2 * nb_points + 1024)
+            data = std::make_shared<ChunkData>();
+        ChunkBounds &b = data->bounds;
+        std::fill(b.min, b.min + 3, INFINITY);
+        std::fill(b.max, b.max + 3, -INFINITY);
+        for (size_t i = 0; i < nb_points; i++)
+        {
+            const MapPoint &p = points[i];
+            // Bounds of the finite points only, a NaN would make them NaN (the octree cannot place them)
+            if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z))
+                continue;
+            b.min[0] = std::min(b.min[0], p.x);
+            b.max[0] = std::max(b.max[0], p.x);
+            b.min[1] = std::min(b.min[1], p.y);
+            b.max[1] = std::max(b.max[1], p.y);
+            b.min[2] = std::min(b.min[2], p.z);
+            b.max[2] = std::max(b.max[2], p.z);
+        }
+        if (b.min[0] > b.max[0])
+        {
+            // Empty, or no finite point
+            std::fill(b.min, b.min + 3, 0.f);
+            std::fill(b.max, b.max + 3, 0.f);
+        }
+        if (nb_points == 0)
+        {
+            data->points.clear();
+            return data;
+        }
+
+        if (cell_size <= 0.f || nb_points < 2)
+        {
+            data->points.assign(points, points + nb_points);
+            return data;
+        }
+        // Larger cells for the chunks which do not fit in the 21 bits per axis of the codes
+        const float extent = std::max(std::max(b.max[0] - b.min[0], b.max[1] - b.min[1]), b.max[2] - b.min[2]);
+        cell_size = std::max(cell_size, extent / (float)(morton::MAX_CELLS - 1));
+        ScratchScope scope;
+        uint32_t *order = scope.getArena().allocate<uint32_t>(nb_points);
+        morton::sortOrder(points, nb_points, b.min, cell_size, order);
+        data->points.resize(nb_points);
+        MapPoint *dst = data->points.data();
+        for (size_t i = 0; i < nb_points; i++)
+            dst[i] = points[order[i]];
+        scope.getArena().deallocate(order, nb_points * sizeof(uint32_t));
+        return data;
+    }
+
+    float squaredDistance(const ChunkBounds &b, const float *p)
+    {
+        float d2 = 0.f;
+        for (int i = 0; i < 3; i++)
+        {
+            const float d = std::max(std::max(b.min[i] - p[i], p[i] - b.max[i]), 0.f);
+            d2 += d * d;
+        }
+        return d2;
+    }
+
+    /// Hand the retired contents nobody references anymore to the chunks of an update, the smallest
+    /// ones first so that each chunk gets a buffer large enough. The others are released.
+    void reuseRetired(std::vector<std::shared_ptr<ChunkData>> &retired, const std::vector<ChunkInput> &chunks, std::shared_ptr<ChunkData> *reused)
+    {
+        ScratchVector<std::shared_ptr<ChunkData>> free;
+        free.reserve(retired.size());
+        for (auto &it : retired)
+            if (it.use_count() == 1)
+            {
+                // Out of the chunks, no new reference can be taken: pairs with the release of the
+                // last reader's reference, its reads are done
+                std::atomic_thread_fence(std::memory_order_acquire);
+                free.push_back(std::move(it));
+            }
+        retired.clear();
+        if (free.empty())
+            return;
+
+        ScratchVector<uint32_t> order(chunks.size());
+        for (size_t i = 0; i < order.size(); i++)
+            order[i] = (uint32_t)i;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return chunks[a].nb_points < chunks[b].nb_points; });
+        std::sort(free.begin(), free.end(), [](const std::shared_ptr<ChunkData> &a, const std::shared_ptr<ChunkData> &b) { return a->points.capacity() < b->points.capacity(); });
+        size_t j = 0;
+        for (uint32_t i : order)
+        {
+            while (j < free.size() && free[j]->points.capacity() < chunks[i].nb_points)
+                j++;
+            if (j == free.size())
+                break;
+            reused[i] = std::move(free[j++]);
+        }
+    }
+}
+
+ChunkStore::ChunkStore(int nb_sources, float min_node_size) : version_(0), index_(min_node_size * 0.5f)
+{
+    for (int i = 0; i < nb_sources; i++)
+        sources_.emplace_back(new Source());
+}
+
+ChunkStore::~ChunkStore()
+{
+    if (pagingThread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(pagingMtx_);
+            stopPaging_ = true;
+        }
+        pagingCv_.notify_one();
+        pagingThread_.join();
+    }
+    for (auto &it : sources_)
+        if (it->file)
+            fclose(it->file);
+}
+
+bool ChunkStore::startPaging(const PagingParameters &params)
+{
+    if (params.directory.empty() || pagingThread_.joinable())
+        return false;
+    for (int source = 0; source < (int)sources_.size(); source++)
+    {
+        const std::string path = params.directory + "/chunks_" + std::to_string(source) + ".bin";
+        sources_[source]->file = fopen(path.c_str(), "w+b");
+        if (!sources_[source]->file)
+        {
+            std::cout << "[Sample][Error] Unable to create the page file " << path << std::endl;
+            return false;
+        }
+    }
+    paging_ = params;
+    pagingThread_ = std::thread(&ChunkStore::pagingLoop, this);
+    std::cout << "[Sample] Paging map chunks to " << params.directory << std::endl;
+    return true;
+}
+
+void ChunkStore::update(int source, const std::vector<ChunkInput> &chunks)
+{
+    auto ts_start = std::chrono::steady_clock::now();
+    const unsigned long long allocations_start = alloc_counter::getThreadCount();
+
+    // Copy (and sort) outside the lock, readers are only blocked by the pointer swaps below.
+    // The temporaries are scratch memory and the copies reuse retired contents, so an update in a
+    // steady state does not allocate
+    Source &s = *sources_[source];
+    ScratchScope scope;
+    ScratchVector<std::shared_ptr<const ChunkData>> copies(chunks.size());
+    ScratchVector<ChunkBounds> copies_bounds(chunks.size());
+    ScratchVector<std::shared_ptr<ChunkData>> reused(chunks.size());
+    reuseRetired(s.retired, chunks, reused.data());
+    size_t nb_points = 0;
+    for (const auto &it : chunks)
+        nb_points += it.nb_points;
+    const float cell_size = mortonCell_;
+    if (cell_size > 0.f && chunks.size() > 1 && nb_points >= PARALLEL_SORT_POINTS)
+    {
+        // Large updates (first map, relocalization): the chunks are sorted on all the cores
+        parallel::forEach(chunks.size(), [&](size_t i) { copies[i] = copyChunk(chunks[i].points, chunks[i].nb_points, cell_size, std::move(reused[i])); });
+    }
+    else
+    {
+        for (size_t i = 0; i < chunks.size(); i++)
+            copies[i] = copyChunk(chunks[i].points, chunks[i].nb_points, cell_size, std::move(reused[i]));
+    }
+    for (size_t i = 0; i < chunks.size(); i++)
+        copies_bounds[i] = copies[i]->bounds;
+
+    auto ts_lock = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(s.mtx);
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            const int index = chunks[i].index;
+            if (index >= (int)s.chunks.size())
+            {
+                s.chunks.resize(index + 1);
+                for (auto &it : s.updates)
+                    it.isDirty.resize(index + 1, false);
+            }
+            Chunk &chunk = s.chunks[index];
+            if (!chunk.data && chunk.file_valid)
+                s.paged_points -= chunk.nb_points;
+            // The previous content is released with copies, after the lock
+            std::swap(chunk.data, copies[i]);
+            chunk.nb_points = chunks[i].nb_points;
+            chunk.bounds = chunk.data->bounds;
+            chunk.last_used = ts_lock;
+            chunk.file_valid = false;
+            for (auto &it : s.updates)
+                if (!it.isDirty[index])
+                {
+                    it.isDirty[index] = true;
+                    it.dirty.push_back(index);
+                    chunk.nb_dirty++;
+                }
+        }
+
+        auto ts_end = std::chrono::steady_clock::now();
+        s.nb_merges++;
+        s.nb_chunks += chunks.size();
+        s.nb_points += nb_points;
+        s.merge_ms += std::chrono::duration<double, std::milli>(ts_end - ts_start).count();
+        s.lock_ms += std::chrono::duration<double, std::milli>(ts_end - ts_lock).count();
+    }
+    {
+        // Separate lock, the sources only contend with each other for the index
+        std::lock_guard<std::mutex> lock(indexMtx_);
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            if (chunks[i].nb_points)
+                index_.update(source, chunks[i].index, copies_bounds[i]);
+            else
+                index_.remove(source, chunks[i].index);
+        }
+    }
+    version_.fetch_add(1, std::memory_order_release);
+
+    // The consumers still hold the previous contents in their queues, they are checked at the next update
+    s.retired.clear();
+    for (size_t i = 0; i < chunks.size(); i++)
+        if (copies[i])
+            s.retired.push_back(std::const_pointer_cast<ChunkData>(std::move(copies[i])));
+
+    // Counted after the index update
+    const unsigned long long nb_allocations = alloc_counter::getThreadCount() - allocations_start;
+    std::lock_guard<std::mutex> lock(s.mtx);
+    s.nb_allocations += nb_allocations;
+}
+
+void ChunkStore::setPosition(int source, float x, float y, float z)
+{
+    const Position position = {{x, y, z}};
+    sources_[source]->position.store(position);
+}
+
+int ChunkStore::addConsumer()
+{
+    for (auto &it : sources_)
+    {
+        std::lock_guard<std::mutex> lock(it->mtx);
+        it->updates.emplace_back();
+        it->updates.back().isDirty.resize(it->chunks.size(), false);
+    }
+    return nbConsumers_++;
+}
+
+size_t ChunkStore::consumeUpdates(int consumer, const std::function<void(const ChunkUpdate &)> &f)
+{
+    size_t nb_updates = 0;
+    ScratchScope scope;
+    ScratchVector<ChunkUpdate> updates;
+    for (int source = 0; source < (int)sources_.size(); source++)
+    {
+        Source &s = *sources_[source];
+        updates.clear();
+        {
+            std::lock_guard<std::mutex> lock(s.mtx);
+            // Dirty chunks are never paged out
+            Updates &it = s.updates[consumer];
+            for (int index : it.dirty)
+            {
+                updates.push_back({source, index, s.chunks[index].data});
+                it.isDirty[index] = false;
+                s.chunks[index].nb_dirty--;
+            }
+            it.dirty.clear();
+        }
+        // f may be slow (GPU upload), it runs without the lock
+        for (const auto &it : updates)
+            f(it);
+        nb_updates += updates.size();
+    }
+    return nb_updates;
+}
+
+std::shared_ptr<const ChunkData> ChunkStore::get(int source, int index, bool keep)
+{
+    return fetch(source, index, keep);
+}
+
+int ChunkStore::getNbChunks(int source) const
+{
+    std::lock_guard<std::mutex> lock(sources_[source]->mtx);
+    return (int)sources_[source]->chunks.size();
+}
+
+std::shared_ptr<const ChunkData> ChunkStore::fetch(int source, int index, bool keep)
+{
+    Source &s = *sources_[source];
+    for (;;)
+    {
+        long long offset;
+        size_t nb_points;
+        unsigned generation;
+        {
+            std::lock_guard<std::mutex> lock(s.mtx);
+            if (index >= (int)s.chunks.size())
+                return nullptr;
+            Chunk &chunk = s.chunks[index];
+            if (chunk.data || !chunk.file_valid)
+            {
+                chunk.last_used = std::chrono::steady_clock::now();
+                return chunk.data;
+            }
+            offset = chunk.file_offset;
+            nb_points = chunk.nb_points;
+            generation = chunk.file_generation;
+        }
+
+        auto data = std::make_shared<ChunkData>();
+        data->points.resize(nb_points);
+        {
+            std::lock_guard<std::mutex> lock(s.file_mtx);
+            if (fseek64(s.file, offset * sizeof(MapPoint), SEEK_SET) != 0 ||
+                fread(data->points.data(), sizeof(MapPoint), nb_points, s.file) != nb_points)
+            {
+                std::cout << "[Sample][Error] Unable to read chunk " << index << " of source " << source << " from its page file" << std::endl;
+                return nullptr;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(s.mtx);
+        Chunk &chunk = s.chunks[index];
+        // Updated in the meantime, the new content is in memory
+        if (chunk.data || !chunk.file_valid)
+            return chunk.data;
+        // Updated and paged out again, the read may mix both contents: read the new one
+        if (chunk.file_generation != generation)
+            continue;
+        data->bounds = chunk.bounds;
+        s.nb_page_ins++;
+        if (keep)
+        {
+            // The file keeps a valid copy, paging it out again costs nothing
+            chunk.data = data;
+            chunk.last_used = std::chrono::steady_clock::now();
+            s.paged_points -= chunk.nb_points;
+        }
+        return data;
+    }
+}
+
+void ChunkStore::forEach(const std::function<void(int source, int index, const ChunkData &data)> &f)
+{
+    for (int source = 0; source < (int)sources_.size(); source++)
+    {
+        const int nb_chunks = getNbChunks(source);
+        for (int index = 0; index < nb_chunks; index++)
+        {
+            auto data = fetch(source, index, false);
+            if (data)
+                f(source, index, *data);
+        }
+    }
+}
+
+void ChunkStore::queryBox(const ChunkBounds &box, const std::function<void(int source, int index, const ChunkData &data)> &f)
+{
+    // Keys (source, index), sorted to read in the order of the page files
+    std::vector<uint64_t> found;
+    {
+        std::lock_guard<std::mutex> lock(indexMtx_);
+        index_.queryBox(box, [&](int source, int index) { found.push_back((uint64_t)source << 32 | (uint32_t)index); });
+    }
+    parallel::radixSort(found.data(), (uint32_t *)nullptr, found.size());
+    for (uint64_t key : found)
+    {
+        const int source = (int)(key >> 32), index = (int)(uint32_t)key;
+        auto data = fetch(source, index, false);
+        if (data)
+            f(source, index, *data);
+    }
+}
+
+size_t ChunkStore::getNbPoints() const
+{
+    size_t nb_points = 0;
+    for (const auto &s : sources_)
+    {
+        std::lock_guard<std::mutex> lock(s->mtx);
+        for (const auto &it : s->chunks)
+            nb_points += it.nb_points;
+    }
+    return nb_points;
+}
+
+bool ChunkStore::savePLY(const std::string &path, const ChunkBounds *box)
+{
+    auto inside = [box](const MapPoint &p) {
+        return p.x >= box->min[0] && p.x <= box->max[0] && p.y >= box->min[1] && p.y <= box->max[1] && p.z >= box->min[2] &&
+               p.z <= box->max[2];
+    };
+    // The header needs the number of points, counted with a first pass over the chunks in the box
+    size_t nb_points = 0;
+    if (box)
+        queryBox(*box, [&](int, int, const ChunkData &data) { nb_points += std::count_if(data.points.begin(), data.points.end(), inside); });
+    else
+        nb_points = getNbPoints();
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+    fprintf(file, "ply\nformat binary_little_endian 1.0\nelement vertex %zu\n"
+                  "property float x\nproperty float y\nproperty float z\n"
+                  "property uchar red\nproperty uchar green\nproperty uchar blue\nend_header\n",
+            nb_points);
+    bool ok = true;
+    size_t nb_written = 0;
+    std::vector<unsigned char> buffer;
+    std::vector<MapPoint> kept;
+    auto write = [&](int, int, const ChunkData &data) {
+        const MapPoint *points = data.points.data();
+        size_t n = data.points.size();
+        if (box)
+        {
+            kept.resize(n);
+            n = parallel::compact(points, n, kept.data(), inside);
+            points = kept.data();
+        }
+        // 15 bytes per vertex, no padding
+        buffer.resize(n * 15);
+        unsigned char *out = buffer.data();
+        for (size_t i = 0; i < n; i++)
+        {
+            const MapPoint &p = points[i];
+            memcpy(out, &p.x, 3 * sizeof(float));
+            out[12] = (unsigned char)(p.color >> 16);
+            out[13] = (unsigned char)(p.color >> 8);
+            out[14] = (unsigned char)p.color;
+            out += 15;
+        }
+        const size_t size = out - buffer.data();
+        ok &= fwrite(buffer.data(), 1, size, file) == size;
+        nb_written += size / 15;
+    };
+    if (box)
+        queryBox(*box, write);
+    else
+        forEach(write);
+    // Chunks merged between the two passes would not match the header
+    ok &= nb_written == nb_points;
+    ok &= fclose(file) == 0;
+    return ok;
+}
+
+void ChunkStore::pagingLoop()
+{
+    // Candidates are checked several times per paging delay
+    const auto period = std::chrono::duration<double>(std::max(paging_.after * 0.25f, 0.1f));
+    std::unique_lock<std::mutex> lock(pagingMtx_);
+    while (!pagingCv_.wait_for(lock, period, [this] { return stopPaging_; }))
+    {
+        lock.unlock();
+        for (auto &it : sources_)
+            pageOut(*it);
+        lock.lock();
+    }
+}
+
+void ChunkStore::pageOut(Source &s)
+{
+    struct Candidate
+    {
+        int index;
+        std::shared_ptr<const ChunkData> data;
+        long long offset;
+    };
+
+    Position position = {{0.f, 0.f, 0.f}};
+    s.position.load(position);
+    const auto now = std::chrono::steady_clock::now();
+    const auto after = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(paging_.after));
+    const float distance2 = paging_.distance * paging_.distance;
+
+    std::vector<Candidate> candidates;
+    {
+        std::lock_guard<std::mutex> lock(s.mtx);
+        for (int index = 0; index < (int)s.chunks.size(); index++)
+        {
+            Chunk &chunk = s.chunks[index];
+            if (!chunk.data || chunk.nb_dirty || now - chunk.last_used < after || squaredDistance(chunk.bounds, position.xyz) < distance2)
+                continue;
+            if (chunk.file_valid)
+            {
+                // Read back without modification, the file is up to date
+                chunk.data.reset();
+                s.paged_points += chunk.nb_points;
+                s.nb_page_outs++;
+                continue;
+            }
+            // Reuse the slot of the chunk when the new content fits
+            long long offset = chunk.file_offset;
+            if (offset < 0 || chunk.file_capacity < chunk.nb_points)
+            {
+                offset = s.file_end;
+                s.file_end += chunk.nb_points;
+                chunk.file_offset = offset;
+                chunk.file_capacity = chunk.nb_points;
+            }
+            // A page-in reading the slot until now is discarded
+            chunk.file_generation++;
+            candidates.push_back({index, chunk.data, offset});
+        }
+    }
+
+    for (const auto &it : candidates)
+    {
+        {
+            std::lock_guard<std::mutex> lock(s.file_mtx);
+            if (fseek64(s.file, it.offset * sizeof(MapPoint), SEEK_SET) != 0 ||
+                fwrite(it.data->points.data(), sizeof(MapPoint), it.data->points.size(), s.file) != it.data->points.size())
+            {
+                std::cout << "[Sample][Error] Unable to write chunk " << it.index << " to its page file" << std::endl;
+                continue;
+            }
+        }
+        std::lock_guard<std::mutex> lock(s.mtx);
+        Chunk &chunk = s.chunks[it.index];
+        // Updated while it was written, keep the new content
+        if (chunk.data != it.data || chunk.nb_dirty)
+            continue;
+        chunk.data.reset();
+        chunk.file_valid = true;
+        s.paged_points += chunk.nb_points;
+        s.nb_page_outs++;
+    }
+    // Make the writes visible to the reads of the other threads through the same FILE
+    std::lock_guard<std::mutex> lock(s.file_mtx);
+    fflush(s.file);
+}
+
+void ChunkStore::report() const
+{
+    for (int source = 0; source < (int)sources_.size(); source++)
+    {
+        const Source &s = *sources_[source];
+        std::lock_guard<std::mutex> lock(s.mtx);
+        if (!s.nb_merges)
+            continue;
+        std::cout << "[Sample] Source " << source << " merge: " << s.nb_merges << " updates, " << s.nb_chunks << " chunks, "
+                  << s.nb_points << " points, " << s.merge_ms / s.nb_merges << " ms per update ("
+                  << s.lock_ms / s.nb_merges << " ms locked), "
+                  << (s.nb_points ? s.merge_ms * 1000000. / s.nb_points : 0.) << " ns per point" << std::endl;
+        if (alloc_counter::isEnabled())
+            std::cout << "[Sample] Source " << source << " merge: " << (double)s.nb_allocations / s.nb_merges
+                      << " heap allocations per update, " << (s.nb_chunks ? (double)s.nb_allocations / s.nb_chunks : 0.)
+                      << " per chunk" << std::endl;
+        if (s.file)
+            std::cout << "[Sample] Source " << source << " paging: " << s.nb_page_outs << " chunks paged out, " << s.nb_page_ins
+                      << " read back, " << ((s.paged_points * sizeof(MapPoint)) >> 20) << " MB on disk now, page file "
+                      << ((s.file_end * sizeof(MapPoint)) >> 20) << " MB" << std::endl;
+    }
+    std::lock_guard<std::mutex> lock(indexMtx_);
+    index_.report("Store");
+}
@@ -0,0 +1,65 @@
+#include "eye_dome_lighting.h"
+
+EyeDomeLighting::EyeDomeLighting() : strength(1.f), radius(1.4f), vaoID_(0), previousFbo_(0), znear_(0.f), zfar_(1.f) {}
+
+EyeDomeLighting::~EyeDomeLighting()
+{
+    if (vaoID_)
+        glDeleteVertexArrays(1, &vaoID_);
+}
+
+void EyeDomeLighting::init()
+{
+    shader_ = Shader(FULLSCREEN_VERTEX_SHADER, EDL_FRAGMENT_SHADER);
+    const GLuint program = shader_.getProgramId();
+    uColor_ = glGetUniformLocation(program, "u_color");
+    uDepth_ = glGetUniformLocation(program, "u_depth");
+    uPixelSize_ = glGetUniformLocation(program, "u_pixelSize");
+    uZNear_ = glGetUniformLocation(program, "u_zNear");
+    uZFar_ = glGetUniformLocation(program, "u_zFar");
+    uStrength_ = glGetUniformLocation(program, "u_strength");
+    uRadius_ = glGetUniformLocation(program, "u_radius");
+
+    // The full-screen triangle is generated from gl_VertexID, but a vertex array must still be bound
+    glGenVertexArrays(1, &vaoID_);
+}
+
+void EyeDomeLighting::begin(int width, int height, float znear, float zfar)
+{
+    znear_ = znear;
+    zfar_ = zfar;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFbo_);
+
+    scene_.resize(width, height);
+    scene_.bind();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void EyeDomeLighting::end(RenderState &state)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFbo_);
+    glViewport(0, 0, scene_.getWidth(), scene_.getHeight());
+
+    state.useProgram(shader_.getProgramId());
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, scene_.getColorTexture());
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, scene_.getDepthTexture());
+    glUniform1i(uColor_, 0);
+    glUniform1i(uDepth_, 1);
+    glUniform2f(uPixelSize_, 1.f / scene_.getWidth(), 1.f / scene_.getHeight());
+    glUniform1f(uZNear_, znear_);
+    glUniform1f(uZFar_, zfar_);
+    glUniform1f(uStrength_, strength);
+    glUniform1f(uRadius_, radius);
+
+    // The pass writes the scene depth back so that anything drawn afterwards is still depth tested
+    glDepthFunc(GL_ALWAYS);
+    state.bindVertexArray(vaoID_);
+    state.drawArrays(GL_TRIANGLES, 0, 3);
+    glDepthFunc(GL_LESS);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
@@ -0,0 +1,76 @@
+#include "frame_buffer.h"
+
+#include <iostream>
+
+FrameBuffer::FrameBuffer() : fboID_(0), colorTexID_(0), depthTexID_(0), width_(0), height_(0) {}
+
+FrameBuffer::~FrameBuffer()
+{
+    release();
+}
+
+void FrameBuffer::release()
+{
+    if (fboID_)
+    {
+        glDeleteFramebuffers(1, &fboID_);
+        glDeleteTextures(1, &colorTexID_);
+        glDeleteTextures(1, &depthTexID_);
+    }
+    fboID_ = colorTexID_ = depthTexID_ = 0;
+    width_ = height_ = 0;
+}
+
+bool FrameBuffer::resize(int width, int height)
+{
+    if (fboID_ && width == width_ && height == height_)
+        return true;
+
+    release();
+    width_ = width;
+    height_ = height;
+
+    glGenTextures(1, &colorTexID_);
+    glBindTexture(GL_TEXTURE_2D, colorTexID_);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width_, height_, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // Depth is kept in a texture (and not a renderbuffer) so that post-processing passes can sample it
+    glGenTextures(1, &depthTexID_);
+    glBindTexture(GL_TEXTURE_2D, depthTexID_);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width_, height_, 0, GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &fboID_);
+    glBindFramebuffer(GL_FRAMEBUFFER, fboID_);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexID_, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthTexID_, 0);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        std::cout << "ERROR: framebuffer " << width_ << "x" << height_ << " is not complete (" << status << ")" << std::endl;
+        release();
+        return false;
+    }
+    return true;
+}
+
+void FrameBuffer::bind()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, fboID_);
+    glViewport(0, 0, width_, height_);
+}
+
+void FrameBuffer::unbind()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
@@ -1,35 +1,77 @@
 #include "gl_viewer.h"
+#include "zed_model.h"
+
+#include <algorithm>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <GL/wglew.h>
+#elif !defined(__APPLE__)
+#include <GL/glx.h>
+#endif
 
 GLViewer *currentInstance_ = nullptr;
 
+/// Colors of the sources, for their path and the tint of their points
+static const float SOURCE_COLORS[][3] = {{0.1f, 0.5f, 0.9f}, {0.9f, 0.35f, 0.1f}, {0.2f, 0.8f, 0.3f},
+                                         {0.85f, 0.2f, 0.7f}, {0.95f, 0.85f, 0.1f}, {0.1f, 0.85f, 0.85f}};
+static const int NB_SOURCE_COLORS = sizeof(SOURCE_COLORS) / sizeof(SOURCE_COLORS[0]);
+
+static const char *toString(TrackingState state)
+{
+    switch (state)
+    {
+    case TrackingState::SEARCHING:
+        return "SEARCHING";
+    case TrackingState::OK:
+        return "OK";
+    case TrackingState::OFF:
+        return "OFF";
+    case TrackingState::FPS_TOO_LOW:
+        return "FPS TOO LOW";
+    case TrackingState::SEARCHING_FLOOR_PLANE:
+        return "SEARCHING FLOOR PLANE";
+    }
+    return "UNKNOWN";
+}
+
 void CloseFunc(void)
 {
     if (currentInstance_)
         currentInstance_->exit();
 }
 
-void fillZED(int nb_tri, float *vertices, int *triangles, sl::float3 color, Simple3DObject *zed_camera)
+namespace
 {
-    for (int p = 0; p < nb_tri * 3; p = p + 3)
-    {
-        int index = triangles[p] - 1;
-        zed_camera->addPoint(sl::float3(vertices[index * 3], vertices[index * 3 + 1], vertices[index * 3 + 2]) * 1000, sl::float3(color.r, color.g, color.b));
-        index = triangles[p + 1] - 1;
-        zed_camera->addPoint(sl::float3(vertices[index * 3], vertices[index * 3 + 1], vertices[index * 3 + 2]) * 1000, sl::float3(color.r, color.g, color.b));
-        index = triangles[p + 2] - 1;
-        zed_camera->addPoint(sl::float3(vertices[index * 3], vertices[index * 3 + 1], vertices[index * 3 + 2]) * 1000, sl::float3(color.r, color.g, color.b));
-    }
+    /// Longest sleep of waitForFrame(): latency of the inputs and of the new chunks when nothing else happens
+    const std::chrono::milliseconds IDLE_WAIT(16);
 }
 
-GLViewer::GLViewer() : available(false)
+GLViewer::GLViewer() : available(false), needsRedraw_(true)
 {
+    setTargetFPS(30.f);
     currentInstance_ = this;
     mouseButton_[0] = mouseButton_[1] = mouseButton_[2] = false;
     clearInputs();
     previousMouseMotion_[0] = previousMouseMotion_[1] = 0;
 }
 
-GLViewer::~GLViewer() {}
+GLViewer::~GLViewer()
+{
+    if (pointsTimer_.getCount())
+        std::cout << "[Sample] GPU time: points " << pointsTimer_.getAverageMs() << " ms, EDL "
+                  << edlTimer_.getAverageMs() << " ms | CPU draw submission " << drawCpuMs_ << " ms" << std::endl;
+    const GpuChunkCache::Stats &cache = chunkCache_.getStats();
+    if (cache.hits || cache.misses)
+        std::cout << "[Sample] GPU chunk cache: " << cache.hits << " hits, " << cache.misses << " misses, " << cache.evictions
+                  << " evictions, " << cache.updates << " updates, " << (cache.residentBytes >> 20) << " MB resident" << std::endl;
+    chunkCache_.getOctree().report("Viewer");
+    renderState_.report();
+    for (size_t i = 0; i < sources_.size(); i++)
+        if (sources_[i]->droppedPoses)
+            std::cout << "[Sample] Source " << i << ": " << sources_[i]->droppedPoses << " camera path positions dropped, the pose queue ("
+                      << sources_[i]->poseQueue.capacity() << ") was full" << std::endl;
+}
 
 void GLViewer::exit()
 {
@@ -40,13 +82,49 @@ void GLViewer::exit()
 bool GLViewer::isAvailable()
 {
     if (available)
+    {
         glutMainLoopEvent();
+        if (store_ && store_->getVersion() != storeVersion_)
+            needsRedraw_ = true;
+        // A hidden window gets no display event, offscreen frames are rendered at their own pace
+        if (offscreen_.isEnabled())
+        {
+            if (offscreen_.frameDue())
+                render();
+        }
+        else if (needsRedraw_)
+        {
+            // Pace the frames on a fixed schedule rather than "now + interval" so the rate does not drift,
+            // but do not try to catch up when the loop fell behind
+            auto now = std::chrono::steady_clock::now();
+            if (now >= nextFrame_)
+            {
+                nextFrame_ += std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameInterval_);
+                if (nextFrame_ < now)
+                    nextFrame_ = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameInterval_);
+                render();
+            }
+        }
+    }
     return available;
 }
 
-GLenum GLViewer::init(int argc, char **argv,
-                      sl::CameraParameters param,
-                      sl::FusedPointCloud *ptr, sl::MODEL zed_model)
+void GLViewer::waitForFrame()
+{
+    if (!available)
+        return;
+    auto deadline = std::chrono::steady_clock::now() + IDLE_WAIT;
+    if (offscreen_.isEnabled())
+        deadline = std::min(deadline, offscreen_.nextFrameTime());
+    else if (needsRedraw_)
+        deadline = std::min(deadline, nextFrame_);
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    wakeCondition_.wait_until(lock, deadline, [this] { return wake_; });
+    wake_ = false;
+}
+
+GLenum GLViewer::init(int argc, char **argv, ChunkStore *store, const std::vector<CameraModel> &camera_models,
+                      const OffscreenParameters &offscreen)
 {
     glutInit(&argc, argv);
     int wnd_w = glutGet(GLUT_SCREEN_WIDTH);
@@ -60,6 +138,17 @@ GLenum GLViewer::init(int argc, char **argv,
     if (GLEW_OK != err)
         return err;
 
+    if (!offscreen.output.empty())
+    {
+        if (offscreen_.init(offscreen))
+        {
+            glutHideWindow();
+            reshapeCallback(offscreen.width, offscreen.height);
+        }
+        else
+            std::cout << "ERROR: offscreen rendering to " << offscreen.output << " could not be initialized" << std::endl;
+    }
+
     glutSetOption(GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_CONTINUE_EXECUTION);
     glEnable(GL_DEPTH_TEST);
     glEnable(GL_BLEND);
@@ -67,44 +156,49 @@ GLenum GLViewer::init(int argc, char **argv,
     glEnable(GL_LINE_SMOOTH);
     glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
 
-    p_fpc = ptr;
+    store_ = store;
+    if (store_)
+        storeConsumer_ = store_->addConsumer();
 
     // Compile and create the shader
     mainShader.it = Shader(VERTEX_SHADER, FRAGMENT_SHADER);
-    mainShader.MVP_Mat = glGetUniformLocation(mainShader.it.getProgramId(), "u_mvpMatrix");
+    mainShader.Model_Mat = glGetUniformLocation(mainShader.it.getProgramId(), "u_modelMatrix");
+
+    pcf_shader.it = Shader(FPC_VERTEX_SHADER, FPC_FRAGMENT_SHADER);
+    pcf_shader.Model_Mat = -1;
+    tintLoc_ = glGetUniformLocation(pcf_shader.it.getProgramId(), "u_tint");
+    lodScaleLoc_ = glGetUniformLocation(pcf_shader.it.getProgramId(), "u_lodScale");
 
-    pcf_shader.it = Shader(FPC_VERTEX_SHADER, FRAGMENT_SHADER);
-    pcf_shader.MVP_Mat = glGetUniformLocation(pcf_shader.it.getProgramId(), "u_mvpMatrix");
+    renderState_.init();
+    renderState_.registerProgram(mainShader.it.getProgramId());
+    renderState_.registerProgram(pcf_shader.it.getProgramId());
+
+    // Point size is computed per vertex, bounded by what the driver supports
+    glEnable(GL_PROGRAM_POINT_SIZE);
+    GLfloat point_size_range[2];
+    glGetFloatv(GL_ALIASED_POINT_SIZE_RANGE, point_size_range);
+    maxPointSize_ = std::min(point_size_range[1], 32.f);
+
+    edl_.init();
 
     // Create the camera
-    camera_ = CameraGL(sl::Translation(0, 0, 1000), sl::Translation(0, 0, -100));
-    camera_.setOffsetFromPosition(sl::Translation(0, 0, 1500));
+    camera_ = CameraGL(vmath::Translation(0, 0, 1000), vmath::Translation(0, 0, -100));
+    camera_.setOffsetFromPosition(vmath::Translation(0, 0, 1500));
 
     // change background color
-    bckgrnd_clr = sl::float3(37, 42, 44);
-    bckgrnd_clr /= 255.f;
+    bckgrnd_clr = vmath::float3(37, 42, 44) / 255.f;
 
-    zedPath_.setDrawingType(GL_LINE_STRIP);
-    zedModel_.setDrawingType(GL_TRIANGLES);
-    Model3D *model;
-    switch (zed_model)
+    for (size_t i = 0; i < camera_models.size(); i++)
     {
-    case sl::MODEL::ZED:
-        model = new Model3D_ZED();
-        break;
-    case sl::MODEL::ZED2:
-        model = new Model3D_ZED2();
-        break;
-    case sl::MODEL::ZED_M:
-        model = new Model3D_ZED_M();
-        break;
+        sources_.push_back(aligned::makeUnique<SourceView>());
+        SourceView &source = *sources_.back();
+        const float *color = SOURCE_COLORS[i % NB_SOURCE_COLORS];
+        source.color = vmath::float3(color[0], color[1], color[2]);
+        source.path.setDrawingType(GL_LINE_STRIP);
+        source.model.setDrawingType(GL_TRIANGLES);
+        const ZEDModelMesh &mesh = getZEDModelMesh(camera_models[i]);
+        source.model.setMesh(renderState_, mesh.vertices, mesh.nb_vertices, mesh.indices, mesh.nb_indices);
     }
-    for (auto it : model->part)
-        fillZED(it.nb_triangles, model->vertices, it.triangles, it.color, &zedModel_);
-    delete model;
-
-    zedModel_.pushToGPU();
-    updateZEDposition = false;
 
     // Map glut function on this class methods
     glutDisplayFunc(GLViewer::drawCallback);
@@ -117,23 +211,55 @@ GLenum GLViewer::init(int argc, char **argv,
 
     available = true;
 
-    // ready to start
-    chunks_pushed = true;
-
     return err;
 }
 
+void GLViewer::setVSync(bool enable)
+{
+    const int interval = enable ? 1 : 0;
+#if defined(_WIN32)
+    if (WGLEW_EXT_swap_control)
+        wglSwapIntervalEXT(interval);
+#elif !defined(__APPLE__)
+    typedef int (*SwapIntervalFunc)(int);
+    auto swap_interval = (SwapIntervalFunc)glXGetProcAddressARB((const GLubyte *)"glXSwapIntervalMESA");
+    if (!swap_interval)
+        swap_interval = (SwapIntervalFunc)glXGetProcAddressARB((const GLubyte *)"glXSwapIntervalSGI");
+    if (swap_interval)
+        swap_interval(interval);
+    else
+        std::cout << "[Sample] VSync control is not supported by this OpenGL driver" << std::endl;
+#endif
+}
+
 void GLViewer::render()
 {
     if (available)
     {
+        needsRedraw_ = false;
+        if (offscreen_.isEnabled())
+            offscreen_.begin();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        glClearColor(bckgrnd_clr.r, bckgrnd_clr.g, bckgrnd_clr.b, 1.f);
+        glClearColor(bckgrnd_clr.x, bckgrnd_clr.y, bckgrnd_clr.z, 1.f);
         update();
-        draw();
+        if (edlEnabled_)
+        {
+            glClearColor(bckgrnd_clr.x, bckgrnd_clr.y, bckgrnd_clr.z, 1.f);
+            edl_.begin(windowWidth_, windowHeight_, camera_.getZNear(), camera_.getZFar());
+            draw();
+            edlTimer_.begin();
+            edl_.end(renderState_);
+            edlTimer_.end();
+        }
+        else
+            draw();
         printText();
+        if (offscreen_.isEnabled())
+        {
+            offscreen_.end();
+            return;
+        }
         glutSwapBuffers();
-        glutPostRedisplay();
     }
 }
 
@@ -145,11 +271,14 @@ void GLViewer::update()
         return;
     }
 
+    if (keyStates_['e'] == KEY_STATE::UP || keyStates_['E'] == KEY_STATE::UP)
+        edlEnabled_ = !edlEnabled_;
+
     if (keyStates_['f'] == KEY_STATE::UP || keyStates_['F'] == KEY_STATE::UP)
     {
         followCamera = !followCamera;
         if (followCamera)
-            camera_.setOffsetFromPosition(sl::Translation(0, 0, 1500));
+            camera_.setOffsetFromPosition(vmath::Translation(0, 0, 1500));
     }
 
     // Rotate camera with mouse
@@ -157,8 +286,8 @@ void GLViewer::update()
     {
         if (mouseButton_[MOUSE_BUTTON::LEFT])
         {
-            camera_.rotate(sl::Rotation((float)mouseMotion_[1] * MOUSE_R_SENSITIVITY, camera_.getRight()));
-            camera_.rotate(sl::Rotation((float)mouseMotion_[0] * MOUSE_R_SENSITIVITY, camera_.getVertical() * -1.f));
+            camera_.rotate(vmath::Orientation::fromAxisAngle((float)mouseMotion_[1] * MOUSE_R_SENSITIVITY, camera_.getRight()));
+            camera_.rotate(vmath::Orientation::fromAxisAngle((float)mouseMotion_[0] * MOUSE_R_SENSITIVITY, camera_.getVertical() * -1.f));
         }
 
         // Translate camera with mouse
@@ -172,109 +301,124 @@ void GLViewer::update()
     // Zoom in with mouse wheel
     if (mouseWheelPosition_ != 0)
     {
-        sl::Translation cur_offset = camera_.getOffsetFromPosition();
+        vmath::Translation cur_offset = camera_.getOffsetFromPosition();
         bool zoom_ = mouseWheelPosition_ > 0;
-        sl::Translation new_offset = cur_offset * (zoom_ ? MOUSE_UZ_SENSITIVITY : MOUSE_DZ_SENSITIVITY);
+        vmath::Translation new_offset = cur_offset * (zoom_ ? MOUSE_UZ_SENSITIVITY : MOUSE_DZ_SENSITIVITY);
         if (zoom_)
         {
             if (followCamera)
             {
-                if ((new_offset.tz < 500.f))
-                    new_offset.tz = 500.f;
+                if ((new_offset.z < 500.f))
+                    new_offset.z = 500.f;
             }
             else
             {
-                if ((new_offset.tz < 50.f))
-                    new_offset.tz = 50.f;
+                if ((new_offset.z < 50.f))
+                    new_offset.z = 50.f;
             }
         }
         else
         {
             if (followCamera)
             {
-                if (new_offset.tz > 5000.f)
-                    new_offset.tz = 5000.f;
+                if (new_offset.z > 5000.f)
+                    new_offset.z = 5000.f;
             }
         }
         camera_.setOffsetFromPosition(new_offset);
     }
 
-    // Update point cloud buffers
+    // Apply the latest poses, the view follows the first source
+    for (size_t i = 0; i < sources_.size(); i++)
+        updateSource(*sources_[i], followCamera && i == 0);
+
     camera_.update();
     clearInputs();
-    mtx.lock();
-    if (updateZEDposition)
+
+    // Keep the chunks updated since the last frame, they are uploaded once in view
+    if (store_)
     {
-        sl::float3 clr(0.1f, 0.5f, 0.9f);
-        for (auto it : vecPath)
-            zedPath_.addPoint(it, clr);
-        zedPath_.pushToGPU();
-        vecPath.clear();
-        updateZEDposition = false;
+        storeVersion_ = store_->getVersion();
+        store_->consumeUpdates(storeConsumer_, [this](const ChunkUpdate &it) { chunkCache_.update(it); });
     }
+}
 
-    if (new_chunks)
+void GLViewer::updateSource(SourceView &source, bool follow)
+{
+    PoseSample pose;
+    const unsigned pose_version = source.latestPose.load(pose);
+    if (pose_version != source.poseVersion)
     {
-        const int nb_c = p_fpc->chunks.size();
-        const int maps_c = sub_maps.size();
-        printf("\n");
-        std::cout << "p_fpc->chunks.size() -> " << nb_c << std::endl;
-        std::cout << "sub_maps.size() -> " << maps_c << std::endl;
-        if (nb_c > maps_c)
+        source.poseVersion = pose_version;
+        source.trackingState = pose.state;
+        source.model.setPosition(vmath::Translation(pose.translation[0], pose.translation[1], pose.translation[2]));
+        const vmath::Orientation orientation(pose.orientation[0], pose.orientation[1], pose.orientation[2], pose.orientation[3]);
+        source.model.setRotation(orientation);
+        if (follow)
         {
-            const float step = 500.f;
-            size_t new_size = ((nb_c / step) + 1) * step;
-            sub_maps.resize(new_size);
-            std::cout << "sub_maps.new_size() -> " << new_size << std::endl;
-        }
-        int c = 0;
-        for (auto &it : sub_maps)
-        {
-            if ((c < nb_c) && p_fpc->chunks[c].has_been_updated)
-            {
-                // std::cout << "c: " << c << std::endl;
-                it.update(p_fpc->chunks[c]);
-                // std::cout << "p_fpc->chunks[c].vertices.size() -> " << p_fpc->chunks[c].vertices.size() << std::endl;
-            }
-
-            c++;
+            camera_.setPosition(source.model.getPosition());
+            camera_.setRotation(orientation);
         }
-
-        new_chunks = false;
-        chunks_pushed = true;
     }
 
-    mtx.unlock();
+    vecPath.clear();
+    if (source.poseQueue.consume([this](const PoseSample &it)
+                                 { vecPath.push_back(vmath::float3(it.translation[0], it.translation[1], it.translation[2])); }))
+    {
+        source.path.addPoints(vecPath.data(), vecPath.size(), source.color);
+        source.path.pushToGPU(renderState_);
+    }
 }
 
 void GLViewer::draw()
 {
-    const sl::Transform vpMatrix = camera_.getViewProjectionMatrix();
-
-    glUseProgram(mainShader.it.getProgramId());
-    glUniformMatrix4fv(mainShader.MVP_Mat, 1, GL_TRUE, vpMatrix.m);
-
-    glLineWidth(1.f);
-    zedPath_.draw();
+    auto ts_start = std::chrono::steady_clock::now();
+
+    // Everything shared by the shaders is uploaded once per frame
+    FrameUniforms uniforms;
+    memcpy(uniforms.vpMatrix, camera_.getViewProjectionMatrix().m, sizeof(uniforms.vpMatrix));
+    uniforms.pointScale = camera_.projection_.m[5] * windowHeight_ * 0.5f;
+    uniforms.voxelSize = voxelSize_;
+    uniforms.maxPointSize = maxPointSize_;
+    uniforms.padding_ = 0.f;
+    renderState_.beginFrame(uniforms);
+
+    const GLuint main_program = mainShader.it.getProgramId();
+    for (auto &it : sources_)
+    {
+        SourceView *source = it.get();
+        renderState_.submit(main_program, [this, source]() {
+            glUniformMatrix4fv(mainShader.Model_Mat, 1, GL_FALSE, simd::identity().m);
+            glLineWidth(1.f);
+            source->path.draw(renderState_);
+        });
+        renderState_.submit(main_program, [this, source]() {
+            // Row major
+            glUniformMatrix4fv(mainShader.Model_Mat, 1, GL_TRUE, source->model.getModelMatrix().m);
+            source->model.draw(renderState_);
+        });
+    }
 
-    glUniformMatrix4fv(
-        mainShader.MVP_Mat, 1, GL_FALSE,
-        (sl::Transform::transpose(zedModel_.getModelMatrix()) * sl::Transform::transpose(vpMatrix)).m);
+    // Upload the chunks coming into view and evict the others if needed
+    if (store_)
+        chunkCache_.prepare(uniforms.vpMatrix, uniforms.pointScale, *store_, renderState_);
+    renderState_.submit(pcf_shader.it.getProgramId(), [this]() {
+        pointsTimer_.begin();
+        // A single source keeps its true colors
+        const float tint = sources_.size() > 1 ? sourceTint_ : 0.f;
+        for (size_t i = 0; i < sources_.size(); i++)
+        {
+            const SourceView &source = *sources_[i];
+            glUniform4f(tintLoc_, source.color.x, source.color.y, source.color.z, tint);
+            chunkCache_.draw((int)i, renderState_, lodScaleLoc_);
+        }
+        pointsTimer_.end();
+    });
 
-    zedModel_.draw();
-    glUseProgram(0);
+    renderState_.endFrame();
 
-    if (sub_maps.size())
-    {
-        glPointSize(2.f);
-        glUseProgram(pcf_shader.it.getProgramId());
-        glUniformMatrix4fv(pcf_shader.MVP_Mat, 1, GL_TRUE, vpMatrix.m);
-
-        for (auto &it : sub_maps)
-            it.draw();
-        glUseProgram(0);
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    }
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - ts_start).count();
+    drawCpuMs_ = drawCpuMs_ * 0.95 + ms * 0.05;
 }
 
 void GLViewer::clearInputs()
@@ -288,7 +432,8 @@ void GLViewer::clearInputs()
 
 void GLViewer::drawCallback()
 {
-    currentInstance_->render();
+    if (!currentInstance_->offscreen_.isEnabled())
+        currentInstance_->render();
 }
 
 void printGL(float x, float y, const char *string)
@@ -305,17 +450,40 @@ void GLViewer::printText()
 {
     if (available)
     {
+        // The bitmap text goes through the fixed function pipeline
+        renderState_.useProgram(0);
         glColor3f(0.85f, 0.86f, 0.83f);
         printGL(-0.99f, 0.90f, "Press 'F' to un/follow the camera");
-
-        std::string positional_tracking_state_str();
-        // Show mapping state
-        if ((tracking_state == sl::POSITIONAL_TRACKING_STATE::OK))
+        printGL(-0.99f, 0.85f, "Press 'E' to toggle Eye-Dome Lighting");
+
+        std::string gpu_str("GPU points : " + std::to_string(pointsTimer_.getAverageMs()) + " ms");
+        if (edlEnabled_)
+            gpu_str += " | EDL : " + std::to_string(edlTimer_.getAverageMs()) + " ms";
+        gpu_str += " | CPU draw : " + std::to_string(drawCpuMs_) + " ms";
+        printGL(-0.99f, -0.95f, gpu_str.c_str());
+
+        const GpuChunkCache::Stats &cache = chunkCache_.getStats();
+        std::string cache_str("GPU chunks : " + std::to_string(cache.nbVisible) + " in view, " + std::to_string(cache.nbResident) + " resident ("
+                              + std::to_string(cache.residentBytes >> 20) + " MB) | hits " + std::to_string(cache.hits) + ", misses "
+                              + std::to_string(cache.misses) + ", evictions " + std::to_string(cache.evictions) + " | "
+                              + std::to_string(cache.nbPointsDrawn / 1000) + "k points drawn");
+        printGL(-0.99f, -0.90f, cache_str.c_str());
+
+        // Show mapping state, of each source if there are several
+        bool all_ok = true;
+        std::string state_str("POSITIONAL TRACKING STATE :");
+        for (size_t i = 0; i < sources_.size(); i++)
+        {
+            all_ok &= sources_[i]->trackingState == TrackingState::OK;
+            if (sources_.size() > 1)
+                state_str += (i ? " | " : " ") + std::to_string(i) + ":";
+            state_str += " ";
+            state_str += toString(sources_[i]->trackingState);
+        }
+        if (all_ok)
             glColor3f(0.25f, 0.99f, 0.25f);
         else
             glColor3f(0.99f, 0.25f, 0.25f);
-        std::string state_str("POSITIONAL TRACKING STATE : ");
-        state_str += sl::toString(tracking_state).c_str();
         printGL(-0.99f, 0.95f, state_str.c_str());
     }
 }
@@ -336,6 +504,7 @@ void GLViewer::mouseButtonCallback(int button, int state, int x, int y)
         currentInstance_->mouseCurrentPosition_[1] = y;
         currentInstance_->previousMouseMotion_[0] = x;
         currentInstance_->previousMouseMotion_[1] = y;
+        currentInstance_->needsRedraw_ = true;
     }
 }
 
@@ -345,46 +514,54 @@ void GLViewer::mouseMotionCallback(int x, int y)
     currentInstance_->mouseMotion_[1] = y - currentInstance_->previousMouseMotion_[1];
     currentInstance_->previousMouseMotion_[0] = x;
     currentInstance_->previousMouseMotion_[1] = y;
-    glutPostRedisplay();
+    currentInstance_->needsRedraw_ = true;
 }
 
 void GLViewer::reshapeCallback(int width, int height)
 {
+    // The offscreen target keeps its own size whatever the (hidden) window does
+    if (currentInstance_->offscreen_.isEnabled())
+    {
+        width = currentInstance_->offscreen_.getWidth();
+        height = currentInstance_->offscreen_.getHeight();
+    }
+    currentInstance_->windowWidth_ = width;
+    currentInstance_->windowHeight_ = height;
     glViewport(0, 0, width, height);
     float hfov = (180.0f / M_PI) * (2.0f * atan(width / (2.0f * 500)));
     float vfov = (180.0f / M_PI) * (2.0f * atan(height / (2.0f * 500)));
     currentInstance_->camera_.setProjection(hfov, vfov, currentInstance_->camera_.getZNear(), currentInstance_->camera_.getZFar());
+    currentInstance_->needsRedraw_ = true;
 }
 
 void GLViewer::keyPressedCallback(unsigned char c, int x, int y)
 {
     currentInstance_->keyStates_[c] = KEY_STATE::DOWN;
-    glutPostRedisplay();
+    currentInstance_->needsRedraw_ = true;
 }
 
 void GLViewer::keyReleasedCallback(unsigned char c, int x, int y)
 {
     currentInstance_->keyStates_[c] = KEY_STATE::UP;
+    currentInstance_->needsRedraw_ = true;
 }
 
 void GLViewer::idle()
 {
-    glutPostRedisplay();
+    currentInstance_->needsRedraw_ = true;
 }
 
-void GLViewer::updatePose(sl::Pose pose, sl::POSITIONAL_TRACKING_STATE state)
+void GLViewer::updatePose(int source_id, const PoseSample &pose)
 {
-    mtx.lock();
-    pose_ = pose;
-    tracking_state = state;
-    vecPath.push_back(pose_.getTranslation());
-    zedModel_.setRT(pose_.pose_data);
-    updateZEDposition = true;
-    mtx.unlock();
-    if (followCamera)
+    SourceView &source = *sources_[source_id];
+    if (!source.poseQueue.push(pose))
+        source.droppedPoses++;
+    source.latestPose.store(pose);
+    // Only the first pose after a frame wakes the main loop, the next ones wait for the frame to be due
+    if (!needsRedraw_.exchange(true))
     {
-        camera_.setPosition(pose_.getTranslation());
-        sl::Rotation rot = pose_.getRotationMatrix();
-        camera_.setRotation(rot);
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wake_ = true;
+        wakeCondition_.notify_one();
     }
 }
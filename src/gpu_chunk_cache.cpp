@@ -0,0 +1,191 @@
+#include "gpu_chunk_cache.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    /// Order the points so that every prefix samples the whole chunk: the original order is spatially
+    /// coherent, the bit-reversed sequence 0, n/2, n/4, 3n/4... picks points evenly spread along it
+    void bitReversedOrder(const std::vector<MapPoint> &in, std::vector<MapPoint> &out)
+    {
+        out.clear();
+        int bits = 0;
+        while (((size_t)1 << bits) < in.size())
+            bits++;
+        for (size_t i = 0; i < ((size_t)1 << bits); i++)
+        {
+            size_t r = 0;
+            for (int b = 0; b < bits; b++)
+                r |= ((i >> b) & 1) << (bits - 1 - b);
+            if (r < in.size())
+                out.push_back(in[r]);
+        }
+    }
+}
+
+void GpuChunkCache::update(const ChunkUpdate &update)
+{
+    if (update.source >= (int)sources_.size())
+        sources_.resize(update.source + 1);
+    auto &entries = sources_[update.source];
+    if (update.index >= (int)entries.size())
+        entries.resize(update.index + 1);
+    if (!entries[update.index])
+        entries[update.index].reset(new Entry());
+    Entry &entry = *entries[update.index];
+    entry.source = update.source;
+    entry.index = update.index;
+    entry.bounds = update.data->bounds;
+    entry.nbPoints = update.data->points.size();
+    if (!entry.data)
+        pending_.push_back(&entry);
+    entry.data = update.data;
+    entry.stale = true;
+    octree_.update(update.source, update.index, entry.bounds);
+}
+
+void GpuChunkCache::prepare(const float *vp, float point_scale, ChunkStore &store, RenderState &state)
+{
+    for (Entry *entry : visible_)
+        entry->visible = false;
+    visible_.clear();
+
+    frustum_.set(vp);
+    octree_.queryFrustum(frustum_, [&](int source, int index, bool) {
+        Entry &entry = *sources_[source][index];
+        if (!entry.nbPoints)
+            return;
+        entry.visible = true;
+        visible_.push_back(&entry);
+
+        entry.lod = 1.f;
+        if (lodSize_ > 0.f)
+        {
+            // Projected size of the chunk, w is the distance of its center along the view axis
+            float center[3], size = 0.f;
+            for (int i = 0; i < 3; i++)
+            {
+                center[i] = (entry.bounds.min[i] + entry.bounds.max[i]) * 0.5f;
+                size = std::max(size, entry.bounds.max[i] - entry.bounds.min[i]);
+            }
+            const float w = vp[12] * center[0] + vp[13] * center[1] + vp[14] * center[2] + vp[15];
+            if (w > size)
+                entry.lod = std::min(std::max(size * point_scale / w / lodSize_, 1.f / 16.f), 1.f);
+        }
+    });
+    stats_.nbVisible = visible_.size();
+    stats_.nbPointsDrawn = 0;
+
+    std::vector<Entry *> to_upload;
+    for (Entry *entry : visible_)
+    {
+        if (entry->gpu)
+        {
+            // Most recently visible first
+            lru_.splice(lru_.begin(), lru_, entry->lru);
+            if (!entry->stale)
+                stats_.hits++;
+        }
+        if (!entry->gpu || entry->stale)
+            to_upload.push_back(entry);
+    }
+
+    size_t uploaded = 0;
+    for (Entry *entry : to_upload)
+    {
+        const size_t bytes = entry->nbPoints * sizeof(MapPoint);
+        if (uploadBudget_ && uploaded && uploaded + bytes > uploadBudget_)
+            break;
+        if (budget_)
+        {
+            // Make room with the chunks which are not visible, the least recently visible first
+            const size_t needed = bytes - std::min(bytes, entry->gpuBytes);
+            while (stats_.residentBytes + needed > budget_ && !lru_.empty() && !lru_.back()->visible)
+                evict(*lru_.back());
+            if (stats_.residentBytes + needed > budget_)
+                continue;
+        }
+        // Evicted chunks are read again, possibly from disk
+        if (!entry->data)
+            entry->data = store.get(entry->source, entry->index);
+        if (!entry->data)
+            continue;
+        upload(*entry, state);
+        uploaded += bytes;
+    }
+
+    // Do not hold the content of chunks out of view, the store can page it out
+    auto end = std::remove_if(pending_.begin(), pending_.end(), [](Entry *entry) {
+        if (entry->data && !entry->visible)
+            entry->data.reset();
+        return !entry->data;
+    });
+    pending_.erase(end, pending_.end());
+}
+
+void GpuChunkCache::draw(int source, RenderState &state, GLint lod_scale_loc)
+{
+    if (source >= (int)sources_.size())
+        return;
+    float lod_scale = 1.f;
+    glUniform1f(lod_scale_loc, lod_scale);
+    for (Entry *entry : visible_)
+    {
+        if (entry->source != source || !entry->gpu)
+            continue;
+        // Fewer points, larger splats to cover the same surface
+        const float scale = 1.f / std::sqrt(entry->lod);
+        if (scale != lod_scale)
+        {
+            lod_scale = scale;
+            glUniform1f(lod_scale_loc, lod_scale);
+        }
+        const int nb_points = std::max(1, (int)std::ceil(entry->nbPoints * entry->lod));
+        entry->gpu->draw(state, nb_points);
+        stats_.nbPointsDrawn += std::min((size_t)nb_points, entry->nbPoints);
+    }
+}
+
+void GpuChunkCache::upload(Entry &entry, RenderState &state)
+{
+    if (entry.gpu)
+        stats_.updates++;
+    else
+    {
+        entry.gpu.reset(new SubMapObj(state));
+        lru_.push_front(&entry);
+        entry.lru = lru_.begin();
+        stats_.nbResident++;
+        if (entry.evicted)
+            stats_.misses++;
+        else
+            stats_.updates++;
+    }
+    if (lodSize_ > 0.f)
+    {
+        bitReversedOrder(entry.data->points, lodOrder_);
+        entry.gpu->update(lodOrder_.data(), lodOrder_.size());
+    }
+    else
+        entry.gpu->update(entry.data->points.data(), entry.data->points.size());
+    stats_.residentBytes -= entry.gpuBytes;
+    entry.gpuBytes = entry.data->points.size() * sizeof(MapPoint);
+    stats_.residentBytes += entry.gpuBytes;
+    entry.nbPoints = entry.data->points.size();
+    entry.stale = false;
+    entry.evicted = false;
+    // The GPU holds the only copy needed for drawing
+    entry.data.reset();
+}
+
+void GpuChunkCache::evict(Entry &entry)
+{
+    lru_.erase(entry.lru);
+    entry.gpu.reset();
+    stats_.residentBytes -= entry.gpuBytes;
+    entry.gpuBytes = 0;
+    stats_.nbResident--;
+    stats_.evictions++;
+    entry.evicted = true;
+}
@@ -0,0 +1,58 @@
+#include "gpu_timer.h"
+
+GpuTimer::GpuTimer() : next_(0), active_(false), average_ms_(0.), count_(0)
+{
+    for (int i = 0; i < NB_QUERIES; i++)
+    {
+        queryID_[i] = 0;
+        pending_[i] = false;
+    }
+}
+
+GpuTimer::~GpuTimer()
+{
+    if (queryID_[0])
+        glDeleteQueries(NB_QUERIES, queryID_);
+}
+
+void GpuTimer::collect()
+{
+    for (int i = 0; i < NB_QUERIES; i++)
+    {
+        if (!pending_[i])
+            continue;
+        GLint available = 0;
+        glGetQueryObjectiv(queryID_[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            continue;
+        GLuint64 elapsed_ns = 0;
+        glGetQueryObjectui64v(queryID_[i], GL_QUERY_RESULT, &elapsed_ns);
+        pending_[i] = false;
+
+        // Exponential moving average, smooth enough to be displayed every frame
+        const double ms = elapsed_ns * 1e-6;
+        average_ms_ = count_ ? average_ms_ * 0.95 + ms * 0.05 : ms;
+        count_++;
+    }
+}
+
+void GpuTimer::begin()
+{
+    if (!queryID_[0])
+        glGenQueries(NB_QUERIES, queryID_);
+
+    collect();
+    active_ = !pending_[next_];
+    if (active_)
+        glBeginQuery(GL_TIME_ELAPSED, queryID_[next_]);
+}
+
+void GpuTimer::end()
+{
+    if (!active_)
+        return;
+    glEndQuery(GL_TIME_ELAPSED);
+    pending_[next_] = true;
+    next_ = (next_ + 1) % NB_QUERIES;
+    active_ = false;
+}
@@ -0,0 +1,66 @@
+#include "image_preview.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+ImagePreview::ImagePreview() : write_(0), latest_(1), display_(2), interval_(0.), running_(false), nb_published_(0), nb_displayed_(0) {}
+
+ImagePreview::~ImagePreview()
+{
+    stop();
+}
+
+void ImagePreview::start(sl::Resolution resolution, float fps)
+{
+    for (auto &it : buffers_)
+        it.alloc(resolution, sl::MAT_TYPE::U8_C4, sl::MEM::CPU);
+    interval_ = std::chrono::duration<double>(fps > 0.f ? 1. / fps : 0.);
+    running_ = true;
+    thread_ = std::thread(&ImagePreview::displayLoop, this);
+}
+
+void ImagePreview::stop()
+{
+    if (!thread_.joinable())
+        return;
+    running_ = false;
+    thread_.join();
+    for (auto &it : buffers_)
+        it.free();
+    std::cout << "[Sample] Image preview: " << nb_published_ << " images retrieved, " << nb_displayed_ << " displayed" << std::endl;
+}
+
+bool ImagePreview::frameDue() const
+{
+    return running_ && (std::chrono::steady_clock::now() - ts_last_) >= interval_;
+}
+
+void ImagePreview::publish()
+{
+    ts_last_ = std::chrono::steady_clock::now();
+    nb_published_++;
+    // Give the freshly written buffer and take back the previous one, displayed or not
+    write_ = latest_.exchange(write_ | NEW_FRAME) & ~NEW_FRAME;
+}
+
+void ImagePreview::displayLoop()
+{
+    const std::string window_name = "ZED View";
+    // Wake up often enough to pick up every published image and to process the window events
+    const int wait_ms = std::max(1, (int)(interval_.count() * 500.));
+    while (running_)
+    {
+        if (latest_.load() & NEW_FRAME)
+        {
+            display_ = latest_.exchange(display_) & ~NEW_FRAME;
+            sl::Mat &image = buffers_[display_];
+            cv::Mat image_ocv((int)image.getHeight(), (int)image.getWidth(), CV_8UC4, image.getPtr<sl::uchar1>(sl::MEM::CPU), image.getStepBytes(sl::MEM::CPU));
+            cv::imshow(window_name, image_ocv);
+            nb_displayed_++;
+        }
+        cv::waitKey(wait_ms);
+    }
+    cv::destroyWindow(window_name);
+}
@@ -30,127 +30,254 @@
 #include "gl_viewer.h"
 
 #include "utils.h"
+#include "app_config.h"
+#include "image_preview.h"
+#include "camera_source.h"
+#include "chunk_store.h"
+#include "chunk_codec.h"
+#include "map_client.h"
+#include "map_server.h"
+#include "thread_pool.h"
 
 #include <opencv2/opencv.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <memory>
+#include <thread>
+
+static std::atomic<bool> exit_requested(false);
+
+static void onSignal(int)
+{
+    exit_requested = true;
+}
+
+// The viewer does not depend on the ZED SDK, it has its own copy of these enums
+static_assert((int)CameraModel::ZED2i == (int)sl::MODEL::ZED2i, "CameraModel must match sl::MODEL");
+static_assert((int)TrackingState::FPS_TOO_LOW == (int)sl::POSITIONAL_TRACKING_STATE::FPS_TOO_LOW,
+              "TrackingState must match sl::POSITIONAL_TRACKING_STATE");
+
+static CameraModel toCameraModel(sl::MODEL model)
+{
+    return (CameraModel)(int)model;
+}
+
+static PoseSample toPoseSample(const sl::Pose &pose, sl::POSITIONAL_TRACKING_STATE state)
+{
+    PoseSample sample;
+    const sl::Translation translation = pose.pose_data.getTranslation();
+    const sl::Orientation orientation = pose.pose_data.getOrientation();
+    for (int i = 0; i < 3; i++)
+        sample.translation[i] = translation[i];
+    for (int i = 0; i < 4; i++)
+        sample.orientation[i] = orientation[i];
+    sample.state = (TrackingState)(int)state;
+    return sample;
+}
+
 int main(int argc, char **argv)
 {
-    sl::Camera zed;
     // Set configuration parameters for the ZED
-    sl::InitParameters init_parameters;
-    init_parameters.depth_mode = sl::DEPTH_MODE::ULTRA;
-    init_parameters.coordinate_system = sl::COORDINATE_SYSTEM::RIGHT_HANDED_Y_UP; // OpenGL's coordinate system is right_handed
-    parse_args(argc, argv, init_parameters);
-
-    // Open the camera
-    auto returned_state = zed.open(init_parameters);
-
-    if (returned_state != sl::ERROR_CODE::SUCCESS)
-    { // Quit if an error occurred
-        print("Open Camera", returned_state, "\nExit program.");
-        zed.close();
+    AppConfig config;
+    if (!parse_args(argc, argv, config))
         return EXIT_FAILURE;
+    if (config.opencv_threads >= 0)
+        cv::setNumThreads(config.opencv_threads);
+
+    // Open every source, each one is then grabbed and mapped on its own thread
+    const std::vector<std::string> inputs = getInputs(config);
+    std::vector<std::unique_ptr<CameraSource>> sources;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        sources.emplace_back(new CameraSource((int)i));
+        if (!sources.back()->open(config, inputs[i]))
+        {
+            print("Exit program.");
+            return EXIT_FAILURE;
+        }
     }
+    if (sources.size() > 1)
+        print("Mapping " + std::to_string(sources.size()) + " sources");
 
-    auto camera_infos = zed.getCameraInformation();
+    // Background stages share a worker pool, capped so that every grab thread and the viewer keep a core
+    int nb_workers = config.worker_threads;
+    if (nb_workers < 0)
+        nb_workers = std::max(0, (int)std::thread::hardware_concurrency() - (int)sources.size() - 1);
+    ThreadPool::configure(nb_workers);
+
+    // Chunks of all the sources, merged by their threads, indexed by cells of a few voxels at least
+    ChunkStore store((int)sources.size(), sources[0]->getMapResolution() * 16.f);
+    if (config.morton_order)
+        store.setMortonOrder(sources[0]->getMapResolution());
+    if (!config.page_dir.empty())
+    {
+        PagingParameters paging;
+        paging.directory = config.page_dir;
+        paging.after = config.page_after;
+        paging.distance = config.page_distance * sources[0]->getUnitsPerMeter();
+        if (!store.startPaging(paging))
+            return EXIT_FAILURE;
+    }
+
+    // Remote viewers, served from their own thread
+    MapServer server;
+    MapClient loopback;
+    if (!config.serve.empty())
+    {
+        map_protocol::Hello hello;
+        hello.magic = map_protocol::MAGIC;
+        hello.version = map_protocol::VERSION;
+        hello.nbSources = (uint32_t)sources.size();
+        hello.unitsPerMeter = sources[0]->getUnitsPerMeter();
+        hello.mapResolution = sources[0]->getMapResolution();
+        hello.quantizationStep = hello.mapResolution / config.codec_precision;
+        std::vector<int32_t> models;
+        for (auto &it : sources)
+            models.push_back((int32_t)it->getCameraInformation().camera_model);
+        if (!server.start(config.serve, store, hello, models, (size_t)config.serve_buffer_kb << 10))
+            return EXIT_FAILURE;
+        if (config.serve_loopback && loopback.connect(server.getLocalEndpoint()))
+            loopback.start(nullptr);
+    }
 
     // Point cloud viewer
     GLViewer viewer;
+    if (config.headless)
+    {
+        // No window to close in headless mode, stop on Ctrl+C instead
+        std::signal(SIGINT, onSignal);
+        std::signal(SIGTERM, onSignal);
+    }
+    else
+    {
+        std::vector<CameraModel> models;
+        for (auto &it : sources)
+            models.push_back(toCameraModel(it->getCameraInformation().camera_model));
+        GLenum errgl = viewer.init(argc, argv, &store, models, config.offscreen);
+        if (errgl != GLEW_OK)
+            print("Error OpenGL: " + std::string((char *)glewGetErrorString(errgl)));
+        viewer.setEDL(config.edl);
+        viewer.setTargetFPS(config.viewer_fps);
+        viewer.setVSync(config.vsync);
+        viewer.reservePath(config.path_buffer_size);
+        viewer.setPoseQueueSize(config.pose_queue_size);
+        viewer.setSourceTint(config.source_tint);
+        viewer.setGpuBudget((size_t)config.gpu_budget_mb << 20, (size_t)config.gpu_upload_budget_mb << 20);
+        // Points are drawn as splats as large as the voxels of the map
+        viewer.setMapResolution(sources[0]->getMapResolution());
+        viewer.setLodSize(config.lod_size);
+    }
 
-    // Initialize point cloud viewer
-    sl::FusedPointCloud map;
-    GLenum errgl = viewer.init(argc, argv,
-                               camera_infos.camera_configuration.calibration_parameters.left_cam,
-                               &map, camera_infos.camera_model);
-    if (errgl != GLEW_OK)
-        print("Error OpenGL: " + std::string((char *)glewGetErrorString(errgl)));
-
-    // Setup and start positional tracking
-    sl::Pose pose;
-    sl::POSITIONAL_TRACKING_STATE tracking_state = sl::POSITIONAL_TRACKING_STATE::OFF;
-    sl::PositionalTrackingParameters positional_tracking_parameters;
-    positional_tracking_parameters.enable_area_memory = false;
-    returned_state = zed.enablePositionalTracking(positional_tracking_parameters);
-    if (returned_state != sl::ERROR_CODE::SUCCESS)
+    // The image preview of the first source needs a display, it runs on its own thread
+    ImagePreview preview;
+    if (config.preview && !config.headless && config.offscreen.output.empty())
+        preview.start(sources[0]->getPreviewResolution(), config.preview_fps);
+
+    CameraSource::PoseCallback on_pose;
+    if (!config.headless || server.isRunning())
+        on_pose = [&](int source, const sl::Pose &pose, sl::POSITIONAL_TRACKING_STATE state) {
+            const PoseSample sample = toPoseSample(pose, state);
+            if (!config.headless)
+                viewer.updatePose(source, sample);
+            if (server.isRunning())
+            {
+                map_protocol::Pose published;
+                published.source = source;
+                published.state = (int32_t)sample.state;
+                published.timestamp = pose.timestamp.getNanoseconds();
+                std::copy(sample.translation, sample.translation + 3, published.translation);
+                std::copy(sample.orientation, sample.orientation + 4, published.orientation);
+                server.updatePose(published);
+            }
+        };
+    for (auto &it : sources)
+        it->start(store, on_pose, it->getId() == 0 && preview.isRunning() ? &preview : nullptr);
+
+    // The viewer runs on the main thread, the sources on theirs
+    if (config.headless)
     {
-        print("Enabling positional tracking failed: ", returned_state);
-        zed.close();
-        return EXIT_FAILURE;
+        auto running = [&sources]() {
+            for (auto &it : sources)
+                if (it->isRunning())
+                    return true;
+            return false;
+        };
+        // Without viewer, stop at the end of all the SVOs
+        while (!exit_requested && running())
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    else
+    {
+        // The viewer paces its own frames and sleeps in between
+        while (viewer.isAvailable())
+            viewer.waitForFrame();
     }
 
-    // Set spatial mapping parameters
-    sl::SpatialMappingParameters spatial_mapping_parameters;
-    // Request a Point Cloud
-    spatial_mapping_parameters.map_type = sl::SpatialMappingParameters::SPATIAL_MAP_TYPE::FUSED_POINT_CLOUD;
-    // Set mapping range, it will set the resolution accordingly (a higher range, a lower resolution)
-    spatial_mapping_parameters.set(sl::SpatialMappingParameters::MAPPING_RANGE::LONG);
-    // Request partial updates only (only the lastest updated chunks need to be re-draw)
-    spatial_mapping_parameters.use_chunk_only = true;
-    // Start the spatial mapping
-    zed.enableSpatialMapping(spatial_mapping_parameters);
-
-    // Timestamp of the last fused point cloud requested
-    std::chrono::high_resolution_clock::time_point ts_last;
-
-    // Setup runtime parameters
-    sl::RuntimeParameters runtime_parameters;
-    // Use low depth confidence avoid introducing noise in the constructed model
-    runtime_parameters.confidence_threshold = 50;
-
-    auto resolution = camera_infos.camera_configuration.resolution;
-
-    // Define display resolution and check that it fit at least the image resolution
-    sl::Resolution display_resolution(std::min((int)resolution.width, 720),
-                                      std::min((int)resolution.height, 404));
-
-    // Create a Mat to contain the left image and its opencv ref
-    sl::Mat image_zed(display_resolution, sl::MAT_TYPE::U8_C4);
-    cv::Mat image_zed_ocv(image_zed.getHeight(), image_zed.getWidth(), CV_8UC4, image_zed.getPtr<sl::uchar1>(sl::MEM::CPU));
-
-    // Start the main loop
-    while (viewer.isAvailable())
+    // Stop the sources, the whole maps are merged if they are exported
+    // Note: when paging, the last retrieved chunks are exported to avoid extracting the whole maps in memory
+    double total_fps = 0.;
+    for (auto &it : sources)
     {
-        // Grab a new image
-        if (zed.grab(runtime_parameters) == sl::ERROR_CODE::SUCCESS)
-        {
-            // Retrieve the left image
-            zed.retrieveImage(image_zed, sl::VIEW::LEFT, sl::MEM::CPU, display_resolution);
-            // Retrieve the camera pose data
-            tracking_state = zed.getPosition(pose);
-            viewer.updatePose(pose, tracking_state);
+        it->stop(!config.export_path.empty() && config.page_dir.empty());
+        it->getStats().report(sources.size() > 1 ? "Source " + std::to_string(it->getId()) : "");
+        total_fps += it->getStats().getGrabFPS();
+    }
+    if (sources.size() > 1)
+        print("All sources: " + std::to_string(total_fps) + " FPS");
+    store.report();
+
+    // Send what is still queued to the clients, then compare the map rebuilt by the loopback client
+    server.stop(1.f);
+    if (config.serve_loopback)
+    {
+        loopback.stop();
+        loopback.report();
+    }
 
-            if (tracking_state == sl::POSITIONAL_TRACKING_STATE::OK)
+    // Save generated point cloud
+    if (!config.export_path.empty())
+    {
+        ChunkBounds box;
+        if (!config.export_box.empty())
+        {
+            const float units_per_meter = sources[0]->getUnitsPerMeter();
+            for (int i = 0; i < 3; i++)
             {
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - ts_last).count();
-
-                // Ask for a fused point cloud update if 500ms have elapsed since last request
-                if ((duration > 30) && viewer.chunksUpdated())
-                {
-                    // Ask for a point cloud refresh
-                    zed.requestSpatialMapAsync();
-                    ts_last = std::chrono::high_resolution_clock::now();
-                }
-
-                // If the point cloud is ready to be retrieved
-                if (zed.getSpatialMapRequestStatusAsync() == sl::ERROR_CODE::SUCCESS)
-                {
-                    zed.retrieveSpatialMapAsync(map);
-                    // std::cout << "Chunk Size: " << map.chunks.size() << std::endl;
-                    viewer.updateChunks();
-                }
+                box.min[i] = config.export_box[i] * units_per_meter;
+                box.max[i] = config.export_box[3 + i] * units_per_meter;
             }
-            cv::imshow("ZED View", image_zed_ocv);
-            cv::waitKey(15);
         }
+        // .zmap: compressed recording, otherwise PLY
+        const std::string extension = ".zmap";
+        bool saved;
+        if (config.export_path.size() > extension.size() &&
+            config.export_path.compare(config.export_path.size() - extension.size(), extension.size(), extension) == 0)
+        {
+            chunk_codec::StreamInfo info;
+            info.nbSources = (int)sources.size();
+            info.unitsPerMeter = sources[0]->getUnitsPerMeter();
+            info.mapResolution = sources[0]->getMapResolution();
+            info.step = info.mapResolution / config.codec_precision;
+            for (auto &it : sources)
+                info.cameraModels.push_back((int32_t)it->getCameraInformation().camera_model);
+            saved = chunk_codec::saveStore(store, config.export_path, info, config.export_box.empty() ? nullptr : &box);
+        }
+        else
+            saved = store.savePLY(config.export_path, config.export_box.empty() ? nullptr : &box);
+        if (saved)
+            print("Fused point cloud saved to " + config.export_path);
+        else
+            print("Failed to save the fused point cloud to " + config.export_path);
     }
+    ThreadPool::global().report();
 
-    // Save generated point cloud
-    // map.save("MyFusedPointCloud");
-
-    // Free allocated memory before closing the camera
-    image_zed.free();
-    // Close the ZED
-    zed.close();
+    // Free allocated memory before closing the cameras
+    preview.stop();
+    // Close the ZEDs
+    for (auto &it : sources)
+        it->close();
 
     return 0;
 }
@@ -0,0 +1,198 @@
+#include "map_client.h"
+#include "net_socket.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+MapClient::~MapClient()
+{
+    stop();
+}
+
+bool MapClient::connect(const std::string &endpoint, int timeout_ms)
+{
+    fd_ = net::connectSocket(endpoint);
+    if (fd_ < 0)
+        return false;
+    connected_ = true;
+    snapshotReceived_ = false;
+    connectedAt_ = std::chrono::steady_clock::now();
+
+    const auto deadline = connectedAt_ + std::chrono::milliseconds(timeout_ms);
+    while (!helloReceived_ && connected_ && std::chrono::steady_clock::now() < deadline)
+        receive(50);
+    if (!helloReceived_ || streamError_)
+    {
+        if (!helloReceived_)
+            std::cout << "[Sample][Error] No map server on " << endpoint << std::endl;
+        stop();
+        return false;
+    }
+    std::cout << "[Sample] Connected to the map server " << endpoint << ", " << hello_.nbSources << " sources" << std::endl;
+    return true;
+}
+
+void MapClient::start(PoseCallback on_pose)
+{
+    if (thread_.joinable() || fd_ < 0)
+        return;
+    onPose_ = on_pose;
+    stop_ = false;
+    thread_ = std::thread(&MapClient::run, this);
+}
+
+void MapClient::stop()
+{
+    stop_ = true;
+    if (thread_.joinable())
+        thread_.join();
+    net::closeSocket(fd_);
+    fd_ = -1;
+    connected_ = false;
+}
+
+void MapClient::run()
+{
+    while (!stop_ && receive(50))
+        ;
+    if (!stop_ && !streamError_)
+        std::cout << "[Sample] The map server closed the connection" << std::endl;
+    connected_ = false;
+}
+
+bool MapClient::receive(int timeout_ms)
+{
+    if (!net::waitReadable(fd_, timeout_ms))
+        return true;
+    uint8_t buffer[1 << 16];
+    const long size = net::receiveSome(fd_, buffer, sizeof(buffer));
+    if (size < 0)
+    {
+        connected_ = false;
+        return false;
+    }
+    bytes_ += size;
+    reader_.append(buffer, size);
+
+    map_protocol::MessageHeader header;
+    const uint8_t *payload;
+    while (reader_.next(header, payload))
+        if (!handle(header, payload))
+            return drop("chunk index out of range");
+    if (reader_.hasError())
+        return drop("message larger than " + std::to_string(map_protocol::MAX_MESSAGE_SIZE >> 20) + " MB");
+    return true;
+}
+
+bool MapClient::drop(const std::string &reason)
+{
+    std::cout << "[Sample][Error] Invalid map stream (" << reason << "), disconnected" << std::endl;
+    streamError_ = true;
+    connected_ = false;
+    // Called by the thread reading the socket, stop() joins it before closing
+    net::closeSocket(fd_);
+    fd_ = -1;
+    return false;
+}
+
+bool MapClient::handle(const map_protocol::MessageHeader &header, const uint8_t *payload)
+{
+    using namespace map_protocol;
+    switch (header.type)
+    {
+    case HELLO:
+    {
+        Hello hello = {};
+        std::vector<int32_t> models;
+        if (!decodeHello(payload, header.size, hello, models))
+        {
+            std::cout << "[Sample][Error] Unsupported map stream (version " << hello.version << ")" << std::endl;
+            break;
+        }
+        // Only the first one defines the map
+        if (!helloReceived_)
+        {
+            hello_ = hello;
+            cameraModels_ = models;
+            store_.reset(new ChunkStore((int)hello.nbSources, hello.mapResolution * 16.f));
+            helloReceived_ = true;
+        }
+        return true;
+    }
+    case POSE:
+    {
+        Pose pose;
+        if (header.size != sizeof(pose) || !helloReceived_)
+            break;
+        memcpy(&pose, payload, sizeof(pose));
+        if (pose.source < 0 || pose.source >= (int)hello_.nbSources)
+            break;
+        // Both clocks are the same on one machine, synchronized otherwise
+        const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        const double latency = (now - (long long)pose.publishTime) * 1e-6;
+        latencyMs_ += latency;
+        maxLatencyMs_ = std::max(maxLatencyMs_, latency);
+        poses_++;
+        if (onPose_)
+            onPose_(pose);
+        return true;
+    }
+    case CHUNK:
+    {
+        ChunkHeader chunk;
+        std::vector<MapPoint> points;
+        if (!helloReceived_ || !decodeChunk(payload, header.size, chunk, points) || chunk.source < 0 ||
+            chunk.source >= (int)hello_.nbSources)
+            break;
+        // The store allocates up to the index
+        if (chunk.index < 0 || chunk.index > MAX_CHUNK_INDEX)
+            return false;
+        store_->update(chunk.source, {{chunk.index, points.data(), points.size()}});
+        chunks_++;
+        points_ += points.size();
+        if (chunk.lod)
+            decimated_++;
+        return true;
+    }
+    case SNAPSHOT_END:
+        if (!helloReceived_ || snapshotReceived_)
+            break;
+        snapshotAt_ = std::chrono::steady_clock::now();
+        snapshotBytes_ = bytes_;
+        snapshotPoints_ = store_->getNbPoints();
+        snapshotReceived_ = true;
+        return true;
+    default:
+        // Unknown messages are skipped, for newer servers
+        return true;
+    }
+    errors_++;
+    return true;
+}
+
+void MapClient::report() const
+{
+    const auto now = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(now - connectedAt_).count();
+    if (snapshotReceived_)
+    {
+        const double startup = std::chrono::duration<double>(snapshotAt_ - connectedAt_).count();
+        const double steady = std::chrono::duration<double>(now - snapshotAt_).count();
+        const unsigned long long steady_bytes = bytes_ - snapshotBytes_;
+        std::cout << "[Sample] Map client startup: " << snapshotPoints_ << " points, " << (snapshotBytes_ >> 10) << " KB in "
+                  << startup * 1e3 << " ms; steady state: " << (steady_bytes >> 10) << " KB in " << steady << " s ("
+                  << (steady > 0. ? steady_bytes * 8. / steady / 1e6 : 0.) << " Mbit/s)" << std::endl;
+    }
+    std::cout << "[Sample] Map client: " << (bytes_ >> 20) << " MB received (" << (seconds > 0. ? bytes_ * 8. / seconds / 1e6 : 0.)
+              << " Mbit/s), " << chunks_ << " chunks (" << decimated_ << " decimated), " << points_ << " points, " << poses_
+              << " poses";
+    if (poses_)
+        std::cout << ", pose latency " << latencyMs_ / poses_ << " ms (max " << maxLatencyMs_ << " ms)";
+    if (errors_)
+        std::cout << ", " << errors_ << " invalid messages";
+    std::cout << std::endl;
+    if (store_)
+        std::cout << "[Sample] Map client: " << store_->getNbPoints() << " points in the rebuilt map" << std::endl;
+}
@@ -0,0 +1,112 @@
+#include "map_protocol.h"
+#include "chunk_codec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace map_protocol
+{
+    namespace
+    {
+        /// Reserve the message in out and return its payload
+        uint8_t *appendMessage(MessageType type, size_t size, std::vector<uint8_t> &out)
+        {
+            MessageHeader header;
+            header.size = (uint32_t)size;
+            header.type = type;
+            header.flags = 0;
+            const size_t offset = out.size();
+            out.resize(offset + sizeof(header) + size);
+            memcpy(&out[offset], &header, sizeof(header));
+            return &out[offset + sizeof(header)];
+        }
+    }
+
+    void encodeHello(const Hello &hello, const std::vector<int32_t> &camera_models, std::vector<uint8_t> &out)
+    {
+        const size_t models_size = hello.nbSources * sizeof(int32_t);
+        uint8_t *payload = appendMessage(HELLO, sizeof(hello) + models_size, out);
+        memcpy(payload, &hello, sizeof(hello));
+        memset(payload + sizeof(hello), 0, models_size);
+        memcpy(payload + sizeof(hello), camera_models.data(), std::min(camera_models.size() * sizeof(int32_t), models_size));
+    }
+
+    bool decodeHello(const uint8_t *payload, size_t size, Hello &hello, std::vector<int32_t> &camera_models)
+    {
+        if (size < sizeof(hello))
+            return false;
+        memcpy(&hello, payload, sizeof(hello));
+        if (hello.magic != MAGIC || hello.version != VERSION || hello.nbSources == 0 ||
+            size != sizeof(hello) + (size_t)hello.nbSources * sizeof(int32_t))
+            return false;
+        camera_models.resize(hello.nbSources);
+        memcpy(camera_models.data(), payload + sizeof(hello), hello.nbSources * sizeof(int32_t));
+        return true;
+    }
+
+    void encodeSnapshotEnd(std::vector<uint8_t> &out)
+    {
+        appendMessage(SNAPSHOT_END, 0, out);
+    }
+
+    void encodePose(const Pose &pose, std::vector<uint8_t> &out)
+    {
+        memcpy(appendMessage(POSE, sizeof(pose), out), &pose, sizeof(pose));
+    }
+
+    void encodeChunk(int source, int index, const ChunkData &data, unsigned lod, float step, std::vector<uint8_t> &out)
+    {
+        const size_t stride = (size_t)1 << lod;
+        ChunkHeader header;
+        header.source = source;
+        header.index = index;
+        header.lod = lod;
+        header.nbPoints = (uint32_t)((data.points.size() + stride - 1) / stride);
+        header.nbPointsFull = (uint32_t)data.points.size();
+        header.bounds = data.bounds;
+
+        // The size of the message is only known once the points are encoded
+        const size_t offset = out.size();
+        memcpy(appendMessage(CHUNK, sizeof(header), out), &header, sizeof(header));
+        const size_t encoded_size = chunk_codec::encode(data.points.data(), data.points.size(), step, out, stride);
+        MessageHeader message;
+        memcpy(&message, &out[offset], sizeof(message));
+        message.size += (uint32_t)encoded_size;
+        memcpy(&out[offset], &message, sizeof(message));
+    }
+
+    bool decodeChunk(const uint8_t *payload, size_t size, ChunkHeader &header, std::vector<MapPoint> &points)
+    {
+        if (size < sizeof(header))
+            return false;
+        memcpy(&header, payload, sizeof(header));
+        return chunk_codec::decode(payload + sizeof(header), size - sizeof(header), points) && points.size() == header.nbPoints;
+    }
+
+    void MessageReader::append(const uint8_t *data, size_t size)
+    {
+        if (error_)
+            return;
+        // Drop the messages already read before growing
+        if (offset_)
+        {
+            buffer_.erase(buffer_.begin(), buffer_.begin() + offset_);
+            offset_ = 0;
+        }
+        buffer_.insert(buffer_.end(), data, data + size);
+    }
+
+    bool MessageReader::next(MessageHeader &header, const uint8_t *&payload)
+    {
+        if (buffer_.size() - offset_ < sizeof(header))
+            return false;
+        memcpy(&header, &buffer_[offset_], sizeof(header));
+        if (header.size > MAX_MESSAGE_SIZE)
+            error_ = true;
+        if (error_ || buffer_.size() - offset_ - sizeof(header) < header.size)
+            return false;
+        payload = &buffer_[offset_ + sizeof(header)];
+        offset_ += sizeof(header) + header.size;
+        return true;
+    }
+}
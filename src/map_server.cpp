@@ -0,0 +1,322 @@
+#include "map_server.h"
+#include "net_socket.h"
+#include "parallel_primitives.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+    /// Lowest LOD sent to slow clients, one point out of 2^MAX_LOD
+    const unsigned MAX_LOD = 3;
+    /// Backlog duration before lowering the LOD of a client
+    const std::chrono::milliseconds CONGESTION_DELAY(500);
+    /// Idle duration before sending the decimated chunks again at full resolution
+    const std::chrono::milliseconds REFINE_DELAY(1000);
+    /// Compressed size of a point, to batch the chunks which fit in the buffer of a client
+    const size_t EXPECTED_BYTES_PER_POINT = 4;
+}
+
+MapServer::~MapServer()
+{
+    stop();
+}
+
+bool MapServer::start(const std::string &endpoint, ChunkStore &store, const map_protocol::Hello &hello,
+                      const std::vector<int32_t> &camera_models, size_t client_buffer)
+{
+    if (isRunning())
+        return false;
+    listenFd_ = net::listenSocket(endpoint);
+    if (listenFd_ < 0)
+        return false;
+    endpoint_ = endpoint;
+    store_ = &store;
+    storeConsumer_ = store.addConsumer();
+    hello_ = hello;
+    cameraModels_ = camera_models;
+    clientBuffer_ = client_buffer;
+    poses_.clear();
+    for (int i = 0; i < store.getNbSources(); i++)
+        poses_.emplace_back(new SeqLock<map_protocol::Pose>());
+    stopping_ = false;
+    thread_ = std::thread(&MapServer::run, this);
+    std::cout << "[Sample] Serving the map on " << endpoint << std::endl;
+    return true;
+}
+
+void MapServer::stop(float flush_seconds)
+{
+    if (!thread_.joinable())
+        return;
+    flushDeadline_ = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(flush_seconds));
+    stopping_ = true;
+    thread_.join();
+    net::closeSocket(listenFd_);
+    listenFd_ = -1;
+}
+
+std::string MapServer::getLocalEndpoint() const
+{
+    return net::localEndpoint(endpoint_);
+}
+
+void MapServer::updatePose(const map_protocol::Pose &pose)
+{
+    map_protocol::Pose published = pose;
+    published.publishTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    poses_[pose.source]->store(published);
+}
+
+void MapServer::run()
+{
+    std::vector<net::PollEntry> entries;
+    std::vector<uint8_t> received(4096);
+    while (true)
+    {
+        // Wake up on new clients, client messages and free space in the sockets, the updates are polled
+        entries.clear();
+        entries.push_back({listenFd_, false, false, false, false});
+        for (const auto &it : clients_)
+            entries.push_back({it->fd, it->getBuffered() > 0, false, false, false});
+        net::pollSockets(entries, 5);
+
+        for (size_t i = 0; i < clients_.size(); i++)
+        {
+            Client &client = *clients_[i];
+            const net::PollEntry &entry = entries[i + 1];
+            if (entry.error)
+                disconnect(client, "connection error");
+            // Clients do not send anything yet, only detect their disconnection
+            while (client.fd >= 0 && entry.readable)
+            {
+                const long size = net::receiveSome(client.fd, received.data(), received.size());
+                if (size < 0)
+                    disconnect(client, "disconnected");
+                if (size <= 0)
+                    break;
+            }
+        }
+        if (!stopping_ && entries[0].readable)
+            accept();
+
+        store_->consumeUpdates(storeConsumer_, [this](const ChunkUpdate &update) {
+            for (auto &it : clients_)
+                enqueue(*it, key(update.source, update.index));
+        });
+
+        for (auto &it : clients_)
+        {
+            if (it->fd < 0)
+                continue;
+            fill(*it);
+            if (flush(*it))
+                adaptLod(*it);
+        }
+        for (size_t i = 0; i < clients_.size();)
+        {
+            if (clients_[i]->fd < 0)
+                clients_.erase(clients_.begin() + i);
+            else
+                i++;
+        }
+
+        // The updates consumed above are sent before stopping
+        if (stopping_)
+        {
+            bool idle = true;
+            for (const auto &it : clients_)
+                idle &= it->queue.empty() && !it->getBuffered();
+            if (idle || std::chrono::steady_clock::now() >= flushDeadline_)
+                break;
+        }
+    }
+
+    for (auto &it : clients_)
+        disconnect(*it, "server stopped");
+    clients_.clear();
+}
+
+void MapServer::accept()
+{
+    std::string peer;
+    int fd;
+    while ((fd = net::acceptSocket(listenFd_, peer)) >= 0)
+    {
+        // The backlog stays in the buffer of the client where it is visible, not in the kernel
+        net::setSendBuffer(fd, (int)std::min(clientBuffer_, (size_t)1 << 30));
+        std::unique_ptr<Client> client(new Client());
+        client->fd = fd;
+        client->peer = peer;
+        client->poseVersions.resize(poses_.size(), 0);
+        client->connectedAt = client->congestedSince = client->idleSince = std::chrono::steady_clock::now();
+        map_protocol::encodeHello(hello_, cameraModels_, client->out);
+        // The whole map first, then its updates
+        for (int source = 0; source < store_->getNbSources(); source++)
+        {
+            const int nb_chunks = store_->getNbChunks(source);
+            for (int index = 0; index < nb_chunks; index++)
+            {
+                client->queue.push_back(key(source, index));
+                client->queued.insert(key(source, index));
+            }
+        }
+        client->snapshotLeft = client->queue.size();
+        if (!client->snapshotLeft)
+            map_protocol::encodeSnapshotEnd(client->out);
+        std::cout << "[Sample] Map client connected: " << peer << std::endl;
+        clients_.push_back(std::move(client));
+    }
+}
+
+void MapServer::enqueue(Client &client, uint64_t chunk)
+{
+    if (client.queued.insert(chunk).second)
+        client.queue.push_back(chunk);
+    else
+        client.coalesced++;
+}
+
+void MapServer::fill(Client &client)
+{
+    // Poses are small, they only wait for a large backlog
+    if (client.getBuffered() < 2 * clientBuffer_)
+    {
+        for (size_t source = 0; source < poses_.size(); source++)
+        {
+            map_protocol::Pose pose;
+            const unsigned version = poses_[source]->load(pose);
+            if (version && version != client.poseVersions[source])
+            {
+                map_protocol::encodePose(pose, client.out);
+                client.poseVersions[source] = version;
+                client.poses++;
+            }
+        }
+    }
+
+    while (client.getBuffered() < clientBuffer_ && !client.queue.empty())
+    {
+        // A batch of chunks which should fit in the buffer, compressed on the worker pool
+        const size_t max_batch = 4 * (size_t)(ThreadPool::global().getNbWorkers() + 1);
+        size_t expected = client.getBuffered();
+        size_t nb_outgoing = 0;
+        while (expected < clientBuffer_ && !client.queue.empty() && nb_outgoing < max_batch)
+        {
+            const uint64_t chunk = client.queue.front();
+            client.queue.pop_front();
+            client.queued.erase(chunk);
+            if (nb_outgoing == outgoing_.size())
+                outgoing_.emplace_back();
+            Outgoing &out = outgoing_[nb_outgoing++];
+            out.chunk = chunk;
+            out.snapshotEnd = client.snapshotLeft && --client.snapshotLeft == 0;
+            // Latest content, possibly read back from disk
+            out.data = store_->get((int)(chunk >> 32), (int)(uint32_t)chunk, false);
+            if (out.data)
+                expected += (out.data->points.size() >> client.lod) * EXPECTED_BYTES_PER_POINT;
+        }
+        parallel::forEach(nb_outgoing, [&](size_t i) {
+            Outgoing &out = outgoing_[i];
+            out.message.clear();
+            if (out.data)
+                map_protocol::encodeChunk((int)(out.chunk >> 32), (int)(uint32_t)out.chunk, *out.data, client.lod, hello_.quantizationStep, out.message);
+        }, 0, ThreadPool::HIGH);
+
+        for (size_t i = 0; i < nb_outgoing; i++)
+        {
+            Outgoing &out = outgoing_[i];
+            client.out.insert(client.out.end(), out.message.begin(), out.message.end());
+            if (out.snapshotEnd)
+                map_protocol::encodeSnapshotEnd(client.out);
+            if (!out.data)
+                continue;
+            out.data.reset();
+            client.chunks++;
+            if (client.lod)
+            {
+                client.decimated++;
+                client.degraded.insert(out.chunk);
+            }
+            else
+                client.degraded.erase(out.chunk);
+        }
+    }
+}
+
+void MapServer::adaptLod(Client &client)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    // The backlog keeps growing: send fewer points per chunk
+    const bool congested = !client.queue.empty() && client.getBuffered() >= clientBuffer_;
+    if (!congested)
+        client.congestedSince = now;
+    else if (now - client.congestedSince > CONGESTION_DELAY && client.lod < MAX_LOD)
+    {
+        client.lod++;
+        client.maxLod = std::max(client.maxLod, client.lod);
+        client.congestedSince = now;
+    }
+
+    // Caught up: refine what was decimated
+    const bool idle = client.queue.empty() && client.getBuffered() < clientBuffer_ / 2;
+    if (!idle || (!client.lod && client.degraded.empty()))
+        client.idleSince = now;
+    else if (now - client.idleSince > REFINE_DELAY)
+    {
+        client.lod = 0;
+        for (uint64_t chunk : client.degraded)
+            enqueue(client, chunk);
+        client.degraded.clear();
+        client.idleSince = now;
+    }
+}
+
+bool MapServer::flush(Client &client)
+{
+    while (client.getBuffered())
+    {
+        const long size = net::sendSome(client.fd, &client.out[client.sent], client.getBuffered());
+        if (size < 0)
+        {
+            disconnect(client, "disconnected");
+            return false;
+        }
+        if (size == 0)
+            break;
+        client.sent += size;
+        client.bytes += size;
+    }
+    // Keep the buffer bounded without moving it at every send
+    if (client.sent == client.out.size())
+    {
+        client.out.clear();
+        client.sent = 0;
+    }
+    else if (client.sent > clientBuffer_)
+    {
+        client.out.erase(client.out.begin(), client.out.begin() + client.sent);
+        client.sent = 0;
+    }
+    return true;
+}
+
+void MapServer::disconnect(Client &client, const char *reason)
+{
+    if (client.fd < 0)
+        return;
+    net::closeSocket(client.fd);
+    client.fd = -1;
+    std::cout << "[Sample] Map client " << client.peer << " " << reason << std::endl;
+    printStats(client);
+}
+
+void MapServer::printStats(const Client &client) const
+{
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - client.connectedAt).count();
+    std::cout << "[Sample] Map client " << client.peer << ": " << (client.bytes >> 20) << " MB sent ("
+              << (seconds > 0. ? client.bytes * 8. / seconds / 1e6 : 0.) << " Mbit/s), " << client.chunks << " chunks ("
+              << client.decimated << " decimated, lowest LOD 1/" << (1u << client.maxLod) << "), " << client.coalesced
+              << " updates coalesced, " << client.poses << " poses" << std::endl;
+}
@@ -0,0 +1,32 @@
+#include "morton_order.h"
+#include "parallel_primitives.h"
+
+namespace morton
+{
+    namespace
+    {
+        inline uint32_t toCell(float v, float inv_cell)
+        {
+            const float c = v * inv_cell;
+            // Also maps NaN to 0
+            if (!(c > 0.f))
+                return 0;
+            return c < (float)(MAX_CELLS - 1) ? (uint32_t)c : MAX_CELLS - 1;
+        }
+    }
+
+    void sortOrder(const MapPoint *points, size_t n, const float origin[3], float cell_size, uint32_t *order)
+    {
+        ScratchScope scope;
+        const float inv_cell = cell_size > 0.f ? 1.f / cell_size : 0.f;
+        uint64_t *codes = scope.getArena().allocate<uint64_t>(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            const MapPoint &p = points[i];
+            codes[i] = encode(toCell(p.x - origin[0], inv_cell), toCell(p.y - origin[1], inv_cell), toCell(p.z - origin[2], inv_cell));
+            order[i] = (uint32_t)i;
+        }
+        parallel::radixSort(codes, order, n);
+        scope.getArena().deallocate(codes, n * sizeof(uint64_t));
+    }
+}
@@ -0,0 +1,269 @@
+#include "net_socket.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#if defined(_WIN32)
+
+namespace net
+{
+    int listenSocket(const std::string &)
+    {
+        std::cout << "[Sample][Error] The map stream is not supported on Windows" << std::endl;
+        return -1;
+    }
+    int acceptSocket(int, std::string &) { return -1; }
+    int connectSocket(const std::string &)
+    {
+        std::cout << "[Sample][Error] The map stream is not supported on Windows" << std::endl;
+        return -1;
+    }
+    std::string localEndpoint(const std::string &endpoint) { return endpoint; }
+    bool setNonBlocking(int) { return false; }
+    void setSendBuffer(int, int) {}
+    bool waitReadable(int, int) { return false; }
+    bool pollSockets(std::vector<PollEntry> &, int) { return false; }
+    void closeSocket(int) {}
+    long sendSome(int, const void *, size_t) { return -1; }
+    long receiveSome(int, void *, size_t) { return -1; }
+}
+
+#else
+
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace net
+{
+    namespace
+    {
+        const char UNIX_PREFIX[] = "unix:";
+
+        bool isUnix(const std::string &endpoint, std::string &path)
+        {
+            if (endpoint.compare(0, sizeof(UNIX_PREFIX) - 1, UNIX_PREFIX) != 0)
+                return false;
+            path = endpoint.substr(sizeof(UNIX_PREFIX) - 1);
+            return true;
+        }
+
+        bool unixAddress(const std::string &path, sockaddr_un &addr)
+        {
+            memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            if (path.empty() || path.size() >= sizeof(addr.sun_path))
+            {
+                std::cout << "[Sample][Error] Invalid socket path '" << path << "'" << std::endl;
+                return false;
+            }
+            memcpy(addr.sun_path, path.c_str(), path.size());
+            return true;
+        }
+
+        int fail(const std::string &what, int fd = -1)
+        {
+            std::cout << "[Sample][Error] " << what << ": " << strerror(errno) << std::endl;
+            if (fd >= 0)
+                close(fd);
+            return -1;
+        }
+    }
+
+    int listenSocket(const std::string &endpoint)
+    {
+        std::string path;
+        int fd;
+        if (isUnix(endpoint, path))
+        {
+            sockaddr_un addr;
+            if (!unixAddress(path, addr))
+                return -1;
+            fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0)
+                return fail("Unable to create a socket");
+            // Left over by a previous run
+            unlink(path.c_str());
+            if (bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0)
+                return fail("Unable to bind " + endpoint, fd);
+        }
+        else
+        {
+            int port;
+            char end;
+            if (sscanf(endpoint.c_str(), "%d%c", &port, &end) != 1 || port <= 0 || port > 65535)
+            {
+                std::cout << "[Sample][Error] Invalid endpoint '" << endpoint << "', expected <port> or unix:<path>" << std::endl;
+                return -1;
+            }
+            fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (fd < 0)
+                return fail("Unable to create a socket");
+            int yes = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+            sockaddr_in addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+            addr.sin_port = htons((uint16_t)port);
+            if (bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0)
+                return fail("Unable to bind port " + endpoint, fd);
+        }
+        if (listen(fd, 8) != 0)
+            return fail("Unable to listen on " + endpoint, fd);
+        if (!setNonBlocking(fd))
+            return fail("Unable to configure the socket", fd);
+        return fd;
+    }
+
+    int acceptSocket(int listen_fd, std::string &peer)
+    {
+        sockaddr_storage addr;
+        socklen_t size = sizeof(addr);
+        const int fd = accept(listen_fd, (sockaddr *)&addr, &size);
+        if (fd < 0)
+            return -1;
+        if (!setNonBlocking(fd))
+            return fail("Unable to configure the socket", fd);
+
+        char host[NI_MAXHOST] = "local", port[NI_MAXSERV] = "";
+        if (addr.ss_family != AF_UNIX)
+        {
+            // Small messages (poses) must not wait for more data
+            int yes = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+            getnameinfo((sockaddr *)&addr, size, host, sizeof(host), port, sizeof(port), NI_NUMERICHOST | NI_NUMERICSERV);
+        }
+#if defined(SO_NOSIGPIPE)
+        int yes = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+        peer = std::string(host) + (port[0] ? ":" + std::string(port) : "");
+        return fd;
+    }
+
+    int connectSocket(const std::string &endpoint)
+    {
+        std::string path;
+        if (isUnix(endpoint, path))
+        {
+            sockaddr_un addr;
+            if (!unixAddress(path, addr))
+                return -1;
+            const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0)
+                return fail("Unable to create a socket");
+            if (connect(fd, (sockaddr *)&addr, sizeof(addr)) != 0)
+                return fail("Unable to connect to " + endpoint, fd);
+            return fd;
+        }
+
+        const size_t sep = endpoint.rfind(':');
+        if (sep == std::string::npos)
+        {
+            std::cout << "[Sample][Error] Invalid endpoint '" << endpoint << "', expected <host>:<port> or unix:<path>" << std::endl;
+            return -1;
+        }
+        addrinfo hints, *result = nullptr;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        if (getaddrinfo(endpoint.substr(0, sep).c_str(), endpoint.substr(sep + 1).c_str(), &hints, &result) != 0 || !result)
+        {
+            std::cout << "[Sample][Error] Unable to resolve " << endpoint << std::endl;
+            return -1;
+        }
+        int fd = -1;
+        for (addrinfo *it = result; it && fd < 0; it = it->ai_next)
+        {
+            fd = socket(it->ai_family, it->ai_socktype, it->ai_protocol);
+            if (fd >= 0 && connect(fd, it->ai_addr, it->ai_addrlen) != 0)
+            {
+                close(fd);
+                fd = -1;
+            }
+        }
+        freeaddrinfo(result);
+        if (fd < 0)
+            return fail("Unable to connect to " + endpoint);
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        return fd;
+    }
+
+    std::string localEndpoint(const std::string &endpoint)
+    {
+        std::string path;
+        return isUnix(endpoint, path) ? endpoint : "127.0.0.1:" + endpoint;
+    }
+
+    bool setNonBlocking(int fd)
+    {
+        const int flags = fcntl(fd, F_GETFL, 0);
+        return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+
+    void setSendBuffer(int fd, int bytes)
+    {
+        setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &bytes, sizeof(bytes));
+    }
+
+    bool waitReadable(int fd, int timeout_ms)
+    {
+        pollfd p = {fd, POLLIN, 0};
+        return poll(&p, 1, timeout_ms) > 0;
+    }
+
+    void closeSocket(int fd)
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+
+    bool pollSockets(std::vector<PollEntry> &entries, int timeout_ms)
+    {
+        std::vector<pollfd> fds(entries.size());
+        for (size_t i = 0; i < entries.size(); i++)
+            fds[i] = {entries[i].fd, (short)(POLLIN | (entries[i].wantWrite ? POLLOUT : 0)), 0};
+        const int ready = poll(fds.data(), fds.size(), timeout_ms);
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            entries[i].readable = ready > 0 && (fds[i].revents & POLLIN);
+            entries[i].writable = ready > 0 && (fds[i].revents & POLLOUT);
+            entries[i].error = ready > 0 && (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL));
+        }
+        return ready > 0;
+    }
+
+    long sendSome(int fd, const void *data, size_t size)
+    {
+#if defined(MSG_NOSIGNAL)
+        const int flags = MSG_NOSIGNAL | MSG_DONTWAIT;
+#else
+        const int flags = MSG_DONTWAIT;
+#endif
+        const ssize_t sent = send(fd, data, size, flags);
+        if (sent >= 0)
+            return (long)sent;
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? 0 : -1;
+    }
+
+    long receiveSome(int fd, void *data, size_t size)
+    {
+        const ssize_t received = recv(fd, data, size, 0);
+        if (received > 0)
+            return (long)received;
+        if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+            return 0;
+        return -1;
+    }
+}
+
+#endif
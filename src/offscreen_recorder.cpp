@@ -0,0 +1,201 @@
+#include "offscreen_recorder.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <iostream>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+OffscreenRecorder::OffscreenRecorder() : enabled_(false), nextPbo_(0), nb_captured_(0), nb_dropped_(0), pipe_(nullptr), stop_(false)
+{
+    for (int i = 0; i < NB_PBO; i++)
+    {
+        pboID_[i] = 0;
+        fences_[i] = 0;
+    }
+}
+
+OffscreenRecorder::~OffscreenRecorder()
+{
+    if (!enabled_)
+        return;
+
+    // Flush the frames still in flight
+    collect(true);
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    if (writer_.joinable())
+        writer_.join();
+    if (pipe_)
+        pclose(pipe_);
+
+    glDeleteBuffers(NB_PBO, pboID_);
+    std::cout << "[Sample] Offscreen rendering: " << nb_captured_ << " frames captured, " << nb_dropped_ << " dropped" << std::endl;
+}
+
+bool OffscreenRecorder::init(const OffscreenParameters &params)
+{
+    params_ = params;
+    if (params_.output.empty() || params_.width <= 0 || params_.height <= 0)
+        return false;
+
+    if (!target_.resize(params_.width, params_.height))
+        return false;
+
+    if (params_.output[0] == '|')
+    {
+        pipe_ = popen(params_.output.substr(1).c_str(), "w");
+        if (!pipe_)
+        {
+            std::cout << "ERROR: unable to start the encoder: " << params_.output.substr(1) << std::endl;
+            return false;
+        }
+    }
+
+    const size_t frame_size = (size_t)params_.width * params_.height * 4;
+    glGenBuffers(NB_PBO, pboID_);
+    for (int i = 0; i < NB_PBO; i++)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pboID_[i]);
+        glBufferData(GL_PIXEL_PACK_BUFFER, frame_size, 0, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    writer_ = std::thread(&OffscreenRecorder::writerLoop, this);
+    enabled_ = true;
+    return true;
+}
+
+bool OffscreenRecorder::frameDue() const
+{
+    if (params_.fps <= 0.f)
+        return true;
+    auto elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - ts_last_).count();
+    return elapsed >= 1.f / params_.fps;
+}
+
+std::chrono::steady_clock::time_point OffscreenRecorder::nextFrameTime() const
+{
+    if (params_.fps <= 0.f)
+        return ts_last_;
+    return ts_last_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(1.f / params_.fps));
+}
+
+void OffscreenRecorder::begin()
+{
+    ts_last_ = std::chrono::steady_clock::now();
+    target_.bind();
+}
+
+void OffscreenRecorder::end()
+{
+    // Pick up the frames whose transfer is done, then reuse the oldest buffer if it is free
+    collect(false);
+    if (fences_[nextPbo_])
+    {
+        // The GPU is more than NB_PBO frames behind, skip this one rather than stalling
+        nb_dropped_++;
+        FrameBuffer::unbind();
+        return;
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, target_.getId());
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pboID_[nextPbo_]);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, params_.width, params_.height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    fences_[nextPbo_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    nextPbo_ = (nextPbo_ + 1) % NB_PBO;
+
+    FrameBuffer::unbind();
+}
+
+void OffscreenRecorder::collect(bool wait)
+{
+    const size_t frame_size = (size_t)params_.width * params_.height * 4;
+    // Buffers complete in submission order, start from the oldest one
+    for (int n = 0; n < NB_PBO; n++)
+    {
+        const int i = (nextPbo_ + n) % NB_PBO;
+        if (!fences_[i])
+            continue;
+
+        GLenum res = glClientWaitSync(fences_[i], GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GL_TIMEOUT_IGNORED : 0);
+        if (res == GL_TIMEOUT_EXPIRED)
+            break;
+        glDeleteSync(fences_[i]);
+        fences_[i] = 0;
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pboID_[i]);
+        auto *ptr = (const unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frame_size, GL_MAP_READ_BIT);
+        if (ptr)
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            if (frames_.size() < (size_t)params_.queue_size)
+            {
+                frames_.emplace_back(nb_captured_++, std::vector<unsigned char>(ptr, ptr + frame_size));
+                cv_.notify_one();
+            }
+            else
+                nb_dropped_++;
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+}
+
+void OffscreenRecorder::writerLoop()
+{
+    while (true)
+    {
+        std::pair<unsigned long long, std::vector<unsigned char>> frame;
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            cv_.wait(lock, [this] { return stop_ || !frames_.empty(); });
+            if (frames_.empty())
+                return;
+            frame = std::move(frames_.front());
+            frames_.pop_front();
+        }
+        writeFrame(frame.second, frame.first);
+    }
+}
+
+void OffscreenRecorder::writeFrame(const std::vector<unsigned char> &frame, unsigned long long id)
+{
+    // OpenGL rows are bottom-up: pipes get the raw buffer (use a vflip filter on the encoder side)
+    if (pipe_)
+    {
+        fwrite(frame.data(), 1, frame.size(), pipe_);
+        return;
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "/frame_%06llu.%s", id, params_.raw ? "rgba" : "png");
+    const std::string path = params_.output + name;
+
+    if (params_.raw)
+    {
+        FILE *f = fopen(path.c_str(), "wb");
+        if (f)
+        {
+            fwrite(frame.data(), 1, frame.size(), f);
+            fclose(f);
+        }
+        return;
+    }
+
+    cv::Mat rgba(params_.height, params_.width, CV_8UC4, (void *)frame.data());
+    cv::Mat bgr, flipped;
+    cv::cvtColor(rgba, bgr, cv::COLOR_RGBA2BGR);
+    cv::flip(bgr, flipped, 0);
+    if (!cv::imwrite(path, flipped))
+        std::cout << "ERROR: unable to write " << path << std::endl;
+}
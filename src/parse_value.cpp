@@ -0,0 +1,23 @@
+#include "parse_value.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace parse_value
+{
+    bool toInt(const std::string &value, int &out)
+    {
+        char end;
+        return sscanf(value.c_str(), "%d%c", &out, &end) == 1;
+    }
+
+    bool toFloat(const std::string &value, float &out)
+    {
+        char end;
+        float v;
+        if (sscanf(value.c_str(), "%f%c", &v, &end) != 1 || !std::isfinite(v))
+            return false;
+        out = v;
+        return true;
+    }
+}
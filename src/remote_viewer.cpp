@@ -0,0 +1,198 @@
+/**********************************************************************************
+ ** Remote viewer: display the map streamed by the mapping sample (--serve)      **
+ ** without the ZED SDK nor CUDA.                                                **
+ **********************************************************************************/
+
+#include "gl_viewer.h"
+#include "chunk_codec.h"
+#include "map_client.h"
+#include "parse_value.h"
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+    struct ViewerOptions
+    {
+        std::string endpoint;
+        bool edl = false;
+        float fps = 30.f;
+        int gpu_budget_mb = 1024;
+        int gpu_upload_budget_mb = 64;
+        float lod_size = 64.f;
+        float source_tint = 0.35f;
+        /// Stop after this duration in seconds, 0 to run until the window is closed
+        float duration = 0.f;
+        OffscreenParameters offscreen;
+    };
+
+    void printUsage(const char *name)
+    {
+        std::cout << "Usage: " << name << " <host>:<port> | unix:<path> | <recording.zmap> [options]\n"
+                  << "  --edl                  enable the Eye-Dome Lighting at start\n"
+                  << "  --fps <fps>            maximum frames drawn per second (30)\n"
+                  << "  --gpu-budget <MB>      VRAM used by the map chunks (1024)\n"
+                  << "  --gpu-upload <MB>      chunks uploaded per frame (64)\n"
+                  << "  --lod-size <pixels>    chunks smaller than this on screen are decimated (64)\n"
+                  << "  --tint <amount>        tint of the points with the color of their source (0.35)\n"
+                  << "  --duration <seconds>   disconnect after this duration (0: until the window is closed)\n"
+                  << "  --offscreen <dir>      render offscreen and write the frames to dir (or |<command>)" << std::endl;
+    }
+
+    bool parseArgs(int argc, char **argv, ViewerOptions &options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg = argv[i];
+            const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+            bool ok = true;
+            if (arg == "--edl")
+                options.edl = true;
+            else if (arg == "--fps" && value)
+                ok = parse_value::toFloat(argv[++i], options.fps) && options.fps >= 0.f;
+            else if (arg == "--gpu-budget" && value)
+                ok = parse_value::toInt(argv[++i], options.gpu_budget_mb) && options.gpu_budget_mb >= 0;
+            else if (arg == "--gpu-upload" && value)
+                ok = parse_value::toInt(argv[++i], options.gpu_upload_budget_mb) && options.gpu_upload_budget_mb >= 0;
+            else if (arg == "--lod-size" && value)
+                ok = parse_value::toFloat(argv[++i], options.lod_size) && options.lod_size >= 0.f;
+            else if (arg == "--tint" && value)
+                ok = parse_value::toFloat(argv[++i], options.source_tint) && options.source_tint >= 0.f && options.source_tint <= 1.f;
+            else if (arg == "--duration" && value)
+                ok = parse_value::toFloat(argv[++i], options.duration) && options.duration >= 0.f;
+            else if (arg == "--offscreen" && value)
+                options.offscreen.output = argv[++i];
+            else if (arg[0] != '-' && options.endpoint.empty())
+                options.endpoint = arg;
+            else
+            {
+                std::cout << "[Sample][Error] Unknown option " << arg << std::endl;
+                return false;
+            }
+            if (!ok)
+            {
+                std::cout << "[Sample][Error] Invalid value for " << arg << ": " << argv[i] << std::endl;
+                return false;
+            }
+        }
+        return !options.endpoint.empty();
+    }
+
+    bool isRecording(const std::string &path)
+    {
+        const std::string extension = ".zmap";
+        return path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+    }
+
+    /// Read a whole map recording in a new store
+    std::unique_ptr<ChunkStore> loadRecording(const std::string &path, chunk_codec::StreamInfo &info)
+    {
+        chunk_codec::StreamReader reader;
+        if (!reader.open(path))
+            return nullptr;
+        info = reader.getInfo();
+        std::unique_ptr<ChunkStore> store(new ChunkStore(info.nbSources, info.mapResolution * 16.f));
+        const auto start = std::chrono::steady_clock::now();
+        size_t nb_points = 0;
+        while (reader.read([&](int source, int index, std::vector<MapPoint> &points) {
+            store->update(source, {{index, points.data(), points.size()}});
+            nb_points += points.size();
+        }))
+            ;
+        if (!reader.isValid())
+            std::cout << "[Sample][Error] " << path << " is truncated or corrupted, only its beginning is displayed" << std::endl;
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[Sample] Read " << nb_points << " points from " << path << " in " << seconds * 1e3 << " ms ("
+                  << (seconds > 0. ? nb_points / seconds / 1e6 : 0.) << " M points/s)" << std::endl;
+        return store;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ViewerOptions options;
+    if (!parseArgs(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // A recorded map is displayed as is, a remote one is updated as it is received
+    const bool playback = isRecording(options.endpoint);
+    MapClient client;
+    std::unique_ptr<ChunkStore> recording;
+    ChunkStore *store;
+    float map_resolution;
+    std::vector<int32_t> model_ids;
+    if (playback)
+    {
+        chunk_codec::StreamInfo info;
+        recording = loadRecording(options.endpoint, info);
+        if (!recording)
+            return EXIT_FAILURE;
+        store = recording.get();
+        map_resolution = info.mapResolution;
+        model_ids = info.cameraModels;
+    }
+    else
+    {
+        if (!client.connect(options.endpoint))
+            return EXIT_FAILURE;
+        store = &client.getStore();
+        map_resolution = client.getHello().mapResolution;
+        model_ids = client.getCameraModels();
+    }
+
+    std::vector<CameraModel> models;
+    for (int32_t model : model_ids)
+        models.push_back((CameraModel)model);
+
+    GLViewer viewer;
+    GLenum errgl = viewer.init(argc, argv, store, models, options.offscreen);
+    if (errgl != GLEW_OK)
+    {
+        std::cout << "[Sample][Error] OpenGL: " << glewGetErrorString(errgl) << std::endl;
+        return EXIT_FAILURE;
+    }
+    viewer.setEDL(options.edl);
+    viewer.setTargetFPS(options.fps);
+    viewer.setSourceTint(options.source_tint);
+    viewer.setGpuBudget((size_t)options.gpu_budget_mb << 20, (size_t)options.gpu_upload_budget_mb << 20);
+    viewer.setMapResolution(map_resolution);
+    viewer.setLodSize(options.lod_size);
+
+    // Poses are received on the thread of the client, always the same one as required by the viewer
+    if (!playback)
+        client.start([&viewer](const map_protocol::Pose &pose) {
+            PoseSample sample;
+            memcpy(sample.translation, pose.translation, sizeof(sample.translation));
+            memcpy(sample.orientation, pose.orientation, sizeof(sample.orientation));
+            sample.state = (TrackingState)pose.state;
+            viewer.updatePose(pose.source, sample);
+        });
+
+    // The map stays displayed when the server stops, until the window is closed
+    const auto start = std::chrono::steady_clock::now();
+    bool reported_snapshot = false;
+    while (viewer.isAvailable())
+    {
+        if (!playback && !reported_snapshot && client.hasSnapshot())
+        {
+            client.report();
+            reported_snapshot = true;
+        }
+        if (options.duration > 0.f && std::chrono::steady_clock::now() - start > std::chrono::duration<float>(options.duration))
+            viewer.exit();
+        viewer.waitForFrame();
+    }
+
+    if (!playback)
+    {
+        client.stop();
+        client.report();
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+#include "render_state.h"
+
+#include <algorithm>
+#include <iostream>
+
+RenderState::RenderState()
+    : uboID_(0), currentProgram_(0), currentVao_(0), nbFrames_(0), nbDraws_(0), nbProgramChanges_(0), nbVaoChanges_(0), nbSkippedBinds_(0)
+{
+}
+
+RenderState::~RenderState()
+{
+    if (uboID_)
+        glDeleteBuffers(1, &uboID_);
+}
+
+void RenderState::init()
+{
+    glGenBuffers(1, &uboID_);
+    glBindBuffer(GL_UNIFORM_BUFFER, uboID_);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameUniforms), 0, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, FRAME_DATA_BINDING, uboID_);
+}
+
+void RenderState::registerProgram(GLuint program)
+{
+    GLuint index = glGetUniformBlockIndex(program, "FrameData");
+    if (index != GL_INVALID_INDEX)
+        glUniformBlockBinding(program, index, FRAME_DATA_BINDING);
+}
+
+void RenderState::beginFrame(const FrameUniforms &uniforms)
+{
+    glBindBuffer(GL_UNIFORM_BUFFER, uboID_);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniforms), &uniforms);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    queue_.clear();
+}
+
+void RenderState::submit(GLuint program, std::function<void()> draw)
+{
+    queue_.push_back({program, std::move(draw)});
+}
+
+void RenderState::endFrame()
+{
+    // Stable so that draws of the same program keep their submission order
+    std::stable_sort(queue_.begin(), queue_.end(), [](const DrawItem &a, const DrawItem &b) { return a.program < b.program; });
+    for (auto &it : queue_)
+    {
+        useProgram(it.program);
+        it.draw();
+    }
+    queue_.clear();
+    nbFrames_++;
+}
+
+void RenderState::useProgram(GLuint program)
+{
+    if (program != currentProgram_)
+    {
+        glUseProgram(program);
+        currentProgram_ = program;
+        nbProgramChanges_++;
+    }
+    else
+        nbSkippedBinds_++;
+}
+
+void RenderState::bindVertexArray(GLuint vao)
+{
+    if (vao != currentVao_)
+    {
+        glBindVertexArray(vao);
+        currentVao_ = vao;
+        nbVaoChanges_++;
+    }
+    else
+        nbSkippedBinds_++;
+}
+
+void RenderState::deleteVertexArray(GLuint vao)
+{
+    if (!vao)
+        return;
+    // Deleting the bound vertex array binds 0
+    if (vao == currentVao_)
+        currentVao_ = 0;
+    glDeleteVertexArrays(1, &vao);
+}
+
+void RenderState::drawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    glDrawArrays(mode, first, count);
+    nbDraws_++;
+}
+
+void RenderState::drawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    glDrawElements(mode, count, type, indices);
+    nbDraws_++;
+}
+
+void RenderState::report() const
+{
+    if (!nbFrames_)
+        return;
+    const double frames = (double)nbFrames_;
+    std::cout << "[Sample] Render state per frame: " << nbDraws_ / frames << " draw calls, " << nbProgramChanges_ / frames << " program changes, "
+              << nbVaoChanges_ / frames << " vertex array changes, " << nbSkippedBinds_ / frames << " redundant binds skipped" << std::endl;
+}
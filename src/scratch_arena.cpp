@@ -0,0 +1,113 @@
+#include "scratch_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+    const uintptr_t CACHE_LINE = 64;
+
+    /// Smallest class holding bytes
+    int sizeClass(size_t bytes, int min_class)
+    {
+        int c = min_class;
+        while (((size_t)1 << c) < bytes)
+            c++;
+        return c;
+    }
+}
+
+ScratchArena::ScratchArena(size_t block_size) : blockSize_(block_size)
+{
+}
+
+ScratchArena &ScratchArena::local()
+{
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+void *ScratchArena::allocate(size_t bytes)
+{
+    const int c = sizeClass(std::max<size_t>(bytes, 1), MIN_CLASS);
+    void *&free_list = freeLists_[c - MIN_CLASS];
+    if (free_list)
+    {
+        void *p = free_list;
+        free_list = *static_cast<void **>(p);
+        return p;
+    }
+
+    // Sizes are multiples of 64 bytes from the start of blocks aligned on 64 bytes
+    const size_t size = (size_t)1 << c;
+    while (block_ < blocks_.size() && offset_ + size > blocks_[block_].size)
+    {
+        block_++;
+        offset_ = 0;
+    }
+    if (block_ == blocks_.size())
+    {
+        Block block;
+        block.size = std::max(blockSize_, size);
+        // Aligned by hand rather than with aligned::allocate, so that the blocks go through operator new and are counted
+        block.storage.reset(new unsigned char[block.size + CACHE_LINE - 1]);
+        block.data = block.storage.get() + (CACHE_LINE - (uintptr_t)block.storage.get() % CACHE_LINE) % CACHE_LINE;
+        blocks_.push_back(std::move(block));
+    }
+    void *p = blocks_[block_].data + offset_;
+    offset_ += size;
+    used_ += size;
+    peak_ = std::max(peak_, used_);
+    return p;
+}
+
+void ScratchArena::deallocate(void *p, size_t bytes)
+{
+    if (!p)
+        return;
+    void *&free_list = freeLists_[sizeClass(std::max<size_t>(bytes, 1), MIN_CLASS) - MIN_CLASS];
+    *static_cast<void **>(p) = free_list;
+    free_list = p;
+}
+
+void ScratchArena::reset()
+{
+    // The blocks are filled in order, the ones before the bump position were all needed
+    if (used_)
+        periodBlocks_ = std::max(periodBlocks_, block_ + 1);
+    block_ = 0;
+    offset_ = 0;
+    used_ = 0;
+    std::fill(freeLists_, freeLists_ + NB_CLASSES, nullptr);
+    if (++nbResets_ >= TRIM_PERIOD)
+    {
+        releaseBlocks(periodBlocks_);
+        periodBlocks_ = 0;
+        nbResets_ = 0;
+    }
+}
+
+void ScratchArena::trim(size_t keep_bytes)
+{
+    if (used_ || depth_ > 0)
+        return;
+    size_t kept = 0, capacity = 0;
+    while (kept < blocks_.size() && capacity < keep_bytes)
+        capacity += blocks_[kept++].size;
+    releaseBlocks(kept);
+}
+
+void ScratchArena::releaseBlocks(size_t nb_kept)
+{
+    if (nb_kept < blocks_.size())
+        blocks_.resize(nb_kept);
+    std::fill(freeLists_, freeLists_ + NB_CLASSES, nullptr);
+}
+
+size_t ScratchArena::getCapacity() const
+{
+    size_t capacity = 0;
+    for (const auto &it : blocks_)
+        capacity += it.size;
+    return capacity;
+}
@@ -2,28 +2,42 @@
 
 #include <iostream>
 
+// Per-frame uniforms shared by all the shaders, see FrameUniforms
+#define FRAME_DATA_BLOCK                                  \
+    "layout(std140, row_major) uniform FrameData {\n"     \
+    "   mat4 u_vpMatrix;\n"                               \
+    "   float u_pointScale;\n"                            \
+    "   float u_voxelSize;\n"                             \
+    "   float u_maxPointSize;\n"                          \
+    "};\n"
+
 GLchar *VERTEX_SHADER =
     "#version 330 core\n"
     "layout(location = 0) in vec3 in_Vertex;\n"
     "layout(location = 1) in vec3 in_Color;\n"
-    "uniform mat4 u_mvpMatrix;\n"
+    FRAME_DATA_BLOCK
+    "uniform mat4 u_modelMatrix;\n"
     "out vec3 b_color;\n"
     "void main() {\n"
     "   b_color = in_Color;\n"
-    "	gl_Position = u_mvpMatrix * vec4(in_Vertex, 1);\n"
+    "	gl_Position = u_vpMatrix * u_modelMatrix * vec4(in_Vertex, 1);\n"
     "}";
 
 GLchar *FPC_VERTEX_SHADER =
     "#version 330 core\n"
-    "layout(location = 0) in vec4 in_VertexRGBA;\n"
-    "uniform mat4 u_mvpMatrix;\n"
-    "uniform float pointsize;\n"
+    "layout(location = 0) in vec3 in_Vertex;\n"
+    "layout(location = 1) in vec3 in_Color;\n"
+    FRAME_DATA_BLOCK
+    "// color of the source and how much it tints the points\n"
+    "uniform vec4 u_tint;\n"
+    "// larger splats when only a part of the points is drawn\n"
+    "uniform float u_lodScale;\n"
     "out vec3 b_color;\n"
     "void main() {\n"
-    "   uint vertexColor = floatBitsToUint(in_VertexRGBA.w); \n"
-    "   b_color = vec3(((vertexColor & uint(0x00FF0000)) >> 16) / 255.f, ((vertexColor & uint(0x0000FF00)) >> 8) / 255.f, (vertexColor & uint(0x000000FF)) / 255.f);\n"
-    "	gl_Position = u_mvpMatrix * vec4(in_VertexRGBA.xyz, 1);\n"
-    "   gl_PointSize = pointsize;\n"
+    "   b_color = mix(in_Color, u_tint.rgb, u_tint.a);\n"
+    "	gl_Position = u_vpMatrix * vec4(in_Vertex, 1);\n"
+    "   // projected size of a voxel, w is the distance to the eye along the view axis\n"
+    "   gl_PointSize = clamp(u_voxelSize * u_pointScale * u_lodScale / gl_Position.w, 1.0, u_maxPointSize);\n"
     "}";
 
 GLchar *FRAGMENT_SHADER =
@@ -34,6 +48,56 @@ GLchar *FRAGMENT_SHADER =
     "   out_Color = vec4(b_color, 1);\n"
     "}";
 
+GLchar *FULLSCREEN_VERTEX_SHADER =
+    "#version 330 core\n"
+    "out vec2 b_uv;\n"
+    "void main() {\n"
+    "   b_uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+    "   gl_Position = vec4(b_uv * 2.0 - 1.0, 0, 1);\n"
+    "}";
+
+GLchar *EDL_FRAGMENT_SHADER =
+    "#version 330 core\n"
+    "in vec2 b_uv;\n"
+    "uniform sampler2D u_color;\n"
+    "uniform sampler2D u_depth;\n"
+    "uniform vec2 u_pixelSize;\n"
+    "uniform float u_zNear;\n"
+    "uniform float u_zFar;\n"
+    "uniform float u_strength;\n"
+    "uniform float u_radius;\n"
+    "layout(location = 0) out vec4 out_Color;\n"
+    "const vec2 neighbours[8] = vec2[8](vec2(1, 0), vec2(0.7071, 0.7071), vec2(0, 1), vec2(-0.7071, 0.7071),\n"
+    "                                   vec2(-1, 0), vec2(-0.7071, -0.7071), vec2(0, -1), vec2(0.7071, -0.7071));\n"
+    "float logDepth(vec2 uv) {\n"
+    "   float d = texture(u_depth, uv).r;\n"
+    "   if (d >= 1.0) return 0.0;\n"
+    "   float z_ndc = d * 2.0 - 1.0;\n"
+    "   return log2(2.0 * u_zNear * u_zFar / (u_zFar + u_zNear - z_ndc * (u_zFar - u_zNear)));\n"
+    "}\n"
+    "void main() {\n"
+    "   float depth = logDepth(b_uv);\n"
+    "   float sum = 0.0;\n"
+    "   for (int i = 0; i < 8; i++) {\n"
+    "       float n_depth = logDepth(b_uv + neighbours[i] * u_radius * u_pixelSize);\n"
+    "       if (n_depth != 0.0) sum += (depth == 0.0) ? 100.0 : max(0.0, depth - n_depth);\n"
+    "   }\n"
+    "   float shade = exp(-sum / 8.0 * 300.0 * u_strength);\n"
+    "   out_Color = vec4(texture(u_color, b_uv).rgb * shade, 1);\n"
+    "   gl_FragDepth = texture(u_depth, b_uv).r;\n"
+    "}";
+
+GLchar *FPC_FRAGMENT_SHADER =
+    "#version 330 core\n"
+    "in vec3 b_color;\n"
+    "layout(location = 0) out vec4 out_Color;\n"
+    "void main() {\n"
+    "   // round splats: drop the corners of the point sprite\n"
+    "   vec2 coord = gl_PointCoord * 2.0 - 1.0;\n"
+    "   if (dot(coord, coord) > 1.0) discard;\n"
+    "   out_Color = vec4(b_color, 1);\n"
+    "}";
+
 Shader::Shader(GLchar *vs, GLchar *fs)
 {
     if (!compile(verterxId_, GL_VERTEX_SHADER, vs))
@@ -0,0 +1,101 @@
+#include "simd_math.h"
+
+#ifdef SIMD_MATH_SSE
+#include <emmintrin.h>
+#endif
+
+namespace simd
+{
+    Mat4 identity()
+    {
+        Mat4 r = {{1, 0, 0, 0,
+                   0, 1, 0, 0,
+                   0, 0, 1, 0,
+                   0, 0, 0, 1}};
+        return r;
+    }
+
+    Mat4 fromQuatTranslation(const float *q, const float *t)
+    {
+        const float x = q[0], y = q[1], z = q[2], w = q[3];
+        const float xx = x * x, yy = y * y, zz = z * z;
+        const float xy = x * y, xz = x * z, yz = y * z;
+        const float wx = w * x, wy = w * y, wz = w * z;
+
+        Mat4 r = {{1.f - 2.f * (yy + zz), 2.f * (xy - wz), 2.f * (xz + wy), t[0],
+                   2.f * (xy + wz), 1.f - 2.f * (xx + zz), 2.f * (yz - wx), t[1],
+                   2.f * (xz - wy), 2.f * (yz + wx), 1.f - 2.f * (xx + yy), t[2],
+                   0, 0, 0, 1}};
+        return r;
+    }
+
+#ifdef SIMD_MATH_SSE
+    Mat4 rigidInverse(const Mat4 &a)
+    {
+        __m128 r0 = _mm_load_ps(a.m);
+        __m128 r1 = _mm_load_ps(a.m + 4);
+        __m128 r2 = _mm_load_ps(a.m + 8);
+        __m128 r3 = _mm_setr_ps(0, 0, 0, 1);
+
+        // R^T.t = t.x * R.row0 + t.y * R.row1 + t.z * R.row2
+        __m128 t = _mm_mul_ps(_mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3)), r0);
+        t = _mm_add_ps(t, _mm_mul_ps(_mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3)), r1));
+        t = _mm_add_ps(t, _mm_mul_ps(_mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3)), r2));
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        Mat4 r;
+        _mm_store_ps(r.m, r0);
+        _mm_store_ps(r.m + 4, r1);
+        _mm_store_ps(r.m + 8, r2);
+        alignas(16) float tr[4];
+        _mm_store_ps(tr, t);
+        // the 4th column of the transposed rows holds the old translation, replace it
+        r.m[3] = -tr[0];
+        r.m[7] = -tr[1];
+        r.m[11] = -tr[2];
+        r.m[12] = r.m[13] = r.m[14] = 0.f;
+        r.m[15] = 1.f;
+        return r;
+    }
+
+    Mat4 multiply(const Mat4 &a, const Mat4 &b)
+    {
+        const __m128 b0 = _mm_load_ps(b.m);
+        const __m128 b1 = _mm_load_ps(b.m + 4);
+        const __m128 b2 = _mm_load_ps(b.m + 8);
+        const __m128 b3 = _mm_load_ps(b.m + 12);
+
+        Mat4 r;
+        for (int i = 0; i < 4; i++)
+        {
+            const float *row = a.m + i * 4;
+            __m128 c = _mm_mul_ps(_mm_set1_ps(row[0]), b0);
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(row[1]), b1));
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(row[2]), b2));
+            c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(row[3]), b3));
+            _mm_store_ps(r.m + i * 4, c);
+        }
+        return r;
+    }
+#else
+    Mat4 rigidInverse(const Mat4 &a)
+    {
+        const float *m = a.m;
+        Mat4 r = {{m[0], m[4], m[8], -(m[0] * m[3] + m[4] * m[7] + m[8] * m[11]),
+                   m[1], m[5], m[9], -(m[1] * m[3] + m[5] * m[7] + m[9] * m[11]),
+                   m[2], m[6], m[10], -(m[2] * m[3] + m[6] * m[7] + m[10] * m[11]),
+                   0, 0, 0, 1}};
+        return r;
+    }
+
+    Mat4 multiply(const Mat4 &a, const Mat4 &b)
+    {
+        Mat4 r;
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+                r.m[i * 4 + j] = a.m[i * 4] * b.m[j] + a.m[i * 4 + 1] * b.m[4 + j] + a.m[i * 4 + 2] * b.m[8 + j] + a.m[i * 4 + 3] * b.m[12 + j];
+        return r;
+    }
+#endif
+}
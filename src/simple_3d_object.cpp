@@ -1,111 +1,140 @@
 #include "simple_3d_object.h"
 
+#include <algorithm>
+#include <cstring>
+
 Simple3DObject::Simple3DObject() : isStatic_(false)
 {
     vaoID_ = 0;
+    nbVertices_ = gpuCapacity_ = nbIndices_ = 0;
+    indexType_ = GL_UNSIGNED_INT;
     drawingType_ = GL_TRIANGLES;
-    position_ = sl::float3(0, 0, 0);
-    rotation_.setIdentity();
 }
 
-Simple3DObject::Simple3DObject(sl::Translation position, bool isStatic) : isStatic_(isStatic)
+Simple3DObject::Simple3DObject(vmath::Translation position, bool isStatic) : isStatic_(isStatic)
 {
     vaoID_ = 0;
+    nbVertices_ = gpuCapacity_ = nbIndices_ = 0;
+    indexType_ = GL_UNSIGNED_INT;
     drawingType_ = GL_TRIANGLES;
     position_ = position;
-    rotation_.setIdentity();
 }
 
 Simple3DObject::~Simple3DObject()
 {
     if (vaoID_ != 0)
     {
-        glDeleteBuffers(3, vboID_);
+        glDeleteBuffers(2, vboID_);
         glDeleteVertexArrays(1, &vaoID_);
     }
 }
 
-void Simple3DObject::addPoint(sl::float3 position, sl::float3 color)
+void Simple3DObject::reserve(size_t nb_vertices)
 {
-    addPoint(position.x, position.y, position.z, color.r, color.g, color.b);
+    vertices_.reserve(nb_vertices * VERTEX_SIZE);
 }
 
-void Simple3DObject::addPoint(float x, float y, float z, float r, float g, float b)
+void Simple3DObject::addPoint(vmath::float3 position, vmath::float3 color)
 {
-    vertices_.push_back(x);
-    vertices_.push_back(y);
-    vertices_.push_back(z);
-    colors_.push_back(r);
-    colors_.push_back(g);
-    colors_.push_back(b);
-    indices_.push_back((int)indices_.size());
+    addPoint(position.x, position.y, position.z, color.x, color.y, color.z);
 }
 
-void Simple3DObject::addLine(sl::float3 p1, sl::float3 p2, sl::float3 clr)
+void Simple3DObject::addPoint(float x, float y, float z, float r, float g, float b)
 {
-    vertices_.push_back(p1.x);
-    vertices_.push_back(p1.y);
-    vertices_.push_back(p1.z);
+    const float vertex[VERTEX_SIZE] = {x, y, z, r, g, b};
+    vertices_.insert(vertices_.end(), vertex, vertex + VERTEX_SIZE);
+}
 
-    vertices_.push_back(p2.x);
-    vertices_.push_back(p2.y);
-    vertices_.push_back(p2.z);
+void Simple3DObject::addPoints(const vmath::float3 *positions, size_t nb, vmath::float3 color)
+{
+    size_t offset = vertices_.size();
+    vertices_.resize(offset + nb * VERTEX_SIZE);
+    float *dst = &vertices_[offset];
+    for (size_t i = 0; i < nb; i++, dst += VERTEX_SIZE)
+    {
+        dst[0] = positions[i].x;
+        dst[1] = positions[i].y;
+        dst[2] = positions[i].z;
+        dst[3] = color.x;
+        dst[4] = color.y;
+        dst[5] = color.z;
+    }
+}
 
-    colors_.push_back(clr.r);
-    colors_.push_back(clr.g);
-    colors_.push_back(clr.b);
+void Simple3DObject::addLine(vmath::float3 p1, vmath::float3 p2, vmath::float3 clr)
+{
+    addPoint(p1, clr);
+    addPoint(p2, clr);
+}
 
-    colors_.push_back(clr.r);
-    colors_.push_back(clr.g);
-    colors_.push_back(clr.b);
+void Simple3DObject::createBuffers(RenderState &state)
+{
+    glGenVertexArrays(1, &vaoID_);
+    glGenBuffers(2, vboID_);
 
-    indices_.push_back((int)indices_.size());
-    indices_.push_back((int)indices_.size());
+    const GLsizei stride = VERTEX_SIZE * sizeof(float);
+    state.bindVertexArray(vaoID_);
+    glBindBuffer(GL_ARRAY_BUFFER, vboID_[0]);
+    glVertexAttribPointer(Shader::ATTRIB_VERTICES_POS, 3, GL_FLOAT, GL_FALSE, stride, 0); // link buffer to vao
+    glEnableVertexAttribArray(Shader::ATTRIB_VERTICES_POS);
+    glVertexAttribPointer(Shader::ATTRIB_COLOR_POS, 3, GL_FLOAT, GL_FALSE, stride, (void *)(3 * sizeof(float)));
+    glEnableVertexAttribArray(Shader::ATTRIB_COLOR_POS);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void Simple3DObject::pushToGPU()
+void Simple3DObject::pushToGPU(RenderState &state)
 {
     if (!isStatic_ || vaoID_ == 0)
     {
         if (vaoID_ == 0)
-        {
-            glGenVertexArrays(1, &vaoID_);
-            glGenBuffers(3, vboID_);
-        }
-        glBindVertexArray(vaoID_);
-        if (vertices_.size())
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, vboID_[0]);
-            glBufferData(GL_ARRAY_BUFFER, vertices_.size() * sizeof(float), &vertices_[0], isStatic_ ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
-            glVertexAttribPointer(Shader::ATTRIB_VERTICES_POS, 3, GL_FLOAT, GL_FALSE, 0, 0); // link buffer to vao
-            glEnableVertexAttribArray(Shader::ATTRIB_VERTICES_POS);
-        }
-
-        if (colors_.size())
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, vboID_[1]);
-            glBufferData(GL_ARRAY_BUFFER, colors_.size() * sizeof(float), &colors_[0], isStatic_ ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
-            glVertexAttribPointer(Shader::ATTRIB_COLOR_POS, 3, GL_FLOAT, GL_FALSE, 0, 0); // link buffer to vao
-            glEnableVertexAttribArray(Shader::ATTRIB_COLOR_POS);
-        }
+            createBuffers(state);
 
-        if (indices_.size())
+        const GLsizei nb_vertices = (GLsizei)(vertices_.size() / VERTEX_SIZE);
+        const GLsizei stride = VERTEX_SIZE * sizeof(float);
+        glBindBuffer(GL_ARRAY_BUFFER, vboID_[0]);
+        if (nb_vertices > gpuCapacity_)
         {
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vboID_[2]);
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_.size() * sizeof(unsigned int), &indices_[0], isStatic_ ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
+            // Grow ahead so that an object built incrementally (e.g. the camera path) is not reallocated each time
+            gpuCapacity_ = isStatic_ ? nb_vertices : std::max(nb_vertices, gpuCapacity_ * 2);
+            glBufferData(GL_ARRAY_BUFFER, gpuCapacity_ * stride, 0, isStatic_ ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
+            nbVertices_ = 0;
         }
+        else if (nb_vertices < nbVertices_)
+            nbVertices_ = 0;
 
-        glBindVertexArray(0);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        if (nb_vertices > nbVertices_)
+            glBufferSubData(GL_ARRAY_BUFFER, nbVertices_ * stride, (nb_vertices - nbVertices_) * stride, &vertices_[nbVertices_ * VERTEX_SIZE]);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        nbVertices_ = nb_vertices;
+        nbIndices_ = 0;
     }
 }
 
+void Simple3DObject::setMesh(RenderState &state, const float *vertices, int nb_vertices, const unsigned short *indices, int nb_indices)
+{
+    if (vaoID_ == 0)
+        createBuffers(state);
+    state.bindVertexArray(vaoID_);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vboID_[0]);
+    glBufferData(GL_ARRAY_BUFFER, nb_vertices * VERTEX_SIZE * sizeof(float), vertices, GL_STATIC_DRAW);
+    nbVertices_ = gpuCapacity_ = nb_vertices;
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vboID_[1]);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, nb_indices * sizeof(unsigned short), indices, GL_STATIC_DRAW);
+    nbIndices_ = nb_indices;
+    indexType_ = GL_UNSIGNED_SHORT;
+
+    // The index buffer binding belongs to the vertex array, which stays bound
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 void Simple3DObject::clear()
 {
     vertices_.clear();
-    colors_.clear();
-    indices_.clear();
+    // Everything will be uploaded again on the next pushToGPU
+    nbVertices_ = 0;
 }
 
 void Simple3DObject::setDrawingType(GLenum type)
@@ -113,61 +142,48 @@ void Simple3DObject::setDrawingType(GLenum type)
     drawingType_ = type;
 }
 
-void Simple3DObject::draw()
+void Simple3DObject::draw(RenderState &state)
 {
-    if (indices_.size() && vaoID_)
+    if (nbIndices_ && vaoID_)
+    {
+        state.bindVertexArray(vaoID_);
+        state.drawElements(drawingType_, nbIndices_, indexType_, 0);
+    }
+    else if (nbVertices_ && vaoID_)
     {
-        glBindVertexArray(vaoID_);
-        glDrawElements(drawingType_, (GLsizei)indices_.size(), GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
+        state.bindVertexArray(vaoID_);
+        state.drawArrays(drawingType_, 0, nbVertices_);
     }
 }
 
-void Simple3DObject::translate(const sl::Translation &t)
+void Simple3DObject::translate(const vmath::Translation &t)
 {
     position_ = position_ + t;
 }
 
-void Simple3DObject::setPosition(const sl::Translation &p)
+void Simple3DObject::setPosition(const vmath::Translation &p)
 {
     position_ = p;
 }
 
-void Simple3DObject::setRT(const sl::Transform &mRT)
-{
-    position_ = mRT.getTranslation();
-    rotation_ = mRT.getOrientation();
-}
-
-void Simple3DObject::rotate(const sl::Orientation &rot)
+void Simple3DObject::rotate(const vmath::Orientation &rot)
 {
     rotation_ = rot * rotation_;
 }
 
-void Simple3DObject::rotate(const sl::Rotation &m)
-{
-    this->rotate(sl::Orientation(m));
-}
-
-void Simple3DObject::setRotation(const sl::Orientation &rot)
+void Simple3DObject::setRotation(const vmath::Orientation &rot)
 {
     rotation_ = rot;
 }
 
-void Simple3DObject::setRotation(const sl::Rotation &m)
-{
-    this->setRotation(sl::Orientation(m));
-}
-
-const sl::Translation &Simple3DObject::getPosition() const
+const vmath::Translation &Simple3DObject::getPosition() const
 {
     return position_;
 }
 
-sl::Transform Simple3DObject::getModelMatrix() const
+simd::Mat4 Simple3DObject::getModelMatrix() const
 {
-    sl::Transform tmp = sl::Transform::identity();
-    tmp.setOrientation(rotation_);
-    tmp.setTranslation(position_);
-    return tmp;
+    const float q[4] = {rotation_.x, rotation_.y, rotation_.z, rotation_.w};
+    const float t[3] = {position_.x, position_.y, position_.z};
+    return simd::fromQuatTranslation(q, t);
 }
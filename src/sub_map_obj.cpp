@@ -1,6 +1,8 @@
 #include "sub_map_obj.h"
 
-SubMapObj::SubMapObj()
+#include <cstddef>
+
+SubMapObj::SubMapObj(RenderState &state) : state_(state)
 {
     current_fpc_count_ = 0;
     vaoID_ = 0;
@@ -11,48 +13,46 @@ SubMapObj::~SubMapObj()
     current_fpc_count_ = 0;
     if (vaoID_)
     {
-        glDeleteBuffers(2, vboID_);
-        glDeleteVertexArrays(1, &vaoID_);
+        glDeleteBuffers(1, &vboID_);
+        state_.deleteVertexArray(vaoID_);
     }
 }
 
-void SubMapObj::update(sl::PointCloudChunk &chunk)
+void SubMapObj::update(const MapPoint *points, size_t nb_points)
 {
     if (vaoID_ == 0)
     {
         glGenVertexArrays(1, &vaoID_);
-        glGenBuffers(2, vboID_);
+        glGenBuffers(1, &vboID_);
+
+        // The layout is kept in the vertex array, the next updates only replace the data
+        state_.bindVertexArray(vaoID_);
+        glBindBuffer(GL_ARRAY_BUFFER, vboID_);
+        glVertexAttribPointer(Shader::ATTRIB_VERTICES_POS, 3, GL_FLOAT, GL_FALSE, sizeof(MapPoint), 0);
+        glEnableVertexAttribArray(Shader::ATTRIB_VERTICES_POS);
+        // The color is packed as 0x00RRGGBB, i.e. the bytes B, G, R, 0 in memory:
+        // read it as normalized BGRA bytes so the vertex fetch unpacks it instead of the shader
+        glVertexAttribPointer(Shader::ATTRIB_COLOR_POS, GL_BGRA, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(MapPoint), (void *)offsetof(MapPoint, color));
+        glEnableVertexAttribArray(Shader::ATTRIB_COLOR_POS);
     }
+    else
+        glBindBuffer(GL_ARRAY_BUFFER, vboID_);
 
-    glShadeModel(GL_SMOOTH);
-
-    const auto nb_v = chunk.vertices.size();
-    index.resize(nb_v);
-    for (int c = 0; c < nb_v; c++)
-        index[c] = c;
-
-    glBindVertexArray(vaoID_);
-
-    glBindBuffer(GL_ARRAY_BUFFER, vboID_[Shader::ATTRIB_VERTICES_POS]);
-    glBufferData(GL_ARRAY_BUFFER, chunk.vertices.size() * sizeof(sl::float4), &chunk.vertices[0], GL_DYNAMIC_DRAW);
-    glVertexAttribPointer(Shader::ATTRIB_VERTICES_POS, 4, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(Shader::ATTRIB_VERTICES_POS);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vboID_[1]);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, index.size() * sizeof(sl::uint1), &index[0], GL_DYNAMIC_DRAW);
-    current_fpc_count_ = (int)index.size();
-
-    glBindVertexArray(0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBufferData(GL_ARRAY_BUFFER, nb_points * sizeof(MapPoint), points, GL_DYNAMIC_DRAW);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Every point is drawn once and in order, no index buffer is needed
+    current_fpc_count_ = (int)nb_points;
 }
 
-void SubMapObj::draw()
+void SubMapObj::draw(RenderState &state, int max_points)
 {
     if (current_fpc_count_ && vaoID_)
     {
-        glBindVertexArray(vaoID_);
-        glDrawElements(GL_POINTS, (GLsizei)current_fpc_count_, GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
+        GLsizei count = (GLsizei)current_fpc_count_;
+        if (max_points >= 0 && max_points < count)
+            count = max_points;
+        state.bindVertexArray(vaoID_);
+        state.drawArrays(GL_POINTS, 0, count);
     }
-}
\ No newline at end of file
+}
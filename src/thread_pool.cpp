@@ -0,0 +1,235 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    /// Pool and index of the worker running on this thread
+    thread_local ThreadPool *currentPool = nullptr;
+    thread_local int currentWorker = -1;
+    /// Priority of the task run by this thread
+    thread_local ThreadPool::Priority currentPriority = ThreadPool::NORMAL;
+
+    /// Workers of the global pool, set by configure()
+    int globalWorkers = -1;
+}
+
+ThreadPool::ThreadPool(int nb_workers) : nbQueued_(0), nextWorker_(0), startedAt_(std::chrono::steady_clock::now())
+{
+    for (int i = 0; i < nb_workers; i++)
+        workers_.emplace_back(new Worker());
+    // Started once all the queues exist, they steal from each other
+    for (int i = 0; i < nb_workers; i++)
+        workers_[i]->thread = std::thread(&ThreadPool::loop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMtx_);
+        stop_ = true;
+    }
+    sleepCv_.notify_all();
+    for (auto &it : workers_)
+        it->thread.join();
+}
+
+ThreadPool::Priority ThreadPool::getCurrentPriority()
+{
+    return currentPriority;
+}
+
+ThreadPool::PriorityScope::PriorityScope(Priority priority) : previous_(currentPriority)
+{
+    currentPriority = priority;
+}
+
+ThreadPool::PriorityScope::~PriorityScope()
+{
+    currentPriority = previous_;
+}
+
+void ThreadPool::configure(int nb_workers)
+{
+    globalWorkers = nb_workers;
+}
+
+ThreadPool &ThreadPool::global()
+{
+    static ThreadPool pool(globalWorkers >= 0 ? globalWorkers : (int)std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void ThreadPool::submit(TaskGroup &group, Task task, Priority priority, int affinity)
+{
+    if (workers_.empty())
+    {
+        task();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(group.mtx_);
+        group.pending_++;
+    }
+    int index;
+    if (affinity >= 0)
+        index = affinity % (int)workers_.size();
+    else if (currentPool == this)
+        index = currentWorker;
+    else
+        index = (int)(nextWorker_.fetch_add(1) % workers_.size());
+    {
+        std::lock_guard<std::mutex> lock(workers_[index]->mtx);
+        workers_[index]->tasks[priority].emplace_back(&group, std::move(task));
+        group.queued_.fetch_add(1);
+        nbQueued_.fetch_add(1);
+    }
+    // A worker between its check of nbQueued_ and its wait holds this lock, so it cannot miss the notification
+    {
+        std::lock_guard<std::mutex> lock(sleepMtx_);
+    }
+    sleepCv_.notify_one();
+    // Same for a thread waiting for the group
+    {
+        std::lock_guard<std::mutex> lock(group.mtx_);
+    }
+    group.cv_.notify_all();
+}
+
+void ThreadPool::wait(TaskGroup &group)
+{
+    const int self = currentPool == this ? currentWorker : -1;
+    while (true)
+    {
+        // Only the tasks of this group: a thread outside the pool must not be held by the work of others
+        if (runOne(self, &group))
+            continue;
+        std::unique_lock<std::mutex> lock(group.mtx_);
+        // The last tasks of the group are running on other threads
+        group.cv_.wait(lock, [&] { return group.pending_ == 0 || group.queued_.load() > 0; });
+        // Checked under the lock: the thread completing the last task is done with the group once it is released
+        if (group.pending_ == 0)
+            return;
+    }
+}
+
+bool ThreadPool::pop(Queue &tasks, TaskGroup *group, bool back, std::pair<TaskGroup *, Task> &task)
+{
+    // Position of the task, searched from the end taken
+    const size_t n = tasks.size();
+    size_t i = 0;
+    while (i < n && group && tasks[back ? n - 1 - i : i].first != group)
+        i++;
+    if (i == n)
+        return false;
+    const auto it = tasks.begin() + (back ? n - 1 - i : i);
+    task = std::move(*it);
+    tasks.erase(it);
+    // Under the lock of the queue, like the increments of submit()
+    nbQueued_.fetch_sub(1);
+    task.first->queued_.fetch_sub(1);
+    return true;
+}
+
+bool ThreadPool::runOne(int self, TaskGroup *group)
+{
+    std::pair<TaskGroup *, Task> task;
+    bool found = false, stolen = false;
+    const int nb_workers = (int)workers_.size();
+    int priority = 0;
+    for (; priority < NB_PRIORITIES; priority++)
+    {
+        if (self >= 0)
+        {
+            Worker &w = *workers_[self];
+            std::lock_guard<std::mutex> lock(w.mtx);
+            found = pop(w.tasks[priority], group, true, task);
+        }
+        for (int i = 1; i <= nb_workers && !found; i++)
+        {
+            const int victim = (std::max(self, 0) + i) % nb_workers;
+            Worker &w = *workers_[victim];
+            std::lock_guard<std::mutex> lock(w.mtx);
+            found = pop(w.tasks[priority], group, false, task);
+            stolen = found && self >= 0 && victim != self;
+        }
+        if (found)
+            break;
+    }
+    if (!found)
+        return false;
+
+    // Done even if the task throws, so that the waiting thread is not blocked forever
+    struct Completion
+    {
+        TaskGroup &group;
+        ~Completion()
+        {
+            std::lock_guard<std::mutex> lock(group.mtx_);
+            group.pending_--;
+            group.cv_.notify_all();
+        }
+    } completion = {*task.first};
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        // The parallel loops of the task are queued at its priority
+        PriorityScope scope((Priority)priority);
+        task.second();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    Counters &counters = self >= 0 ? workers_[self]->counters : callers_;
+    counters.tasks.fetch_add(1, std::memory_order_relaxed);
+    if (stolen)
+        counters.stolen.fetch_add(1, std::memory_order_relaxed);
+    counters.busyNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), std::memory_order_relaxed);
+    return true;
+}
+
+void ThreadPool::loop(int index)
+{
+    currentPool = this;
+    currentWorker = index;
+    while (true)
+    {
+        if (runOne(index, nullptr))
+            continue;
+        std::unique_lock<std::mutex> lock(sleepMtx_);
+        sleepCv_.wait(lock, [this] { return stop_ || nbQueued_.load() > 0; });
+        if (stop_)
+            return;
+    }
+}
+
+std::vector<ThreadPool::WorkerStats> ThreadPool::getStats() const
+{
+    std::vector<WorkerStats> stats(workers_.size() + 1);
+    for (size_t i = 0; i <= workers_.size(); i++)
+    {
+        const Counters &counters = i < workers_.size() ? workers_[i]->counters : callers_;
+        stats[i].tasks = counters.tasks.load(std::memory_order_relaxed);
+        stats[i].stolen = counters.stolen.load(std::memory_order_relaxed);
+        stats[i].busyMs = counters.busyNs.load(std::memory_order_relaxed) * 1e-6;
+    }
+    return stats;
+}
+
+void ThreadPool::report() const
+{
+    const double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startedAt_).count();
+    const auto stats = getStats();
+    std::cout << "[Sample] Worker pool: " << workers_.size() << " workers" << std::endl;
+    for (size_t i = 0; i < stats.size(); i++)
+    {
+        const bool worker = i < workers_.size();
+        if (!worker && !stats[i].tasks)
+            break;
+        std::cout << "[Sample]   " << (worker ? "worker " + std::to_string(i) : std::string("waiting threads")) << ": " << stats[i].tasks
+                  << " tasks (" << stats[i].stolen << " stolen), " << stats[i].busyMs << " ms busy";
+        if (worker)
+            std::cout << " (" << (elapsed_ms > 0. ? 100. * stats[i].busyMs / elapsed_ms : 0.) << "%)";
+        std::cout << std::endl;
+    }
+}
@@ -3,57 +3,20 @@
 // using namespace std;
 // using namespace sl;
 
-void parse_args(int argc, char **argv, sl::InitParameters &param)
+float getUnitScale(sl::UNIT unit)
 {
-    if (argc > 1 && std::string(argv[1]).find(".svo") != std::string::npos)
+    switch (unit)
     {
-        // SVO input mode
-        param.input.setFromSVOFile(argv[1]);
-        param.svo_real_time_mode = true;
-
-        std::cout << "[Sample] Using SVO File input: " << argv[1] << std::endl;
-    }
-    else if (argc > 1 && std::string(argv[1]).find(".svo") == std::string::npos)
-    {
-        std::string arg = std::string(argv[1]);
-        unsigned int a, b, c, d, port;
-        if (sscanf(arg.c_str(), "%u.%u.%u.%u:%d", &a, &b, &c, &d, &port) == 5)
-        {
-            // Stream input mode - IP + port
-            std::string ip_adress = std::to_string(a) + "." + std::to_string(b) + "." + std::to_string(c) + "." + std::to_string(d);
-            param.input.setFromStream(sl::String(ip_adress.c_str()), port);
-            std::cout << "[Sample] Using Stream input, IP : " << ip_adress << ", port : " << port << std::endl;
-        }
-        else if (sscanf(arg.c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) == 4)
-        {
-            // Stream input mode - IP only
-            param.input.setFromStream(sl::String(argv[1]));
-            std::cout << "[Sample] Using Stream input, IP : " << argv[1] << std::endl;
-        }
-        else if (arg.find("HD2K") != std::string::npos)
-        {
-            param.camera_resolution = sl::RESOLUTION::HD2K;
-            std::cout << "[Sample] Using Camera in resolution HD2K" << std::endl;
-        }
-        else if (arg.find("HD1080") != std::string::npos)
-        {
-            param.camera_resolution = sl::RESOLUTION::HD1080;
-            std::cout << "[Sample] Using Camera in resolution HD1080" << std::endl;
-        }
-        else if (arg.find("HD720") != std::string::npos)
-        {
-            param.camera_resolution = sl::RESOLUTION::HD720;
-            std::cout << "[Sample] Using Camera in resolution HD720" << std::endl;
-        }
-        else if (arg.find("VGA") != std::string::npos)
-        {
-            param.camera_resolution = sl::RESOLUTION::VGA;
-            std::cout << "[Sample] Using Camera in resolution VGA" << std::endl;
-        }
-    }
-    else
-    {
-        // Default
+    case sl::UNIT::MILLIMETER:
+        return 1000.f;
+    case sl::UNIT::CENTIMETER:
+        return 100.f;
+    case sl::UNIT::INCH:
+        return 39.3701f;
+    case sl::UNIT::FOOT:
+        return 3.28084f;
+    default:
+        return 1.f;
     }
 }
 
@@ -73,4 +36,40 @@ void print(std::string msg_prefix, sl::ERROR_CODE err_code, std::string msg_suff
     if (!msg_suffix.empty())
         std::cout << " " << msg_suffix;
     std::cout << std::endl;
-}
\ No newline at end of file
+}
+
+void LoopStats::start()
+{
+    ts_start_ = std::chrono::steady_clock::now();
+    stopped_ = false;
+    nb_grabs_ = 0;
+    nb_map_updates_ = 0;
+}
+
+void LoopStats::stop()
+{
+    ts_stop_ = std::chrono::steady_clock::now();
+    stopped_ = true;
+}
+
+double LoopStats::getElapsed() const
+{
+    auto ts_end = stopped_ ? ts_stop_ : std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(ts_end - ts_start_).count();
+}
+
+double LoopStats::getGrabFPS() const
+{
+    const double elapsed = getElapsed();
+    return elapsed > 0. ? nb_grabs_ / elapsed : 0.;
+}
+
+void LoopStats::report(const std::string &name) const
+{
+    const double elapsed = getElapsed();
+    if (elapsed <= 0.)
+        return;
+    std::cout << "[Sample] " << (name.empty() ? "" : name + ": ") << "Ran " << elapsed << " s : "
+              << nb_grabs_ << " grabs (" << nb_grabs_ / elapsed << " FPS), "
+              << nb_map_updates_ << " map updates (" << nb_map_updates_ / elapsed << " Hz)" << std::endl;
+}
@@ -0,0 +1,64 @@
+#include "viewer_math.h"
+
+namespace vmath
+{
+    Orientation::Orientation(const float3 &from, const float3 &to)
+    {
+        float3 a = from, b = to;
+        a.normalize();
+        b.normalize();
+        const float d = float3::dot(a, b);
+        if (d < -0.999999f)
+        {
+            // Opposite directions: half turn around any axis orthogonal to them
+            float3 axis = float3::cross(float3(1.f, 0.f, 0.f), a);
+            if (axis.norm() < 1e-6f)
+                axis = float3::cross(float3(0.f, 1.f, 0.f), a);
+            *this = fromAxisAngle(PI, axis);
+            return;
+        }
+        // Half-way quaternion: (a x b, 1 + a.b) normalized
+        const float3 c = float3::cross(a, b);
+        x = c.x;
+        y = c.y;
+        z = c.z;
+        w = 1.f + d;
+        normalize();
+    }
+
+    Orientation Orientation::fromAxisAngle(float angle, const float3 &axis)
+    {
+        float3 n = axis;
+        n.normalize();
+        const float s = std::sin(angle * 0.5f);
+        return Orientation(n.x * s, n.y * s, n.z * s, std::cos(angle * 0.5f));
+    }
+
+    Orientation Orientation::operator*(const Orientation &b) const
+    {
+        return Orientation(w * b.x + x * b.w + y * b.z - z * b.y,
+                           w * b.y - x * b.z + y * b.w + z * b.x,
+                           w * b.z + x * b.y - y * b.x + z * b.w,
+                           w * b.w - x * b.x - y * b.y - z * b.z);
+    }
+
+    void Orientation::normalize()
+    {
+        const float n = std::sqrt(x * x + y * y + z * z + w * w);
+        if (n > 0.f)
+        {
+            x /= n;
+            y /= n;
+            z /= n;
+            w /= n;
+        }
+    }
+
+    float3 operator*(const float3 &v, const Orientation &q)
+    {
+        // v + 2 u x (u x v + w v), with u the vector part of q
+        const float3 u(q.x, q.y, q.z);
+        const float3 t = float3::cross(u, v) + v * q.w;
+        return v + float3::cross(u, t) * 2.f;
+    }
+}
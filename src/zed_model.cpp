@@ -0,0 +1,3010 @@
+// Generated by tools/gen_zed_model.py from tools/zed_model_soup.h, do not edit
+#include "zed_model.h"
+
+#include <iostream>
+
+// ZED camera meshes, in millimeters, with shared vertices.
+// Each vertex is interleaved as x, y, z, r, g, b; a vertex used by two parts of different colors is duplicated.
+
+namespace
+{
+    const float zed_vertices[] = {
+        -68.456f, -16.299f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -76.606f, -14.115f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -68.456f, -16.299f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -82.572f, 8.15f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -76.606f, 14.115f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -82.572f, 8.15f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -84.755f, 0.0f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -84.755f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -82.572f, -8.15f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -82.572f, -8.15f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -76.606f, -14.115f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -76.606f, 14.115f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -68.456f, 16.299f, -16.299f, 0.79f, 0.82f, 0.93f,
+        48.604f, -8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        45.024f, -4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        53.494f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        45.024f, 4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        48.604f, 8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        53.494f, -9.779f, -16.299f, 0.79f, 0.82f, 0.93f,
+        43.714f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        63.273f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        61.963f, -4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        53.494f, 9.779f, -16.299f, 0.79f, 0.82f, 0.93f,
+        58.383f, -8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        58.383f, 8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        61.963f, 4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        0.0f, -16.299f, -16.299f, 0.79f, 0.82f, 0.93f,
+        68.456f, -16.299f, -16.299f, 0.79f, 0.82f, 0.93f,
+        68.456f, -16.299f, 16.299f, 0.79f, 0.82f, 0.93f,
+        76.606f, -14.115f, -16.299f, 0.79f, 0.82f, 0.93f,
+        76.606f, 14.115f, -16.299f, 0.79f, 0.82f, 0.93f,
+        82.572f, 8.15f, 16.299f, 0.79f, 0.82f, 0.93f,
+        82.572f, 8.15f, -16.299f, 0.79f, 0.82f, 0.93f,
+        84.755f, 0.0f, 16.299f, 0.79f, 0.82f, 0.93f,
+        84.755f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        82.572f, -8.15f, 16.299f, 0.79f, 0.82f, 0.93f,
+        82.572f, -8.15f, -16.299f, 0.79f, 0.82f, 0.93f,
+        76.606f, -14.115f, 16.299f, 0.79f, 0.82f, 0.93f,
+        68.456f, 16.299f, -16.299f, 0.79f, 0.82f, 0.93f,
+        76.606f, 14.115f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -48.604f, 8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -45.024f, 4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -53.494f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -58.383f, 8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -53.494f, 9.779f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -61.963f, 4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -63.273f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -43.714f, 0.0f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -45.024f, -4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -48.604f, -8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -58.383f, -8.469f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -61.963f, -4.89f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -53.494f, -9.779f, -16.299f, 0.79f, 0.82f, 0.93f,
+        -68.456f, 16.299f, 16.299f, 0.79f, 0.82f, 0.93f,
+        0.0f, 16.299f, -16.299f, 0.79f, 0.82f, 0.93f,
+        68.456f, 16.299f, 16.299f, 0.79f, 0.82f, 0.93f,
+        -61.963f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -68.456f, 16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -58.383f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, 8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, -14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, -8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -68.456f, -16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, 14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -84.755f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, -14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, 8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, -8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -68.456f, -16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, 14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -84.755f, 0.0f, 16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, 16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -68.456f, 16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -53.494f, 9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -63.273f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -61.963f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -58.383f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -53.494f, -9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -48.604f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -45.024f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        0.0f, -16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -43.714f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -45.024f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        0.0f, 16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -48.604f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        61.963f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        58.383f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, 16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, -14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, 8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, -8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, -16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, 14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        84.755f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, 8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, -14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, -8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, -16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, 14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        84.755f, 0.0f, 16.299f, 0.07f, 0.07f, 0.07f,
+        53.494f, 9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        63.273f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        61.963f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        58.383f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        53.494f, -9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        48.604f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        45.024f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        43.714f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        45.024f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        48.604f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f};
+
+    const unsigned short zed_indices[] = {
+        0, 1, 2,
+        3, 4, 5,
+        6, 5, 7,
+        8, 7, 9,
+        10, 9, 1,
+        11, 12, 4,
+        13, 14, 15,
+        16, 17, 15,
+        18, 13, 15,
+        19, 16, 15,
+        20, 21, 15,
+        17, 22, 15,
+        23, 18, 15,
+        24, 25, 15,
+        21, 23, 15,
+        22, 24, 15,
+        14, 19, 15,
+        25, 20, 15,
+        26, 27, 28,
+        29, 28, 27,
+        30, 31, 32,
+        32, 33, 34,
+        34, 35, 36,
+        36, 37, 29,
+        38, 39, 30,
+        26, 0, 2,
+        40, 41, 42,
+        43, 44, 42,
+        45, 43, 42,
+        46, 45, 42,
+        41, 47, 42,
+        44, 40, 42,
+        48, 49, 42,
+        50, 51, 42,
+        52, 50, 42,
+        47, 48, 42,
+        49, 52, 42,
+        51, 46, 42,
+        53, 54, 12,
+        38, 54, 55,
+        0, 10, 1,
+        3, 11, 4,
+        6, 3, 5,
+        8, 6, 7,
+        10, 8, 9,
+        11, 53, 12,
+        29, 37, 28,
+        30, 39, 31,
+        32, 31, 33,
+        34, 33, 35,
+        36, 35, 37,
+        38, 55, 39,
+        26, 28, 0,
+        53, 55, 54,
+        56, 57, 58,
+        59, 60, 61,
+        62, 63, 57,
+        61, 64, 59,
+        65, 66, 67,
+        68, 69, 65,
+        67, 66, 70,
+        68, 71, 72,
+        73, 58, 57,
+        56, 74, 57,
+        74, 75, 62,
+        57, 74, 62,
+        75, 76, 62,
+        76, 77, 62,
+        78, 79, 80,
+        79, 81, 80,
+        81, 82, 83,
+        80, 81, 83,
+        82, 84, 83,
+        84, 73, 83,
+        57, 83, 73,
+        78, 80, 77,
+        80, 62, 77,
+        85, 86, 87,
+        88, 89, 90,
+        91, 92, 88,
+        90, 89, 93,
+        94, 95, 96,
+        97, 98, 71,
+        96, 99, 94,
+        100, 87, 86,
+        85, 87, 101,
+        101, 91, 102,
+        87, 91, 101,
+        102, 91, 103,
+        103, 91, 104,
+        105, 80, 106,
+        106, 80, 107,
+        107, 83, 108,
+        80, 83, 107,
+        108, 83, 109,
+        109, 83, 100,
+        87, 100, 83,
+        105, 104, 80,
+        80, 104, 91,
+        59, 63, 60,
+        62, 60, 63,
+        65, 69, 66,
+        68, 72, 69,
+        68, 97, 71,
+        88, 92, 89,
+        91, 87, 92,
+        94, 98, 95,
+        97, 95, 98};
+
+    const ZEDModelMesh zed_mesh = {zed_vertices, 110, zed_indices, 324};
+
+    const float zed2_vertices[] = {
+        -68.456f, -16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, -14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -68.456f, -16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, 8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, 14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, 8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -84.755f, 0.0f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -84.755f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, -8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -82.572f, -8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, -14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -76.606f, 14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -68.456f, 16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        48.604f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        45.024f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        53.494f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        45.024f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        48.604f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        53.494f, -9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        43.714f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        63.273f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        61.963f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        53.494f, 9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        58.383f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        58.383f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        61.963f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        0.0f, -16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, -16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, -16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, -14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, 14.115f, -16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, 8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, 8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        84.755f, 0.0f, 16.299f, 0.07f, 0.07f, 0.07f,
+        84.755f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, -8.15f, 16.299f, 0.07f, 0.07f, 0.07f,
+        82.572f, -8.15f, -16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, -14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, 16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        76.606f, 14.115f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -48.604f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -45.024f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -53.494f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -58.383f, 8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -53.494f, 9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -61.963f, 4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -63.273f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -43.714f, 0.0f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -45.024f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -48.604f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -58.383f, -8.469f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -61.963f, -4.89f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -53.494f, -9.779f, -16.299f, 0.07f, 0.07f, 0.07f,
+        -68.456f, 16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        0.0f, 16.299f, -16.299f, 0.07f, 0.07f, 0.07f,
+        68.456f, 16.299f, 16.299f, 0.07f, 0.07f, 0.07f,
+        -61.963f, 4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -68.456f, 16.299f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -58.383f, 8.469f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -82.572f, 8.15f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -76.606f, -14.115f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -82.572f, -8.15f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -68.456f, -16.299f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -76.606f, 14.115f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -84.755f, 0.0f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -76.606f, -14.115f, 16.299f, 0.22f, 0.22f, 0.22f,
+        -82.572f, 8.15f, 16.299f, 0.22f, 0.22f, 0.22f,
+        -82.572f, -8.15f, 16.299f, 0.22f, 0.22f, 0.22f,
+        -68.456f, -16.299f, 16.299f, 0.22f, 0.22f, 0.22f,
+        -76.606f, 14.115f, 16.299f, 0.22f, 0.22f, 0.22f,
+        -84.755f, 0.0f, 16.299f, 0.22f, 0.22f, 0.22f,
+        68.456f, 16.299f, 16.299f, 0.22f, 0.22f, 0.22f,
+        -68.456f, 16.299f, 16.299f, 0.22f, 0.22f, 0.22f,
+        -53.494f, 9.779f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -63.273f, 0.0f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -61.963f, -4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -58.383f, -8.469f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -53.494f, -9.779f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -48.604f, -8.469f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -45.024f, -4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        0.0f, -16.299f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -43.714f, 0.0f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -45.024f, 4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        0.0f, 16.299f, -16.299f, 0.22f, 0.22f, 0.22f,
+        -48.604f, 8.469f, -16.299f, 0.22f, 0.22f, 0.22f,
+        61.963f, 4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        58.383f, 8.469f, -16.299f, 0.22f, 0.22f, 0.22f,
+        68.456f, 16.299f, -16.299f, 0.22f, 0.22f, 0.22f,
+        76.606f, -14.115f, -16.299f, 0.22f, 0.22f, 0.22f,
+        82.572f, 8.15f, -16.299f, 0.22f, 0.22f, 0.22f,
+        82.572f, -8.15f, -16.299f, 0.22f, 0.22f, 0.22f,
+        68.456f, -16.299f, -16.299f, 0.22f, 0.22f, 0.22f,
+        76.606f, 14.115f, -16.299f, 0.22f, 0.22f, 0.22f,
+        84.755f, 0.0f, -16.299f, 0.22f, 0.22f, 0.22f,
+        82.572f, 8.15f, 16.299f, 0.22f, 0.22f, 0.22f,
+        76.606f, -14.115f, 16.299f, 0.22f, 0.22f, 0.22f,
+        82.572f, -8.15f, 16.299f, 0.22f, 0.22f, 0.22f,
+        68.456f, -16.299f, 16.299f, 0.22f, 0.22f, 0.22f,
+        76.606f, 14.115f, 16.299f, 0.22f, 0.22f, 0.22f,
+        84.755f, 0.0f, 16.299f, 0.22f, 0.22f, 0.22f,
+        53.494f, 9.779f, -16.299f, 0.22f, 0.22f, 0.22f,
+        63.273f, 0.0f, -16.299f, 0.22f, 0.22f, 0.22f,
+        61.963f, -4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        58.383f, -8.469f, -16.299f, 0.22f, 0.22f, 0.22f,
+        53.494f, -9.779f, -16.299f, 0.22f, 0.22f, 0.22f,
+        48.604f, -8.469f, -16.299f, 0.22f, 0.22f, 0.22f,
+        45.024f, -4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        43.714f, 0.0f, -16.299f, 0.22f, 0.22f, 0.22f,
+        45.024f, 4.89f, -16.299f, 0.22f, 0.22f, 0.22f,
+        48.604f, 8.469f, -16.299f, 0.22f, 0.22f, 0.22f};
+
+    const unsigned short zed2_indices[] = {
+        0, 1, 2,
+        3, 4, 5,
+        6, 5, 7,
+        8, 7, 9,
+        10, 9, 1,
+        11, 12, 4,
+        13, 14, 15,
+        16, 17, 15,
+        18, 13, 15,
+        19, 16, 15,
+        20, 21, 15,
+        17, 22, 15,
+        23, 18, 15,
+        24, 25, 15,
+        21, 23, 15,
+        22, 24, 15,
+        14, 19, 15,
+        25, 20, 15,
+        26, 27, 28,
+        29, 28, 27,
+        30, 31, 32,
+        32, 33, 34,
+        34, 35, 36,
+        36, 37, 29,
+        38, 39, 30,
+        26, 0, 2,
+        40, 41, 42,
+        43, 44, 42,
+        45, 43, 42,
+        46, 45, 42,
+        41, 47, 42,
+        44, 40, 42,
+        48, 49, 42,
+        50, 51, 42,
+        52, 50, 42,
+        47, 48, 42,
+        49, 52, 42,
+        51, 46, 42,
+        53, 54, 12,
+        38, 54, 55,
+        0, 10, 1,
+        3, 11, 4,
+        6, 3, 5,
+        8, 6, 7,
+        10, 8, 9,
+        11, 53, 12,
+        29, 37, 28,
+        30, 39, 31,
+        32, 31, 33,
+        34, 33, 35,
+        36, 35, 37,
+        38, 55, 39,
+        26, 28, 0,
+        53, 55, 54,
+        56, 57, 58,
+        59, 60, 61,
+        62, 63, 57,
+        61, 64, 59,
+        65, 66, 67,
+        68, 69, 65,
+        67, 66, 70,
+        68, 71, 72,
+        73, 58, 57,
+        56, 74, 57,
+        74, 75, 62,
+        57, 74, 62,
+        75, 76, 62,
+        76, 77, 62,
+        78, 79, 80,
+        79, 81, 80,
+        81, 82, 83,
+        80, 81, 83,
+        82, 84, 83,
+        84, 73, 83,
+        57, 83, 73,
+        78, 80, 77,
+        80, 62, 77,
+        85, 86, 87,
+        88, 89, 90,
+        91, 92, 88,
+        90, 89, 93,
+        94, 95, 96,
+        97, 98, 71,
+        96, 99, 94,
+        100, 87, 86,
+        85, 87, 101,
+        101, 91, 102,
+        87, 91, 101,
+        102, 91, 103,
+        103, 91, 104,
+        105, 80, 106,
+        106, 80, 107,
+        107, 83, 108,
+        80, 83, 107,
+        108, 83, 109,
+        109, 83, 100,
+        87, 100, 83,
+        105, 104, 80,
+        80, 104, 91,
+        59, 63, 60,
+        62, 60, 63,
+        65, 69, 66,
+        68, 72, 69,
+        68, 97, 71,
+        88, 92, 89,
+        91, 87, 92,
+        94, 98, 95,
+        97, 95, 98};
+
+    const ZEDModelMesh zed2_mesh = {zed2_vertices, 110, zed2_indices, 324};
+
+    const float zed_m_vertices[] = {
+        58.785f, 13.3f, -2.25f, 0.79f, 0.82f, 0.93f,
+        30.8f, 13.3f, 0.001f, 0.79f, 0.82f, 0.93f,
+        2.815f, 13.3f, -2.25f, 0.79f, 0.82f, 0.93f,
+        59.839f, 13.3f, -1.999f, 0.79f, 0.82f, 0.93f,
+        60.77f, 13.3f, -1.351f, 0.79f, 0.82f, 0.93f,
+        61.449f, 13.3f, -0.563f, 0.79f, 0.82f, 0.93f,
+        61.449f, 13.3f, 0.564f, 0.79f, 0.82f, 0.93f,
+        59.839f, 13.3f, 2.0f, 0.79f, 0.82f, 0.93f,
+        58.785f, 13.3f, 2.251f, 0.79f, 0.82f, 0.93f,
+        60.77f, 13.3f, 1.352f, 0.79f, 0.82f, 0.93f,
+        1.761f, 13.3f, -1.999f, 0.79f, 0.82f, 0.93f,
+        0.83f, 13.3f, -1.351f, 0.79f, 0.82f, 0.93f,
+        0.152f, 13.3f, -0.563f, 0.79f, 0.82f, 0.93f,
+        0.152f, 13.3f, 0.564f, 0.79f, 0.82f, 0.93f,
+        2.815f, 13.3f, 2.251f, 0.79f, 0.82f, 0.93f,
+        1.761f, 13.3f, 2.0f, 0.79f, 0.82f, 0.93f,
+        0.83f, 13.3f, 1.352f, 0.79f, 0.82f, 0.93f,
+        30.8f, -13.333f, 0.001f, 0.79f, 0.82f, 0.93f,
+        59.839f, -13.333f, -1.999f, 0.79f, 0.82f, 0.93f,
+        58.785f, -13.333f, -2.25f, 0.79f, 0.82f, 0.93f,
+        60.77f, -13.333f, -1.351f, 0.79f, 0.82f, 0.93f,
+        61.449f, -13.333f, -0.563f, 0.79f, 0.82f, 0.93f,
+        61.449f, -13.333f, 0.564f, 0.79f, 0.82f, 0.93f,
+        58.785f, -13.333f, 2.251f, 0.79f, 0.82f, 0.93f,
+        59.839f, -13.333f, 2.0f, 0.79f, 0.82f, 0.93f,
+        60.77f, -13.333f, 1.352f, 0.79f, 0.82f, 0.93f,
+        2.815f, -13.333f, -2.25f, 0.79f, 0.82f, 0.93f,
+        2.815f, -13.333f, 2.251f, 0.79f, 0.82f, 0.93f,
+        1.761f, -13.333f, -1.999f, 0.79f, 0.82f, 0.93f,
+        0.83f, -13.333f, -1.351f, 0.79f, 0.82f, 0.93f,
+        0.152f, -13.333f, -0.563f, 0.79f, 0.82f, 0.93f,
+        0.152f, -13.333f, 0.564f, 0.79f, 0.82f, 0.93f,
+        1.761f, -13.333f, 2.0f, 0.79f, 0.82f, 0.93f,
+        0.83f, -13.333f, 1.352f, 0.79f, 0.82f, 0.93f,
+        -31.684f, 9.412f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.684f, 9.412f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 8.3f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 8.3f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -28.977f, 12.805f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -28.977f, 12.805f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -29.926f, 12.209f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -29.926f, 12.209f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -26.809f, 13.3f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -26.809f, 13.3f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -27.92f, 13.175f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -27.92f, 13.175f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -30.718f, 11.417f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -30.718f, 11.417f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -31.314f, 10.469f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.314f, 10.469f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -8.31f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -8.31f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -31.684f, -9.431f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.684f, -9.431f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -29.926f, -12.228f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -29.926f, -12.228f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -28.977f, -12.824f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -28.977f, -12.824f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -27.92f, -13.194f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -26.847f, -13.3f, 0.5f, 0.79f, 0.82f, 0.93f,
+        -27.92f, -13.194f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -26.847f, -13.3f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.314f, -10.488f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.314f, -10.488f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -30.718f, -11.437f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -30.718f, -11.437f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 6.354f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 6.354f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -6.364f, 0.501f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -6.364f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 5.707f, -0.7f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 5.707f, 0.701f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -5.716f, 0.701f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -5.716f, -0.7f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -0.005f, 0.001f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 5.128f, -1.423f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 5.128f, 1.424f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -5.138f, 1.424f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -5.138f, -1.423f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 4.146f, -2.297f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 4.146f, 2.299f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -4.156f, -2.297f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -4.156f, 2.299f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 3.313f, -2.495f, 0.79f, 0.82f, 0.93f,
+        -31.809f, 3.313f, 2.497f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -3.322f, -2.495f, 0.79f, 0.82f, 0.93f,
+        -31.809f, -3.322f, 2.497f, 0.79f, 0.82f, 0.93f,
+        -26.8f, 13.3f, -0.5f, 0.79f, 0.82f, 0.93f,
+        -26.8f, 13.3f, 0.501f, 0.79f, 0.82f, 0.93f,
+        88.376f, 13.3f, -0.5f, 0.79f, 0.82f, 0.93f,
+        88.376f, 13.3f, 0.501f, 0.79f, 0.82f, 0.93f,
+        93.228f, 9.412f, -0.5f, 0.79f, 0.82f, 0.93f,
+        93.353f, 8.3f, -0.5f, 0.79f, 0.82f, 0.93f,
+        93.228f, 9.412f, 0.501f, 0.79f, 0.82f, 0.93f,
+        93.353f, 8.3f, 0.501f, 0.79f, 0.82f, 0.93f,
+        90.522f, 12.805f, -0.5f, 0.79f, 0.82f, 0.93f,
+        91.47f, 12.209f, -0.5f, 0.79f, 0.82f, 0.93f,
+        90.522f, 12.805f, 0.501f, 0.79f, 0.82f, 0.93f,
+        91.47f, 12.209f, 0.501f, 0.79f, 0.82f, 0.93f,
+        89.464f, 13.175f, -0.5f, 0.79f, 0.82f, 0.93f,
+        89.464f, 13.175f, 0.501f, 0.79f, 0.82f, 0.93f,
+        92.262f, 11.417f, -0.5f, 0.79f, 0.82f, 0.93f,
+        92.858f, 10.469f, -0.5f, 0.79f, 0.82f, 0.93f,
+        92.262f, 11.417f, 0.501f, 0.79f, 0.82f, 0.93f,
+        92.858f, 10.469f, 0.501f, 0.79f, 0.82f, 0.93f,
+        93.353f, -8.31f, -0.5f, 0.79f, 0.82f, 0.93f,
+        93.353f, -8.31f, 0.501f, 0.79f, 0.82f, 0.93f,
+        93.228f, -9.431f, -0.5f, 0.79f, 0.82f, 0.93f,
+        93.228f, -9.431f, 0.501f, 0.79f, 0.82f, 0.93f,
+        91.47f, -12.228f, -0.5f, 0.79f, 0.82f, 0.93f,
+        90.522f, -12.824f, -0.5f, 0.79f, 0.82f, 0.93f,
+        91.47f, -12.228f, 0.501f, 0.79f, 0.82f, 0.93f,
+        90.522f, -12.824f, 0.501f, 0.79f, 0.82f, 0.93f,
+        89.464f, -13.194f, -0.5f, 0.79f, 0.82f, 0.93f,
+        88.376f, -13.321f, -0.5f, 0.79f, 0.82f, 0.93f,
+        89.464f, -13.194f, 0.501f, 0.79f, 0.82f, 0.93f,
+        88.376f, -13.321f, 0.501f, 0.79f, 0.82f, 0.93f,
+        92.858f, -10.488f, -0.5f, 0.79f, 0.82f, 0.93f,
+        92.262f, -11.437f, -0.5f, 0.79f, 0.82f, 0.93f,
+        92.858f, -10.488f, 0.501f, 0.79f, 0.82f, 0.93f,
+        92.262f, -11.437f, 0.501f, 0.79f, 0.82f, 0.93f,
+        7.996f, 9.763f, -8.431f, 0.07f, 0.07f, 0.07f,
+        4.982f, 9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        7.996f, 9.596f, -18.0f, 0.07f, 0.07f, 0.07f,
+        5.033f, 9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        -1.767f, 0.0f, -8.431f, 0.07f, 0.07f, 0.07f,
+        -1.29f, -3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        -1.6f, 0.0f, -18.0f, 0.07f, 0.07f, 0.07f,
+        -1.131f, -2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        2.258f, -7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        4.982f, -9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        2.356f, -7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        5.033f, -9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        7.996f, -9.763f, -8.431f, 0.07f, 0.07f, 0.07f,
+        7.996f, -9.596f, -18.0f, 0.07f, 0.07f, 0.07f,
+        0.097f, -5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        0.232f, -5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        0.097f, 5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        -1.29f, 3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        0.232f, 5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        -1.131f, 2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        2.258f, 7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        2.356f, 7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        10.959f, -9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        11.01f, -9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        17.759f, 0.0f, -8.431f, 0.07f, 0.07f, 0.07f,
+        17.282f, 3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        17.592f, 0.0f, -18.0f, 0.07f, 0.07f, 0.07f,
+        17.123f, 2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        13.734f, 7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        11.01f, 9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        13.636f, 7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        10.959f, 9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        15.895f, 5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        15.76f, 5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        15.895f, -5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        17.282f, -3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        15.76f, -5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        17.123f, -2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        13.734f, -7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        13.636f, -7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        7.996f, 10.264f, -7.94f, 0.07f, 0.07f, 0.07f,
+        4.827f, 9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -2.269f, 0.0f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -1.767f, -3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        1.963f, -8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        4.827f, -9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        7.996f, -10.264f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -0.308f, -6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -0.308f, 6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -1.767f, 3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        1.963f, 8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        11.165f, -9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        18.26f, 0.0f, -7.94f, 0.07f, 0.07f, 0.07f,
+        17.759f, 3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        14.029f, 8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        11.165f, 9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        16.3f, 6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        16.3f, -6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        17.759f, -3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        14.029f, -8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        2.356f, -7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        5.033f, -9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        2.356f, -7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        5.033f, -9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        7.996f, -9.596f, -19.5f, 0.07f, 0.07f, 0.07f,
+        7.996f, -9.596f, -22.997f, 0.07f, 0.07f, 0.07f,
+        0.232f, -5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        0.232f, -5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        -1.6f, 0.0f, -19.5f, 0.07f, 0.07f, 0.07f,
+        -1.131f, -2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        -1.6f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        -1.131f, -2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        0.232f, 5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        -1.131f, 2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        0.232f, 5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        -1.131f, 2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        2.356f, 7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        2.356f, 7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        7.996f, 9.596f, -19.5f, 0.07f, 0.07f, 0.07f,
+        5.033f, 9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        7.996f, 9.596f, -22.997f, 0.07f, 0.07f, 0.07f,
+        5.033f, 9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        13.636f, 7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        10.959f, 9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        13.636f, 7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        10.959f, 9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        15.76f, 5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        15.76f, 5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        17.592f, 0.0f, -19.5f, 0.07f, 0.07f, 0.07f,
+        17.123f, 2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        17.592f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        17.123f, 2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        15.76f, -5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        17.123f, -2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        15.76f, -5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        17.123f, -2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        13.636f, -7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        13.636f, -7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        10.959f, -9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        10.959f, -9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        2.745f, -7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        5.238f, -8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        7.996f, -8.933f, -22.997f, 0.07f, 0.07f, 0.07f,
+        0.769f, -5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        -0.937f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        -0.501f, -2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        0.769f, 5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        -0.501f, 2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        2.745f, 7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        7.996f, 8.933f, -22.997f, 0.07f, 0.07f, 0.07f,
+        5.238f, 8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        13.246f, 7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        10.754f, 8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        15.223f, 5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        16.929f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        16.493f, 2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        15.223f, -5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        16.493f, -2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        13.246f, -7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        10.754f, -8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        5.947f, -6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        4.095f, -5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        7.996f, -6.637f, -22.203f, 0.07f, 0.07f, 0.07f,
+        2.626f, -3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        1.683f, -2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        1.359f, 0.0f, -22.203f, 0.07f, 0.07f, 0.07f,
+        1.683f, 2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        2.626f, 3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        4.095f, 5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        5.947f, 6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        7.996f, 6.637f, -22.203f, 0.07f, 0.07f, 0.07f,
+        10.045f, 6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        11.897f, 5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        13.365f, 3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        14.308f, 2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        14.633f, 0.0f, -22.203f, 0.07f, 0.07f, 0.07f,
+        14.308f, -2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        13.365f, -3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        11.897f, -5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        10.045f, -6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        6.131f, -5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        4.446f, -4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        7.996f, -6.039f, -21.5f, 0.07f, 0.07f, 0.07f,
+        3.11f, -3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        2.252f, -1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        1.957f, 0.0f, -21.5f, 0.07f, 0.07f, 0.07f,
+        2.252f, 1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        3.11f, 3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        4.446f, 4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        6.131f, 5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        7.996f, 6.039f, -21.5f, 0.07f, 0.07f, 0.07f,
+        9.861f, 5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        11.545f, 4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        12.882f, 3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        13.74f, 1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        14.035f, 0.0f, -21.5f, 0.07f, 0.07f, 0.07f,
+        13.74f, -1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        12.882f, -3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        11.545f, -4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        9.861f, -5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        4.446f, -4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        6.131f, -5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        7.996f, -6.039f, -20.078f, 0.07f, 0.07f, 0.07f,
+        3.11f, -3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        1.957f, 0.0f, -20.078f, 0.07f, 0.07f, 0.07f,
+        2.252f, -1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        3.11f, 3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        2.252f, 1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        4.446f, 4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        7.996f, 6.039f, -20.078f, 0.07f, 0.07f, 0.07f,
+        6.131f, 5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        11.545f, 4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        9.861f, 5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        12.882f, 3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        14.035f, 0.0f, -20.078f, 0.07f, 0.07f, 0.07f,
+        13.74f, 1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        12.882f, -3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        13.74f, -1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        11.545f, -4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        9.861f, -5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        93.353f, 8.3f, -6.5f, 0.07f, 0.07f, 0.07f,
+        91.724f, 8.3f, -7.867f, 0.07f, 0.07f, 0.07f,
+        93.353f, -8.31f, -6.5f, 0.07f, 0.07f, 0.07f,
+        91.637f, 8.187f, -7.94f, 0.07f, 0.07f, 0.07f,
+        91.637f, -8.196f, -7.94f, 0.07f, 0.07f, 0.07f,
+        91.724f, -8.31f, -7.867f, 0.07f, 0.07f, 0.07f,
+        -31.722f, -9.412f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -31.847f, -8.3f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -31.722f, -9.412f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -4.156f, -2.297f, 0.07f, 0.07f, 0.07f,
+        -29.016f, -12.805f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, -12.209f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, -12.805f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -29.965f, -12.209f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -26.847f, -13.3f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -27.959f, -13.175f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, -13.3f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -27.959f, -13.175f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -30.756f, -11.417f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -31.352f, -10.469f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -30.756f, -11.417f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -31.352f, -10.469f, -2.25f, 0.07f, 0.07f, 0.07f,
+        2.815f, -13.333f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -3.322f, -2.495f, 0.07f, 0.07f, 0.07f,
+        -27.959f, 13.175f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, 13.3f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -27.959f, 13.175f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -26.847f, 13.3f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -31.352f, 10.469f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -30.756f, 11.417f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -31.352f, 10.469f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -30.756f, 11.417f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -31.722f, 9.412f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -31.722f, 9.412f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -31.847f, 8.3f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 4.146f, -2.297f, 0.07f, 0.07f, 0.07f,
+        -29.965f, 12.209f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, 12.805f, -6.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, 12.209f, -2.25f, 0.07f, 0.07f, 0.07f,
+        -29.016f, 12.805f, -2.25f, 0.07f, 0.07f, 0.07f,
+        1.761f, 13.3f, -1.999f, 0.07f, 0.07f, 0.07f,
+        93.228f, 9.412f, -6.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, 9.412f, -2.25f, 0.07f, 0.07f, 0.07f,
+        93.353f, 8.3f, -2.25f, 0.07f, 0.07f, 0.07f,
+        90.522f, 12.805f, -6.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, 12.209f, -6.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, 12.805f, -2.25f, 0.07f, 0.07f, 0.07f,
+        91.47f, 12.209f, -2.25f, 0.07f, 0.07f, 0.07f,
+        88.353f, 13.3f, -6.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, 13.175f, -6.5f, 0.07f, 0.07f, 0.07f,
+        88.353f, 13.3f, -2.25f, 0.07f, 0.07f, 0.07f,
+        89.464f, 13.175f, -2.25f, 0.07f, 0.07f, 0.07f,
+        92.262f, 11.417f, -6.5f, 0.07f, 0.07f, 0.07f,
+        92.858f, 10.469f, -6.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, 11.417f, -2.25f, 0.07f, 0.07f, 0.07f,
+        92.858f, 10.469f, -2.25f, 0.07f, 0.07f, 0.07f,
+        93.353f, -8.31f, -2.25f, 0.07f, 0.07f, 0.07f,
+        93.228f, -9.431f, -6.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, -9.431f, -2.25f, 0.07f, 0.07f, 0.07f,
+        91.47f, -12.228f, -6.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, -12.824f, -6.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, -12.228f, -2.25f, 0.07f, 0.07f, 0.07f,
+        90.522f, -12.824f, -2.25f, 0.07f, 0.07f, 0.07f,
+        89.464f, -13.194f, -6.5f, 0.07f, 0.07f, 0.07f,
+        88.353f, -13.31f, -6.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, -13.194f, -2.25f, 0.07f, 0.07f, 0.07f,
+        88.353f, -13.31f, -2.25f, 0.07f, 0.07f, 0.07f,
+        92.858f, -10.488f, -6.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, -11.437f, -6.5f, 0.07f, 0.07f, 0.07f,
+        92.858f, -10.488f, -2.25f, 0.07f, 0.07f, 0.07f,
+        92.262f, -11.437f, -2.25f, 0.07f, 0.07f, 0.07f,
+        58.785f, -13.333f, -2.25f, 0.07f, 0.07f, 0.07f,
+        2.815f, 13.3f, -2.25f, 0.07f, 0.07f, 0.07f,
+        59.839f, 13.3f, -1.999f, 0.07f, 0.07f, 0.07f,
+        -31.722f, -9.412f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -5.716f, -0.7f, 0.07f, 0.07f, 0.07f,
+        -31.847f, -6.34f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, -12.805f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, -12.209f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, -13.3f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -27.959f, -13.175f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -30.756f, -11.417f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -31.352f, -10.469f, -0.5f, 0.07f, 0.07f, 0.07f,
+        1.761f, -13.333f, -1.999f, 0.07f, 0.07f, 0.07f,
+        0.83f, -13.333f, -1.351f, 0.07f, 0.07f, 0.07f,
+        0.152f, -13.333f, -0.563f, 0.07f, 0.07f, 0.07f,
+        -27.959f, 13.175f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, 13.3f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -31.352f, 10.469f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -30.756f, 11.417f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 5.128f, -1.423f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 5.707f, -0.7f, 0.07f, 0.07f, 0.07f,
+        -31.722f, 9.412f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, 12.209f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, 12.805f, -0.5f, 0.07f, 0.07f, 0.07f,
+        60.77f, 13.3f, -1.351f, 0.07f, 0.07f, 0.07f,
+        61.448f, 13.3f, -0.563f, 0.07f, 0.07f, 0.07f,
+        88.353f, 13.3f, -0.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, 9.412f, -0.5f, 0.07f, 0.07f, 0.07f,
+        93.353f, 8.3f, -0.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, 12.805f, -0.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, 12.209f, -0.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, 13.175f, -0.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, 11.417f, -0.5f, 0.07f, 0.07f, 0.07f,
+        92.858f, 10.469f, -0.5f, 0.07f, 0.07f, 0.07f,
+        93.353f, -8.31f, -0.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, -9.431f, -0.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, -12.228f, -0.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, -12.824f, -0.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, -13.194f, -0.5f, 0.07f, 0.07f, 0.07f,
+        88.353f, -13.31f, -0.5f, 0.07f, 0.07f, 0.07f,
+        92.858f, -10.488f, -0.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, -11.437f, -0.5f, 0.07f, 0.07f, 0.07f,
+        0.83f, 13.3f, -1.351f, 0.07f, 0.07f, 0.07f,
+        59.839f, -13.333f, -1.999f, 0.07f, 0.07f, 0.07f,
+        58.8f, 13.3f, -2.25f, 0.07f, 0.07f, 0.07f,
+        0.151f, 13.3f, -0.563f, 0.07f, 0.07f, 0.07f,
+        60.77f, -13.333f, -1.351f, 0.07f, 0.07f, 0.07f,
+        61.448f, -13.333f, -0.563f, 0.07f, 0.07f, 0.07f,
+        -26.844f, -11.518f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -26.847f, -11.634f, -7.898f, 0.07f, 0.07f, 0.07f,
+        88.349f, -11.528f, -7.94f, 0.07f, 0.07f, 0.07f,
+        88.353f, -11.644f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -27.563f, -11.437f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -27.589f, -11.551f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -28.294f, -11.304f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -28.243f, -11.199f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -28.926f, -10.907f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -28.854f, -10.816f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -29.454f, -10.379f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -29.363f, -10.306f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -29.852f, -9.746f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -29.747f, -9.696f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -30.098f, -9.041f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -29.985f, -9.016f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -30.181f, -8.3f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -30.066f, -8.297f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -30.181f, 8.3f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -30.065f, 8.296f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -29.985f, 9.015f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -30.098f, 9.041f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -29.852f, 9.746f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -29.747f, 9.696f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -29.454f, 10.379f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -29.363f, 10.306f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -28.926f, 10.907f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -28.854f, 10.816f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -28.294f, 11.304f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -28.243f, 11.199f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -27.589f, 11.551f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -27.563f, 11.437f, -7.94f, 0.07f, 0.07f, 0.07f,
+        -26.847f, 11.634f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -26.844f, 11.518f, -7.94f, 0.07f, 0.07f, 0.07f,
+        88.353f, 11.634f, -7.898f, 0.07f, 0.07f, 0.07f,
+        88.349f, 11.518f, -7.94f, 0.07f, 0.07f, 0.07f,
+        89.068f, 11.437f, -7.94f, 0.07f, 0.07f, 0.07f,
+        89.094f, 11.551f, -7.898f, 0.07f, 0.07f, 0.07f,
+        89.799f, 11.304f, -7.898f, 0.07f, 0.07f, 0.07f,
+        89.749f, 11.199f, -7.94f, 0.07f, 0.07f, 0.07f,
+        90.432f, 10.907f, -7.898f, 0.07f, 0.07f, 0.07f,
+        90.359f, 10.816f, -7.94f, 0.07f, 0.07f, 0.07f,
+        90.96f, 10.379f, -7.898f, 0.07f, 0.07f, 0.07f,
+        90.869f, 10.306f, -7.94f, 0.07f, 0.07f, 0.07f,
+        91.357f, 9.746f, -7.898f, 0.07f, 0.07f, 0.07f,
+        91.252f, 9.696f, -7.94f, 0.07f, 0.07f, 0.07f,
+        91.604f, 9.041f, -7.898f, 0.07f, 0.07f, 0.07f,
+        91.49f, 9.016f, -7.94f, 0.07f, 0.07f, 0.07f,
+        89.069f, -11.456f, -7.94f, 0.07f, 0.07f, 0.07f,
+        89.094f, -11.57f, -7.898f, 0.07f, 0.07f, 0.07f,
+        89.799f, -11.323f, -7.898f, 0.07f, 0.07f, 0.07f,
+        89.749f, -11.219f, -7.94f, 0.07f, 0.07f, 0.07f,
+        90.359f, -10.835f, -7.94f, 0.07f, 0.07f, 0.07f,
+        90.432f, -10.926f, -7.898f, 0.07f, 0.07f, 0.07f,
+        90.869f, -10.325f, -7.94f, 0.07f, 0.07f, 0.07f,
+        90.96f, -10.398f, -7.898f, 0.07f, 0.07f, 0.07f,
+        91.252f, -9.715f, -7.94f, 0.07f, 0.07f, 0.07f,
+        91.357f, -9.766f, -7.898f, 0.07f, 0.07f, 0.07f,
+        91.49f, -9.035f, -7.94f, 0.07f, 0.07f, 0.07f,
+        91.604f, -9.061f, -7.898f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 3.313f, -2.495f, 0.07f, 0.07f, 0.07f,
+        -31.847f, 6.354f, -0.5f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -5.138f, -1.423f, 0.07f, 0.07f, 0.07f,
+        70.993f, 9.763f, -8.431f, 0.07f, 0.07f, 0.07f,
+        67.979f, 9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        70.993f, 9.596f, -18.0f, 0.07f, 0.07f, 0.07f,
+        68.03f, 9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        61.23f, 0.0f, -8.431f, 0.07f, 0.07f, 0.07f,
+        61.707f, -3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        61.397f, 0.0f, -18.0f, 0.07f, 0.07f, 0.07f,
+        61.866f, -2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        65.255f, -7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        67.979f, -9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        65.353f, -7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        68.03f, -9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        70.993f, -9.763f, -8.431f, 0.07f, 0.07f, 0.07f,
+        70.993f, -9.596f, -18.0f, 0.07f, 0.07f, 0.07f,
+        63.094f, -5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        63.229f, -5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        63.094f, 5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        61.707f, 3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        63.229f, 5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        61.866f, 2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        65.255f, 7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        65.353f, 7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        73.956f, -9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        74.007f, -9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        80.756f, 0.0f, -8.431f, 0.07f, 0.07f, 0.07f,
+        80.279f, 3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        80.589f, 0.0f, -18.0f, 0.07f, 0.07f, 0.07f,
+        80.12f, 2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        76.731f, 7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        74.007f, 9.286f, -8.431f, 0.07f, 0.07f, 0.07f,
+        76.633f, 7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        73.956f, 9.127f, -18.0f, 0.07f, 0.07f, 0.07f,
+        78.892f, 5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        78.757f, 5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        78.892f, -5.738f, -8.431f, 0.07f, 0.07f, 0.07f,
+        80.279f, -3.014f, -8.431f, 0.07f, 0.07f, 0.07f,
+        78.757f, -5.64f, -18.0f, 0.07f, 0.07f, 0.07f,
+        80.12f, -2.963f, -18.0f, 0.07f, 0.07f, 0.07f,
+        76.731f, -7.899f, -8.431f, 0.07f, 0.07f, 0.07f,
+        76.633f, -7.764f, -18.0f, 0.07f, 0.07f, 0.07f,
+        70.993f, 10.264f, -7.94f, 0.07f, 0.07f, 0.07f,
+        67.824f, 9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        60.728f, 0.0f, -7.94f, 0.07f, 0.07f, 0.07f,
+        61.23f, -3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        64.96f, -8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        67.824f, -9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        70.993f, -10.264f, -7.94f, 0.07f, 0.07f, 0.07f,
+        62.688f, -6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        62.688f, 6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        61.23f, 3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        64.96f, 8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        74.162f, -9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        81.257f, 0.0f, -7.94f, 0.07f, 0.07f, 0.07f,
+        80.756f, 3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        77.026f, 8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        74.162f, 9.763f, -7.94f, 0.07f, 0.07f, 0.07f,
+        79.297f, 6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        79.297f, -6.033f, -7.94f, 0.07f, 0.07f, 0.07f,
+        80.756f, -3.169f, -7.94f, 0.07f, 0.07f, 0.07f,
+        77.026f, -8.304f, -7.94f, 0.07f, 0.07f, 0.07f,
+        65.353f, -7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        68.03f, -9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        65.353f, -7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        68.03f, -9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        70.993f, -9.596f, -19.5f, 0.07f, 0.07f, 0.07f,
+        70.993f, -9.596f, -22.997f, 0.07f, 0.07f, 0.07f,
+        63.229f, -5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        63.229f, -5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        61.397f, 0.0f, -19.5f, 0.07f, 0.07f, 0.07f,
+        61.866f, -2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        61.397f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        61.866f, -2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        63.229f, 5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        61.866f, 2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        63.229f, 5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        61.866f, 2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        65.353f, 7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        65.353f, 7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        70.993f, 9.596f, -19.5f, 0.07f, 0.07f, 0.07f,
+        68.03f, 9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        70.993f, 9.596f, -22.997f, 0.07f, 0.07f, 0.07f,
+        68.03f, 9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        76.633f, 7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        73.956f, 9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        76.633f, 7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        73.956f, 9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        78.757f, 5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        78.757f, 5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        80.589f, 0.0f, -19.5f, 0.07f, 0.07f, 0.07f,
+        80.12f, 2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        80.589f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        80.12f, 2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        78.757f, -5.64f, -19.5f, 0.07f, 0.07f, 0.07f,
+        80.12f, -2.963f, -19.5f, 0.07f, 0.07f, 0.07f,
+        78.757f, -5.64f, -22.997f, 0.07f, 0.07f, 0.07f,
+        80.12f, -2.963f, -22.997f, 0.07f, 0.07f, 0.07f,
+        76.633f, -7.764f, -19.5f, 0.07f, 0.07f, 0.07f,
+        76.633f, -7.764f, -22.997f, 0.07f, 0.07f, 0.07f,
+        73.956f, -9.127f, -19.5f, 0.07f, 0.07f, 0.07f,
+        73.956f, -9.127f, -22.997f, 0.07f, 0.07f, 0.07f,
+        65.742f, -7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        68.235f, -8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        70.993f, -8.933f, -22.997f, 0.07f, 0.07f, 0.07f,
+        63.766f, -5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        62.06f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        62.496f, -2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        63.766f, 5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        62.496f, 2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        65.742f, 7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        70.993f, 8.933f, -22.997f, 0.07f, 0.07f, 0.07f,
+        68.235f, 8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        76.243f, 7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        73.751f, 8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        78.22f, 5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        79.926f, 0.0f, -22.997f, 0.07f, 0.07f, 0.07f,
+        79.49f, 2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        78.22f, -5.25f, -22.997f, 0.07f, 0.07f, 0.07f,
+        79.49f, -2.758f, -22.997f, 0.07f, 0.07f, 0.07f,
+        76.243f, -7.227f, -22.997f, 0.07f, 0.07f, 0.07f,
+        73.751f, -8.497f, -22.997f, 0.07f, 0.07f, 0.07f,
+        68.944f, -6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        67.092f, -5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        70.993f, -6.637f, -22.203f, 0.07f, 0.07f, 0.07f,
+        65.623f, -3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        64.68f, -2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        64.356f, 0.0f, -22.203f, 0.07f, 0.07f, 0.07f,
+        64.68f, 2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        65.623f, 3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        67.092f, 5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        68.944f, 6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        70.993f, 6.637f, -22.203f, 0.07f, 0.07f, 0.07f,
+        73.042f, 6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        74.894f, 5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        76.362f, 3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        77.305f, 2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        77.63f, 0.0f, -22.203f, 0.07f, 0.07f, 0.07f,
+        77.305f, -2.049f, -22.203f, 0.07f, 0.07f, 0.07f,
+        76.362f, -3.901f, -22.203f, 0.07f, 0.07f, 0.07f,
+        74.894f, -5.369f, -22.203f, 0.07f, 0.07f, 0.07f,
+        73.042f, -6.313f, -22.203f, 0.07f, 0.07f, 0.07f,
+        69.128f, -5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        67.443f, -4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        70.993f, -6.039f, -21.5f, 0.07f, 0.07f, 0.07f,
+        66.107f, -3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        65.249f, -1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        64.954f, 0.0f, -21.5f, 0.07f, 0.07f, 0.07f,
+        65.249f, 1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        66.107f, 3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        67.443f, 4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        69.128f, 5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        70.993f, 6.039f, -21.5f, 0.07f, 0.07f, 0.07f,
+        72.858f, 5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        74.542f, 4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        75.879f, 3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        76.737f, 1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        77.032f, 0.0f, -21.5f, 0.07f, 0.07f, 0.07f,
+        76.737f, -1.865f, -21.5f, 0.07f, 0.07f, 0.07f,
+        75.879f, -3.549f, -21.5f, 0.07f, 0.07f, 0.07f,
+        74.542f, -4.886f, -21.5f, 0.07f, 0.07f, 0.07f,
+        72.858f, -5.744f, -21.5f, 0.07f, 0.07f, 0.07f,
+        67.443f, -4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        69.128f, -5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        70.993f, -6.039f, -20.078f, 0.07f, 0.07f, 0.07f,
+        66.107f, -3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        64.954f, 0.0f, -20.078f, 0.07f, 0.07f, 0.07f,
+        65.249f, -1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        66.107f, 3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        65.249f, 1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        67.443f, 4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        70.993f, 6.039f, -20.078f, 0.07f, 0.07f, 0.07f,
+        69.128f, 5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        74.542f, 4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        72.858f, 5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        75.879f, 3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        77.032f, 0.0f, -20.078f, 0.07f, 0.07f, 0.07f,
+        76.737f, 1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        75.879f, -3.549f, -20.078f, 0.07f, 0.07f, 0.07f,
+        76.737f, -1.865f, -20.078f, 0.07f, 0.07f, 0.07f,
+        74.542f, -4.886f, -20.078f, 0.07f, 0.07f, 0.07f,
+        72.858f, -5.744f, -20.078f, 0.07f, 0.07f, 0.07f,
+        -26.847f, -13.3f, 6.3f, 0.07f, 0.07f, 0.07f,
+        88.353f, -13.31f, 6.3f, 0.07f, 0.07f, 0.07f,
+        2.815f, -13.333f, 2.25f, 0.07f, 0.07f, 0.07f,
+        58.785f, -13.333f, 2.25f, 0.07f, 0.07f, 0.07f,
+        88.097f, -13.211f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.591f, -13.201f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, 13.3f, 6.3f, 0.07f, 0.07f, 0.07f,
+        2.815f, 13.3f, 2.25f, 0.07f, 0.07f, 0.07f,
+        88.353f, 13.3f, 6.3f, 0.07f, 0.07f, 0.07f,
+        58.8f, 13.3f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -26.591f, 13.201f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.097f, 13.201f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.591f, 11.982f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, 11.982f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, -13.3f, 2.25f, 0.07f, 0.07f, 0.07f,
+        1.761f, -13.333f, 2.0f, 0.07f, 0.07f, 0.07f,
+        -27.698f, -13.077f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.959f, -13.175f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -28.751f, -12.71f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, -12.805f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -26.847f, 13.3f, 0.5f, 0.07f, 0.07f, 0.07f,
+        0.151f, 13.3f, 0.563f, 0.07f, 0.07f, 0.07f,
+        0.83f, 13.3f, 1.351f, 0.07f, 0.07f, 0.07f,
+        -29.695f, -12.119f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, -12.209f, 6.3f, 0.07f, 0.07f, 0.07f,
+        1.761f, 13.3f, 1.999f, 0.07f, 0.07f, 0.07f,
+        -30.483f, -11.333f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -30.756f, -11.417f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.076f, -10.391f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.352f, -10.469f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.445f, -9.342f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.722f, -9.412f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.847f, -8.3f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.569f, -8.238f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, 13.3f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -27.698f, 13.077f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.959f, 13.175f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.569f, 8.238f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.847f, 8.3f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.445f, 9.342f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.722f, 9.412f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -28.751f, 12.71f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, 12.805f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.352f, 10.469f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -31.076f, 10.391f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.695f, 12.118f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, 12.209f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -30.756f, 11.417f, 6.3f, 0.07f, 0.07f, 0.07f,
+        -30.483f, 11.332f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.847f, -13.3f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -27.959f, -13.175f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -27.959f, -13.175f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, -12.805f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -29.016f, -12.805f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, -12.209f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -29.965f, -12.209f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -30.756f, -11.417f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -30.756f, -11.417f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, -11.897f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.192f, -11.982f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.352f, -10.469f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -31.352f, -10.469f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, -11.645f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.722f, -9.412f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -31.722f, -9.412f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, -11.241f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -5.138f, 1.424f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -4.156f, 2.299f, 0.07f, 0.07f, 0.07f,
+        -29.545f, -10.703f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.937f, -10.058f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -30.18f, -9.34f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -30.263f, -8.585f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 3.313f, 2.497f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 4.146f, 2.299f, 0.07f, 0.07f, 0.07f,
+        -30.263f, 8.585f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -31.722f, 9.412f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 5.707f, 0.701f, 0.07f, 0.07f, 0.07f,
+        -31.847f, 6.354f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -27.959f, 13.175f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -27.959f, 13.175f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -31.722f, 9.412f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -31.352f, 10.469f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -31.352f, 10.469f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -29.016f, 12.805f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -29.016f, 12.805f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -30.756f, 11.417f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -30.756f, 11.417f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -29.965f, 12.209f, 2.25f, 0.07f, 0.07f, 0.07f,
+        -29.965f, 12.209f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -30.18f, 9.34f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, 11.897f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.937f, 10.059f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, 11.646f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.545f, 10.703f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, 11.241f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, -11.992f, 6.5f, 0.07f, 0.07f, 0.07f,
+        59.839f, 13.3f, 1.999f, 0.07f, 0.07f, 0.07f,
+        60.77f, 13.3f, 1.351f, 0.07f, 0.07f, 0.07f,
+        88.353f, 13.3f, 2.25f, 0.07f, 0.07f, 0.07f,
+        89.204f, 13.077f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, 13.175f, 6.3f, 0.07f, 0.07f, 0.07f,
+        90.256f, 12.71f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, 12.805f, 6.3f, 0.07f, 0.07f, 0.07f,
+        91.2f, 12.118f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, 12.209f, 6.3f, 0.07f, 0.07f, 0.07f,
+        91.989f, 11.332f, 6.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, 11.417f, 6.3f, 0.07f, 0.07f, 0.07f,
+        92.582f, 10.391f, 6.5f, 0.07f, 0.07f, 0.07f,
+        92.858f, 10.469f, 6.3f, 0.07f, 0.07f, 0.07f,
+        92.95f, 9.342f, 6.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, 9.412f, 6.3f, 0.07f, 0.07f, 0.07f,
+        93.353f, 8.3f, 6.3f, 0.07f, 0.07f, 0.07f,
+        93.075f, 8.238f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.353f, -13.31f, 2.25f, 0.07f, 0.07f, 0.07f,
+        59.839f, -13.333f, 1.999f, 0.07f, 0.07f, 0.07f,
+        60.77f, -13.333f, 1.351f, 0.07f, 0.07f, 0.07f,
+        88.353f, -13.31f, 0.5f, 0.07f, 0.07f, 0.07f,
+        61.448f, 13.3f, 0.563f, 0.07f, 0.07f, 0.07f,
+        88.353f, 13.3f, 0.5f, 0.07f, 0.07f, 0.07f,
+        61.448f, -13.333f, 0.563f, 0.07f, 0.07f, 0.07f,
+        89.204f, -13.096f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, -13.194f, 6.3f, 0.07f, 0.07f, 0.07f,
+        93.075f, -8.248f, 6.5f, 0.07f, 0.07f, 0.07f,
+        93.353f, -8.31f, 6.3f, 0.07f, 0.07f, 0.07f,
+        92.95f, -9.361f, 6.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, -9.431f, 6.3f, 0.07f, 0.07f, 0.07f,
+        90.256f, -12.729f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, -12.824f, 6.3f, 0.07f, 0.07f, 0.07f,
+        92.858f, -10.488f, 6.3f, 0.07f, 0.07f, 0.07f,
+        92.582f, -10.41f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.2f, -12.138f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, -12.228f, 6.3f, 0.07f, 0.07f, 0.07f,
+        91.989f, -11.352f, 6.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, -11.437f, 6.3f, 0.07f, 0.07f, 0.07f,
+        89.209f, 11.897f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, 11.646f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, 13.175f, 2.25f, 0.07f, 0.07f, 0.07f,
+        90.529f, 11.241f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, 12.805f, 2.25f, 0.07f, 0.07f, 0.07f,
+        91.05f, 10.703f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, 12.209f, 2.25f, 0.07f, 0.07f, 0.07f,
+        89.464f, 13.175f, 0.5f, 0.07f, 0.07f, 0.07f,
+        91.443f, 10.059f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, 12.805f, 0.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, 11.417f, 2.25f, 0.07f, 0.07f, 0.07f,
+        91.686f, 9.34f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.768f, 8.585f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, 12.209f, 0.5f, 0.07f, 0.07f, 0.07f,
+        92.858f, 10.469f, 2.25f, 0.07f, 0.07f, 0.07f,
+        92.262f, 11.417f, 0.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, 9.412f, 2.25f, 0.07f, 0.07f, 0.07f,
+        93.353f, 8.3f, 2.25f, 0.07f, 0.07f, 0.07f,
+        92.858f, 10.469f, 0.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, 9.412f, 0.5f, 0.07f, 0.07f, 0.07f,
+        93.353f, 8.3f, 0.5f, 0.07f, 0.07f, 0.07f,
+        91.768f, -8.595f, 6.5f, 0.07f, 0.07f, 0.07f,
+        93.353f, -8.31f, 2.25f, 0.07f, 0.07f, 0.07f,
+        93.353f, -8.31f, 0.5f, 0.07f, 0.07f, 0.07f,
+        91.686f, -9.36f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.209f, -11.916f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.443f, -10.078f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, -11.665f, 6.5f, 0.07f, 0.07f, 0.07f,
+        91.05f, -10.723f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.529f, -11.26f, 6.5f, 0.07f, 0.07f, 0.07f,
+        93.228f, -9.431f, 2.25f, 0.07f, 0.07f, 0.07f,
+        89.464f, -13.194f, 2.25f, 0.07f, 0.07f, 0.07f,
+        92.858f, -10.488f, 2.25f, 0.07f, 0.07f, 0.07f,
+        90.522f, -12.824f, 2.25f, 0.07f, 0.07f, 0.07f,
+        92.262f, -11.437f, 2.25f, 0.07f, 0.07f, 0.07f,
+        91.47f, -12.228f, 2.25f, 0.07f, 0.07f, 0.07f,
+        93.228f, -9.431f, 0.5f, 0.07f, 0.07f, 0.07f,
+        89.464f, -13.194f, 0.5f, 0.07f, 0.07f, 0.07f,
+        92.858f, -10.488f, 0.5f, 0.07f, 0.07f, 0.07f,
+        90.522f, -12.824f, 0.5f, 0.07f, 0.07f, 0.07f,
+        92.262f, -11.437f, 0.5f, 0.07f, 0.07f, 0.07f,
+        91.47f, -12.228f, 0.5f, 0.07f, 0.07f, 0.07f,
+        0.83f, -13.333f, 1.352f, 0.07f, 0.07f, 0.07f,
+        0.152f, -13.333f, 0.564f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -3.322f, 2.497f, 0.07f, 0.07f, 0.07f,
+        -31.809f, 5.128f, 1.424f, 0.07f, 0.07f, 0.07f,
+        -31.809f, -5.716f, 0.701f, 0.07f, 0.07f, 0.07f,
+        -31.847f, -6.364f, 0.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, 10.787f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, 10.412f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, 11.02f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.577f, 11.099f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, 11.098f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.209f, 11.019f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, 10.786f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.529f, 10.411f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.529f, -8.928f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.529f, -9.792f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, -9.249f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, -10.144f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.209f, -9.448f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.209f, -10.362f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, -9.506f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, -10.427f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.234f, -9.497f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.219f, -10.417f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, -9.43f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, -10.344f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, -9.231f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, -10.125f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, -8.91f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, -9.773f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.529f, -10.555f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, -10.935f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.209f, -11.17f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, -11.24f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.205f, -11.231f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, -11.151f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, -10.915f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, -10.536f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, 9.187f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.529f, 8.867f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.209f, 9.385f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, 9.453f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.549f, 9.454f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, 9.387f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, 9.189f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, 8.869f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.905f, 10.055f, 6.5f, 0.07f, 0.07f, 0.07f,
+        90.529f, 9.705f, 6.5f, 0.07f, 0.07f, 0.07f,
+        89.209f, 10.272f, 6.5f, 0.07f, 0.07f, 0.07f,
+        88.477f, 10.346f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -26.564f, 10.347f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -27.703f, 10.273f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -28.399f, 10.056f, 6.5f, 0.07f, 0.07f, 0.07f,
+        -29.024f, 9.707f, 6.5f, 0.07f, 0.07f, 0.07f,
+        73.114f, 6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        70.993f, 0.0f, -21.5f, 0.22f, 0.22f, 0.22f,
+        75.03f, 5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        76.551f, 4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        77.527f, 2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        77.863f, 0.0f, -21.5f, 0.22f, 0.22f, 0.22f,
+        65.435f, -4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        66.955f, -5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        68.872f, -6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        77.527f, -2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        76.551f, -4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        64.123f, 0.0f, -21.5f, 0.22f, 0.22f, 0.22f,
+        64.459f, 2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        65.435f, 4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        68.872f, 6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        66.955f, 5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        70.993f, 6.87f, -21.5f, 0.22f, 0.22f, 0.22f,
+        73.114f, -6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        75.03f, -5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        70.993f, -6.87f, -21.5f, 0.22f, 0.22f, 0.22f,
+        64.459f, -2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        10.117f, 6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        7.996f, 0.0f, -21.5f, 0.22f, 0.22f, 0.22f,
+        12.033f, 5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        13.554f, 4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        14.53f, 2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        14.866f, 0.0f, -21.5f, 0.22f, 0.22f, 0.22f,
+        2.438f, -4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        3.958f, -5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        5.875f, -6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        14.53f, -2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        13.554f, -4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        1.126f, 0.0f, -21.5f, 0.22f, 0.22f, 0.22f,
+        1.462f, 2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        2.438f, 4.038f, -21.5f, 0.22f, 0.22f, 0.22f,
+        5.875f, 6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        3.958f, 5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        7.996f, 6.87f, -21.5f, 0.22f, 0.22f, 0.22f,
+        10.117f, -6.534f, -21.5f, 0.22f, 0.22f, 0.22f,
+        12.033f, -5.558f, -21.5f, 0.22f, 0.22f, 0.22f,
+        7.996f, -6.87f, -21.5f, 0.22f, 0.22f, 0.22f,
+        1.462f, -2.121f, -21.5f, 0.22f, 0.22f, 0.22f,
+        65.353f, -7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        68.03f, -9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        65.353f, -7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        68.03f, -9.127f, -19.5f, 1.0f, 1.0f, 0.0f,
+        70.993f, -9.596f, -18.0f, 1.0f, 1.0f, 0.0f,
+        70.993f, -9.596f, -19.5f, 1.0f, 1.0f, 0.0f,
+        63.229f, -5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        63.229f, -5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        61.397f, 0.0f, -18.0f, 1.0f, 1.0f, 0.0f,
+        61.866f, -2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        61.397f, 0.0f, -19.5f, 1.0f, 1.0f, 0.0f,
+        61.866f, -2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        63.229f, 5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        61.866f, 2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        63.229f, 5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        61.866f, 2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        65.353f, 7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        65.353f, 7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        70.993f, 9.596f, -18.0f, 1.0f, 1.0f, 0.0f,
+        68.03f, 9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        70.993f, 9.596f, -19.5f, 1.0f, 1.0f, 0.0f,
+        68.03f, 9.127f, -19.5f, 1.0f, 1.0f, 0.0f,
+        76.633f, 7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        73.956f, 9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        76.633f, 7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        73.956f, 9.127f, -19.5f, 1.0f, 1.0f, 0.0f,
+        78.757f, 5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        78.757f, 5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        80.589f, 0.0f, -18.0f, 1.0f, 1.0f, 0.0f,
+        80.12f, 2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        80.589f, 0.0f, -19.5f, 1.0f, 1.0f, 0.0f,
+        80.12f, 2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        78.757f, -5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        80.12f, -2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        78.757f, -5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        80.12f, -2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        76.633f, -7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        76.633f, -7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        73.956f, -9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        73.956f, -9.127f, -19.5f, 1.0f, 1.0f, 0.0f,
+        2.356f, -7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        5.033f, -9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        2.356f, -7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        5.033f, -9.127f, -19.5f, 1.0f, 1.0f, 0.0f,
+        7.996f, -9.596f, -18.0f, 1.0f, 1.0f, 0.0f,
+        7.996f, -9.596f, -19.5f, 1.0f, 1.0f, 0.0f,
+        0.232f, -5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        0.232f, -5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        -1.6f, 0.0f, -18.0f, 1.0f, 1.0f, 0.0f,
+        -1.131f, -2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        -1.6f, 0.0f, -19.5f, 1.0f, 1.0f, 0.0f,
+        -1.131f, -2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        0.232f, 5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        -1.131f, 2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        0.232f, 5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        -1.131f, 2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        2.356f, 7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        2.356f, 7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        7.996f, 9.596f, -18.0f, 1.0f, 1.0f, 0.0f,
+        5.033f, 9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        7.996f, 9.596f, -19.5f, 1.0f, 1.0f, 0.0f,
+        5.033f, 9.127f, -19.5f, 1.0f, 1.0f, 0.0f,
+        13.636f, 7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        10.959f, 9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        13.636f, 7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        10.959f, 9.127f, -19.5f, 1.0f, 1.0f, 0.0f,
+        15.76f, 5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        15.76f, 5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        17.592f, 0.0f, -18.0f, 1.0f, 1.0f, 0.0f,
+        17.123f, 2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        17.592f, 0.0f, -19.5f, 1.0f, 1.0f, 0.0f,
+        17.123f, 2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        15.76f, -5.64f, -18.0f, 1.0f, 1.0f, 0.0f,
+        17.123f, -2.963f, -18.0f, 1.0f, 1.0f, 0.0f,
+        15.76f, -5.64f, -19.5f, 1.0f, 1.0f, 0.0f,
+        17.123f, -2.963f, -19.5f, 1.0f, 1.0f, 0.0f,
+        13.636f, -7.764f, -18.0f, 1.0f, 1.0f, 0.0f,
+        13.636f, -7.764f, -19.5f, 1.0f, 1.0f, 0.0f,
+        10.959f, -9.127f, -18.0f, 1.0f, 1.0f, 0.0f,
+        10.959f, -9.127f, -19.5f, 1.0f, 1.0f, 0.0f};
+
+    const unsigned short zed_m_indices[] = {
+        0, 1, 2,
+        1, 0, 3,
+        1, 3, 4,
+        1, 4, 5,
+        1, 5, 6,
+        1, 7, 8,
+        1, 9, 7,
+        1, 6, 9,
+        1, 10, 2,
+        1, 11, 10,
+        1, 12, 11,
+        1, 13, 12,
+        1, 14, 15,
+        1, 15, 16,
+        1, 16, 13,
+        8, 14, 1,
+        8, 14, 1,
+        17, 18, 19,
+        17, 20, 18,
+        17, 21, 20,
+        17, 22, 21,
+        17, 22, 21,
+        17, 23, 24,
+        17, 24, 25,
+        17, 25, 22,
+        19, 26, 17,
+        23, 17, 27,
+        17, 26, 28,
+        17, 28, 29,
+        17, 29, 30,
+        17, 30, 31,
+        17, 30, 31,
+        17, 32, 27,
+        17, 33, 32,
+        17, 31, 33,
+        34, 35, 36,
+        36, 35, 37,
+        38, 39, 40,
+        40, 39, 41,
+        42, 43, 44,
+        44, 43, 45,
+        44, 45, 38,
+        38, 45, 39,
+        46, 47, 48,
+        48, 47, 49,
+        40, 41, 46,
+        46, 41, 47,
+        48, 49, 34,
+        34, 49, 35,
+        50, 51, 52,
+        52, 51, 53,
+        54, 55, 56,
+        56, 55, 57,
+        58, 59, 60,
+        60, 59, 61,
+        56, 57, 60,
+        60, 57, 58,
+        62, 63, 64,
+        64, 63, 65,
+        64, 65, 54,
+        54, 65, 55,
+        52, 53, 62,
+        62, 53, 63,
+        36, 37, 66,
+        66, 37, 67,
+        51, 50, 68,
+        68, 50, 69,
+        66, 67, 70,
+        70, 67, 71,
+        68, 69, 72,
+        72, 69, 73,
+        70, 71, 74,
+        72, 73, 74,
+        70, 74, 75,
+        74, 71, 76,
+        72, 74, 77,
+        74, 73, 78,
+        75, 74, 79,
+        74, 76, 80,
+        74, 78, 81,
+        77, 74, 82,
+        79, 74, 83,
+        74, 80, 84,
+        74, 81, 85,
+        82, 74, 86,
+        83, 74, 85,
+        74, 84, 86,
+        87, 12, 88,
+        88, 12, 13,
+        89, 90, 5,
+        5, 90, 6,
+        91, 92, 93,
+        93, 92, 94,
+        95, 96, 97,
+        97, 96, 98,
+        89, 99, 90,
+        90, 99, 100,
+        99, 95, 100,
+        100, 95, 97,
+        101, 102, 103,
+        103, 102, 104,
+        96, 101, 98,
+        98, 101, 103,
+        102, 91, 104,
+        104, 91, 93,
+        92, 105, 94,
+        94, 105, 106,
+        105, 107, 106,
+        106, 107, 108,
+        109, 110, 111,
+        111, 110, 112,
+        113, 114, 115,
+        115, 114, 116,
+        110, 113, 112,
+        112, 113, 115,
+        117, 118, 119,
+        119, 118, 120,
+        118, 109, 120,
+        120, 109, 111,
+        107, 117, 108,
+        108, 117, 119,
+        61, 59, 30,
+        30, 59, 31,
+        114, 21, 116,
+        116, 21, 22,
+        121, 122, 123,
+        123, 122, 124,
+        125, 126, 127,
+        127, 126, 128,
+        129, 130, 131,
+        131, 130, 132,
+        130, 133, 132,
+        132, 133, 134,
+        135, 129, 136,
+        136, 129, 131,
+        126, 135, 128,
+        128, 135, 136,
+        137, 138, 139,
+        139, 138, 140,
+        138, 125, 140,
+        140, 125, 127,
+        141, 137, 142,
+        142, 137, 139,
+        122, 141, 124,
+        124, 141, 142,
+        134, 133, 143,
+        143, 133, 144,
+        145, 146, 147,
+        147, 146, 148,
+        149, 150, 151,
+        151, 150, 152,
+        150, 121, 152,
+        152, 121, 123,
+        153, 149, 154,
+        154, 149, 151,
+        146, 153, 148,
+        148, 153, 154,
+        155, 156, 157,
+        157, 156, 158,
+        156, 145, 158,
+        158, 145, 147,
+        159, 155, 160,
+        160, 155, 157,
+        144, 159, 143,
+        143, 159, 160,
+        121, 161, 122,
+        122, 161, 162,
+        125, 163, 126,
+        126, 163, 164,
+        129, 165, 130,
+        130, 165, 166,
+        130, 166, 133,
+        133, 166, 167,
+        135, 168, 129,
+        129, 168, 165,
+        126, 164, 135,
+        135, 164, 168,
+        137, 169, 138,
+        138, 169, 170,
+        138, 170, 125,
+        125, 170, 163,
+        141, 171, 137,
+        137, 171, 169,
+        122, 162, 141,
+        141, 162, 171,
+        133, 167, 144,
+        144, 167, 172,
+        145, 173, 146,
+        146, 173, 174,
+        149, 175, 150,
+        150, 175, 176,
+        150, 176, 121,
+        121, 176, 161,
+        153, 177, 149,
+        149, 177, 175,
+        146, 174, 153,
+        153, 174, 177,
+        155, 178, 156,
+        156, 178, 179,
+        156, 179, 145,
+        145, 179, 173,
+        159, 180, 155,
+        155, 180, 178,
+        144, 172, 159,
+        159, 172, 180,
+        181, 182, 183,
+        183, 182, 184,
+        182, 185, 184,
+        184, 185, 186,
+        187, 181, 188,
+        188, 181, 183,
+        189, 190, 191,
+        191, 190, 192,
+        190, 187, 192,
+        192, 187, 188,
+        193, 194, 195,
+        195, 194, 196,
+        194, 189, 196,
+        196, 189, 191,
+        197, 193, 198,
+        198, 193, 195,
+        199, 200, 201,
+        201, 200, 202,
+        200, 197, 202,
+        202, 197, 198,
+        203, 204, 205,
+        205, 204, 206,
+        204, 199, 206,
+        206, 199, 201,
+        207, 203, 208,
+        208, 203, 205,
+        209, 210, 211,
+        211, 210, 212,
+        210, 207, 212,
+        212, 207, 208,
+        213, 214, 215,
+        215, 214, 216,
+        214, 209, 216,
+        216, 209, 211,
+        217, 213, 218,
+        218, 213, 215,
+        185, 219, 186,
+        186, 219, 220,
+        219, 217, 220,
+        220, 217, 218,
+        183, 184, 221,
+        221, 184, 222,
+        184, 186, 222,
+        222, 186, 223,
+        188, 183, 224,
+        224, 183, 221,
+        191, 192, 225,
+        225, 192, 226,
+        192, 188, 226,
+        226, 188, 224,
+        195, 196, 227,
+        227, 196, 228,
+        196, 191, 228,
+        228, 191, 225,
+        198, 195, 229,
+        229, 195, 227,
+        201, 202, 230,
+        230, 202, 231,
+        202, 198, 231,
+        231, 198, 229,
+        205, 206, 232,
+        232, 206, 233,
+        206, 201, 233,
+        233, 201, 230,
+        208, 205, 234,
+        234, 205, 232,
+        211, 212, 235,
+        235, 212, 236,
+        212, 208, 236,
+        236, 208, 234,
+        215, 216, 237,
+        237, 216, 238,
+        216, 211, 238,
+        238, 211, 235,
+        218, 215, 239,
+        239, 215, 237,
+        186, 220, 223,
+        223, 220, 240,
+        220, 218, 240,
+        240, 218, 239,
+        222, 241, 221,
+        221, 241, 242,
+        223, 243, 222,
+        222, 243, 241,
+        221, 242, 224,
+        224, 242, 244,
+        226, 245, 225,
+        225, 245, 246,
+        224, 244, 226,
+        226, 244, 245,
+        228, 247, 227,
+        227, 247, 248,
+        225, 246, 228,
+        228, 246, 247,
+        227, 248, 229,
+        229, 248, 249,
+        231, 250, 230,
+        230, 250, 251,
+        229, 249, 231,
+        231, 249, 250,
+        233, 252, 232,
+        232, 252, 253,
+        230, 251, 233,
+        233, 251, 252,
+        232, 253, 234,
+        234, 253, 254,
+        236, 255, 235,
+        235, 255, 256,
+        234, 254, 236,
+        236, 254, 255,
+        238, 257, 237,
+        237, 257, 258,
+        235, 256, 238,
+        238, 256, 257,
+        237, 258, 239,
+        239, 258, 259,
+        240, 260, 223,
+        223, 260, 243,
+        239, 259, 240,
+        240, 259, 260,
+        261, 262, 241,
+        241, 262, 242,
+        263, 261, 243,
+        243, 261, 241,
+        242, 262, 244,
+        244, 262, 264,
+        265, 266, 245,
+        245, 266, 246,
+        264, 265, 244,
+        244, 265, 245,
+        267, 268, 247,
+        247, 268, 248,
+        266, 267, 246,
+        246, 267, 247,
+        268, 269, 248,
+        248, 269, 249,
+        270, 271, 250,
+        250, 271, 251,
+        269, 270, 249,
+        249, 270, 250,
+        272, 273, 252,
+        252, 273, 253,
+        271, 272, 251,
+        251, 272, 252,
+        273, 274, 253,
+        253, 274, 254,
+        275, 276, 255,
+        255, 276, 256,
+        274, 275, 254,
+        254, 275, 255,
+        277, 278, 257,
+        257, 278, 258,
+        276, 277, 256,
+        256, 277, 257,
+        278, 279, 258,
+        258, 279, 259,
+        280, 263, 260,
+        260, 263, 243,
+        279, 280, 259,
+        259, 280, 260,
+        262, 261, 281,
+        281, 261, 282,
+        261, 263, 282,
+        282, 263, 283,
+        264, 262, 284,
+        284, 262, 281,
+        266, 265, 285,
+        285, 265, 286,
+        265, 264, 286,
+        286, 264, 284,
+        268, 267, 287,
+        287, 267, 288,
+        267, 266, 288,
+        288, 266, 285,
+        269, 268, 289,
+        289, 268, 287,
+        271, 270, 290,
+        290, 270, 291,
+        270, 269, 291,
+        291, 269, 289,
+        273, 272, 292,
+        292, 272, 293,
+        272, 271, 293,
+        293, 271, 290,
+        274, 273, 294,
+        294, 273, 292,
+        276, 275, 295,
+        295, 275, 296,
+        275, 274, 296,
+        296, 274, 294,
+        278, 277, 297,
+        297, 277, 298,
+        277, 276, 298,
+        298, 276, 295,
+        279, 278, 299,
+        299, 278, 297,
+        263, 280, 283,
+        283, 280, 300,
+        280, 279, 300,
+        300, 279, 299,
+        301, 302, 303,
+        302, 304, 303,
+        304, 305, 303,
+        305, 306, 303,
+        307, 308, 309,
+        309, 308, 310,
+        311, 312, 313,
+        313, 312, 314,
+        315, 316, 317,
+        317, 316, 318,
+        316, 311, 318,
+        318, 311, 313,
+        319, 320, 321,
+        321, 320, 322,
+        312, 319, 314,
+        314, 319, 321,
+        320, 307, 322,
+        322, 307, 309,
+        323, 315, 317,
+        308, 324, 310,
+        325, 326, 327,
+        327, 326, 328,
+        329, 330, 331,
+        331, 330, 332,
+        333, 334, 335,
+        335, 334, 336,
+        333, 329, 334,
+        334, 329, 331,
+        337, 338, 339,
+        339, 338, 340,
+        330, 337, 332,
+        332, 337, 339,
+        338, 325, 340,
+        340, 325, 327,
+        326, 341, 328,
+        342, 301, 343,
+        343, 301, 344,
+        345, 346, 347,
+        347, 346, 348,
+        349, 350, 351,
+        351, 350, 352,
+        350, 345, 352,
+        352, 345, 347,
+        353, 354, 355,
+        355, 354, 356,
+        346, 353, 348,
+        348, 353, 355,
+        354, 342, 356,
+        356, 342, 343,
+        301, 303, 344,
+        344, 303, 357,
+        303, 358, 357,
+        357, 358, 359,
+        360, 361, 362,
+        362, 361, 363,
+        364, 365, 366,
+        366, 365, 367,
+        361, 364, 363,
+        363, 364, 366,
+        368, 369, 370,
+        370, 369, 371,
+        369, 360, 371,
+        371, 360, 362,
+        358, 368, 359,
+        359, 368, 370,
+        372, 365, 323,
+        323, 365, 315,
+        341, 326, 373,
+        365, 372, 367,
+        374, 349, 351,
+        375, 376, 377,
+        313, 314, 378,
+        378, 314, 379,
+        317, 318, 380,
+        380, 318, 381,
+        318, 313, 381,
+        381, 313, 378,
+        321, 322, 382,
+        382, 322, 383,
+        314, 321, 379,
+        379, 321, 382,
+        322, 309, 383,
+        383, 309, 375,
+        323, 317, 384,
+        384, 317, 385,
+        385, 317, 386,
+        317, 380, 386,
+        327, 328, 387,
+        387, 328, 388,
+        331, 332, 389,
+        389, 332, 390,
+        391, 334, 392,
+        392, 334, 393,
+        334, 331, 393,
+        393, 331, 389,
+        339, 340, 394,
+        394, 340, 395,
+        332, 339, 390,
+        390, 339, 394,
+        340, 327, 395,
+        395, 327, 387,
+        396, 351, 397,
+        397, 351, 398,
+        343, 344, 399,
+        399, 344, 400,
+        347, 348, 401,
+        401, 348, 402,
+        351, 352, 398,
+        398, 352, 403,
+        352, 347, 403,
+        403, 347, 401,
+        355, 356, 404,
+        404, 356, 405,
+        348, 355, 402,
+        402, 355, 404,
+        356, 343, 405,
+        405, 343, 399,
+        344, 357, 400,
+        400, 357, 406,
+        357, 359, 406,
+        406, 359, 407,
+        362, 363, 408,
+        408, 363, 409,
+        366, 367, 410,
+        410, 367, 411,
+        363, 366, 409,
+        409, 366, 410,
+        370, 371, 412,
+        412, 371, 413,
+        371, 362, 413,
+        413, 362, 408,
+        359, 370, 407,
+        407, 370, 412,
+        341, 414, 328,
+        328, 414, 388,
+        367, 372, 415,
+        416, 349, 374,
+        326, 349, 373,
+        373, 349, 416,
+        374, 351, 396,
+        388, 414, 417,
+        411, 418, 419,
+        415, 418, 367,
+        367, 418, 411,
+        420, 421, 422,
+        422, 421, 423,
+        420, 424, 421,
+        421, 424, 425,
+        425, 424, 426,
+        426, 424, 427,
+        426, 427, 428,
+        428, 427, 429,
+        428, 429, 430,
+        430, 429, 431,
+        430, 431, 432,
+        432, 431, 433,
+        432, 433, 434,
+        434, 433, 435,
+        434, 435, 436,
+        436, 435, 437,
+        436, 437, 438,
+        438, 437, 439,
+        439, 440, 438,
+        438, 440, 441,
+        441, 440, 442,
+        442, 440, 443,
+        442, 443, 444,
+        444, 443, 445,
+        444, 445, 446,
+        446, 445, 447,
+        446, 447, 448,
+        448, 447, 449,
+        448, 449, 450,
+        450, 449, 451,
+        450, 451, 452,
+        452, 451, 453,
+        452, 453, 454,
+        454, 453, 455,
+        455, 456, 454,
+        454, 456, 457,
+        457, 456, 458,
+        458, 456, 459,
+        458, 459, 460,
+        460, 459, 461,
+        460, 461, 462,
+        462, 461, 463,
+        462, 463, 464,
+        464, 463, 465,
+        464, 465, 466,
+        466, 465, 467,
+        466, 467, 302,
+        302, 467, 304,
+        422, 423, 468,
+        468, 423, 469,
+        469, 470, 468,
+        468, 470, 471,
+        471, 470, 472,
+        472, 470, 473,
+        472, 473, 474,
+        474, 473, 475,
+        474, 475, 476,
+        476, 475, 477,
+        476, 477, 478,
+        478, 477, 479,
+        479, 306, 478,
+        478, 306, 305,
+        308, 307, 436,
+        436, 307, 434,
+        312, 311, 428,
+        428, 311, 426,
+        316, 315, 425,
+        425, 315, 421,
+        311, 316, 426,
+        426, 316, 425,
+        320, 319, 432,
+        432, 319, 430,
+        319, 312, 430,
+        430, 312, 428,
+        307, 320, 434,
+        434, 320, 432,
+        436, 438, 308,
+        308, 438, 335,
+        326, 325, 452,
+        452, 325, 450,
+        330, 329, 444,
+        444, 329, 442,
+        333, 335, 441,
+        441, 335, 438,
+        329, 333, 442,
+        442, 333, 441,
+        338, 337, 448,
+        448, 337, 446,
+        337, 330, 446,
+        446, 330, 444,
+        325, 338, 450,
+        450, 338, 448,
+        301, 342, 302,
+        302, 342, 466,
+        346, 345, 460,
+        460, 345, 458,
+        350, 349, 457,
+        457, 349, 454,
+        345, 350, 458,
+        458, 350, 457,
+        354, 353, 464,
+        464, 353, 462,
+        353, 346, 462,
+        462, 346, 460,
+        342, 354, 466,
+        466, 354, 464,
+        423, 365, 469,
+        469, 365, 364,
+        470, 469, 361,
+        361, 469, 364,
+        473, 470, 360,
+        360, 470, 361,
+        475, 473, 369,
+        369, 473, 360,
+        477, 475, 368,
+        368, 475, 369,
+        479, 477, 358,
+        358, 477, 368,
+        303, 306, 358,
+        358, 306, 479,
+        435, 433, 440,
+        440, 433, 443,
+        433, 431, 443,
+        443, 431, 445,
+        431, 429, 445,
+        445, 429, 447,
+        429, 427, 447,
+        447, 427, 449,
+        427, 424, 449,
+        449, 424, 451,
+        424, 420, 451,
+        451, 420, 453,
+        422, 468, 455,
+        455, 468, 456,
+        468, 471, 456,
+        456, 471, 459,
+        471, 472, 459,
+        459, 472, 461,
+        472, 474, 461,
+        461, 474, 463,
+        474, 476, 463,
+        463, 476, 465,
+        476, 478, 465,
+        465, 478, 467,
+        478, 305, 467,
+        467, 305, 304,
+        439, 437, 440,
+        440, 437, 435,
+        421, 315, 423,
+        423, 315, 365,
+        422, 455, 420,
+        420, 455, 453,
+        326, 452, 349,
+        349, 452, 454,
+        335, 480, 308,
+        308, 480, 324,
+        480, 335, 336,
+        392, 393, 481,
+        336, 334, 391,
+        482, 376, 309,
+        309, 376, 375,
+        309, 310, 482,
+        483, 484, 485,
+        485, 484, 486,
+        487, 488, 489,
+        489, 488, 490,
+        491, 492, 493,
+        493, 492, 494,
+        492, 495, 494,
+        494, 495, 496,
+        497, 491, 498,
+        498, 491, 493,
+        488, 497, 490,
+        490, 497, 498,
+        499, 500, 501,
+        501, 500, 502,
+        500, 487, 502,
+        502, 487, 489,
+        503, 499, 504,
+        504, 499, 501,
+        484, 503, 486,
+        486, 503, 504,
+        496, 495, 505,
+        505, 495, 506,
+        507, 508, 509,
+        509, 508, 510,
+        511, 512, 513,
+        513, 512, 514,
+        512, 483, 514,
+        514, 483, 485,
+        515, 511, 516,
+        516, 511, 513,
+        508, 515, 510,
+        510, 515, 516,
+        517, 518, 519,
+        519, 518, 520,
+        518, 507, 520,
+        520, 507, 509,
+        521, 517, 522,
+        522, 517, 519,
+        506, 521, 505,
+        505, 521, 522,
+        483, 523, 484,
+        484, 523, 524,
+        487, 525, 488,
+        488, 525, 526,
+        491, 527, 492,
+        492, 527, 528,
+        492, 528, 495,
+        495, 528, 529,
+        497, 530, 491,
+        491, 530, 527,
+        488, 526, 497,
+        497, 526, 530,
+        499, 531, 500,
+        500, 531, 532,
+        500, 532, 487,
+        487, 532, 525,
+        503, 533, 499,
+        499, 533, 531,
+        484, 524, 503,
+        503, 524, 533,
+        495, 529, 506,
+        506, 529, 534,
+        507, 535, 508,
+        508, 535, 536,
+        511, 537, 512,
+        512, 537, 538,
+        512, 538, 483,
+        483, 538, 523,
+        515, 539, 511,
+        511, 539, 537,
+        508, 536, 515,
+        515, 536, 539,
+        517, 540, 518,
+        518, 540, 541,
+        518, 541, 507,
+        507, 541, 535,
+        521, 542, 517,
+        517, 542, 540,
+        506, 534, 521,
+        521, 534, 542,
+        543, 544, 545,
+        545, 544, 546,
+        544, 547, 546,
+        546, 547, 548,
+        549, 543, 550,
+        550, 543, 545,
+        551, 552, 553,
+        553, 552, 554,
+        552, 549, 554,
+        554, 549, 550,
+        555, 556, 557,
+        557, 556, 558,
+        556, 551, 558,
+        558, 551, 553,
+        559, 555, 560,
+        560, 555, 557,
+        561, 562, 563,
+        563, 562, 564,
+        562, 559, 564,
+        564, 559, 560,
+        565, 566, 567,
+        567, 566, 568,
+        566, 561, 568,
+        568, 561, 563,
+        569, 565, 570,
+        570, 565, 567,
+        571, 572, 573,
+        573, 572, 574,
+        572, 569, 574,
+        574, 569, 570,
+        575, 576, 577,
+        577, 576, 578,
+        576, 571, 578,
+        578, 571, 573,
+        579, 575, 580,
+        580, 575, 577,
+        547, 581, 548,
+        548, 581, 582,
+        581, 579, 582,
+        582, 579, 580,
+        545, 546, 583,
+        583, 546, 584,
+        546, 548, 584,
+        584, 548, 585,
+        550, 545, 586,
+        586, 545, 583,
+        553, 554, 587,
+        587, 554, 588,
+        554, 550, 588,
+        588, 550, 586,
+        557, 558, 589,
+        589, 558, 590,
+        558, 553, 590,
+        590, 553, 587,
+        560, 557, 591,
+        591, 557, 589,
+        563, 564, 592,
+        592, 564, 593,
+        564, 560, 593,
+        593, 560, 591,
+        567, 568, 594,
+        594, 568, 595,
+        568, 563, 595,
+        595, 563, 592,
+        570, 567, 596,
+        596, 567, 594,
+        573, 574, 597,
+        597, 574, 598,
+        574, 570, 598,
+        598, 570, 596,
+        577, 578, 599,
+        599, 578, 600,
+        578, 573, 600,
+        600, 573, 597,
+        580, 577, 601,
+        601, 577, 599,
+        548, 582, 585,
+        585, 582, 602,
+        582, 580, 602,
+        602, 580, 601,
+        584, 603, 583,
+        583, 603, 604,
+        585, 605, 584,
+        584, 605, 603,
+        583, 604, 586,
+        586, 604, 606,
+        588, 607, 587,
+        587, 607, 608,
+        586, 606, 588,
+        588, 606, 607,
+        590, 609, 589,
+        589, 609, 610,
+        587, 608, 590,
+        590, 608, 609,
+        589, 610, 591,
+        591, 610, 611,
+        593, 612, 592,
+        592, 612, 613,
+        591, 611, 593,
+        593, 611, 612,
+        595, 614, 594,
+        594, 614, 615,
+        592, 613, 595,
+        595, 613, 614,
+        594, 615, 596,
+        596, 615, 616,
+        598, 617, 597,
+        597, 617, 618,
+        596, 616, 598,
+        598, 616, 617,
+        600, 619, 599,
+        599, 619, 620,
+        597, 618, 600,
+        600, 618, 619,
+        599, 620, 601,
+        601, 620, 621,
+        602, 622, 585,
+        585, 622, 605,
+        601, 621, 602,
+        602, 621, 622,
+        623, 624, 603,
+        603, 624, 604,
+        625, 623, 605,
+        605, 623, 603,
+        604, 624, 606,
+        606, 624, 626,
+        627, 628, 607,
+        607, 628, 608,
+        626, 627, 606,
+        606, 627, 607,
+        629, 630, 609,
+        609, 630, 610,
+        628, 629, 608,
+        608, 629, 609,
+        630, 631, 610,
+        610, 631, 611,
+        632, 633, 612,
+        612, 633, 613,
+        631, 632, 611,
+        611, 632, 612,
+        634, 635, 614,
+        614, 635, 615,
+        633, 634, 613,
+        613, 634, 614,
+        635, 636, 615,
+        615, 636, 616,
+        637, 638, 617,
+        617, 638, 618,
+        636, 637, 616,
+        616, 637, 617,
+        639, 640, 619,
+        619, 640, 620,
+        638, 639, 618,
+        618, 639, 619,
+        640, 641, 620,
+        620, 641, 621,
+        642, 625, 622,
+        622, 625, 605,
+        641, 642, 621,
+        621, 642, 622,
+        624, 623, 643,
+        643, 623, 644,
+        623, 625, 644,
+        644, 625, 645,
+        626, 624, 646,
+        646, 624, 643,
+        628, 627, 647,
+        647, 627, 648,
+        627, 626, 648,
+        648, 626, 646,
+        630, 629, 649,
+        649, 629, 650,
+        629, 628, 650,
+        650, 628, 647,
+        631, 630, 651,
+        651, 630, 649,
+        633, 632, 652,
+        652, 632, 653,
+        632, 631, 653,
+        653, 631, 651,
+        635, 634, 654,
+        654, 634, 655,
+        634, 633, 655,
+        655, 633, 652,
+        636, 635, 656,
+        656, 635, 654,
+        638, 637, 657,
+        657, 637, 658,
+        637, 636, 658,
+        658, 636, 656,
+        640, 639, 659,
+        659, 639, 660,
+        639, 638, 660,
+        660, 638, 657,
+        641, 640, 661,
+        661, 640, 659,
+        625, 642, 645,
+        645, 642, 662,
+        642, 641, 662,
+        662, 641, 661,
+        663, 664, 665,
+        665, 664, 666,
+        664, 663, 667,
+        667, 663, 668,
+        669, 670, 671,
+        671, 670, 672,
+        673, 674, 675,
+        675, 674, 676,
+        677, 665, 678,
+        669, 671, 673,
+        673, 671, 674,
+        665, 677, 663,
+        668, 663, 679,
+        679, 663, 680,
+        679, 680, 681,
+        681, 680, 682,
+        683, 684, 685,
+        681, 682, 686,
+        686, 682, 687,
+        688, 670, 669,
+        686, 687, 689,
+        689, 687, 690,
+        689, 690, 691,
+        691, 690, 692,
+        691, 692, 693,
+        693, 692, 694,
+        694, 695, 693,
+        693, 695, 696,
+        669, 697, 688,
+        673, 698, 669,
+        669, 698, 699,
+        700, 701, 702,
+        702, 701, 703,
+        698, 704, 699,
+        699, 704, 705,
+        703, 706, 702,
+        702, 706, 707,
+        704, 708, 705,
+        705, 708, 709,
+        706, 710, 707,
+        707, 710, 711,
+        708, 711, 709,
+        709, 711, 710,
+        677, 712, 713,
+        713, 712, 714,
+        713, 714, 715,
+        715, 714, 716,
+        715, 716, 717,
+        717, 716, 718,
+        663, 677, 680,
+        680, 677, 713,
+        680, 713, 682,
+        682, 713, 715,
+        717, 718, 719,
+        719, 718, 720,
+        679, 721, 668,
+        668, 721, 722,
+        682, 715, 687,
+        687, 715, 717,
+        719, 720, 723,
+        723, 720, 724,
+        725, 721, 681,
+        681, 721, 679,
+        687, 717, 690,
+        690, 717, 719,
+        723, 724, 726,
+        726, 724, 727,
+        728, 725, 686,
+        686, 725, 681,
+        726, 729, 730,
+        690, 719, 692,
+        692, 719, 723,
+        689, 731, 686,
+        686, 731, 728,
+        692, 723, 694,
+        694, 723, 726,
+        691, 732, 689,
+        689, 732, 731,
+        694, 726, 695,
+        695, 726, 730,
+        693, 733, 691,
+        691, 733, 732,
+        683, 685, 697,
+        697, 685, 688,
+        696, 734, 693,
+        693, 734, 733,
+        701, 735, 736,
+        734, 696, 737,
+        737, 696, 700,
+        695, 701, 696,
+        696, 701, 700,
+        738, 739, 740,
+        741, 742, 697,
+        697, 742, 683,
+        743, 738, 744,
+        744, 738, 745,
+        746, 747, 741,
+        741, 747, 742,
+        744, 745, 748,
+        748, 745, 749,
+        750, 751, 746,
+        746, 751, 747,
+        748, 749, 750,
+        750, 749, 751,
+        736, 743, 701,
+        701, 743, 703,
+        699, 741, 669,
+        669, 741, 697,
+        703, 743, 706,
+        706, 743, 744,
+        705, 746, 699,
+        699, 746, 741,
+        752, 737, 702,
+        702, 737, 700,
+        706, 744, 710,
+        710, 744, 748,
+        709, 750, 705,
+        705, 750, 746,
+        673, 675, 698,
+        698, 675, 753,
+        710, 748, 709,
+        709, 748, 750,
+        754, 752, 707,
+        707, 752, 702,
+        698, 753, 704,
+        704, 753, 755,
+        756, 754, 711,
+        711, 754, 707,
+        704, 755, 708,
+        708, 755, 757,
+        757, 756, 708,
+        708, 756, 711,
+        758, 667, 722,
+        722, 667, 668,
+        672, 759, 671,
+        759, 760, 761,
+        759, 761, 671,
+        674, 671, 762,
+        762, 671, 763,
+        762, 763, 764,
+        764, 763, 765,
+        764, 765, 766,
+        766, 765, 767,
+        766, 767, 768,
+        768, 767, 769,
+        768, 769, 770,
+        770, 769, 771,
+        770, 771, 772,
+        772, 771, 773,
+        773, 774, 772,
+        772, 774, 775,
+        776, 777, 666,
+        777, 776, 778,
+        778, 776, 779,
+        760, 780, 761,
+        761, 780, 781,
+        779, 782, 778,
+        664, 776, 666,
+        667, 783, 664,
+        664, 783, 784,
+        785, 786, 787,
+        787, 786, 788,
+        783, 789, 784,
+        784, 789, 790,
+        788, 791, 787,
+        787, 791, 792,
+        789, 793, 790,
+        790, 793, 794,
+        795, 792, 796,
+        796, 792, 791,
+        793, 795, 794,
+        794, 795, 796,
+        797, 676, 762,
+        762, 676, 674,
+        798, 797, 764,
+        764, 797, 762,
+        671, 761, 763,
+        763, 761, 799,
+        800, 798, 766,
+        766, 798, 764,
+        763, 799, 765,
+        765, 799, 801,
+        768, 802, 766,
+        766, 802, 800,
+        765, 801, 767,
+        767, 801, 803,
+        761, 781, 799,
+        799, 781, 804,
+        770, 805, 768,
+        768, 805, 802,
+        799, 804, 801,
+        801, 804, 806,
+        767, 803, 769,
+        769, 803, 807,
+        772, 808, 770,
+        770, 808, 805,
+        775, 809, 772,
+        772, 809, 808,
+        801, 806, 803,
+        803, 806, 810,
+        769, 807, 771,
+        771, 807, 811,
+        803, 810, 807,
+        807, 810, 812,
+        771, 811, 773,
+        773, 811, 813,
+        773, 813, 774,
+        774, 813, 814,
+        807, 812, 811,
+        811, 812, 815,
+        811, 815, 813,
+        813, 815, 816,
+        813, 816, 814,
+        814, 816, 817,
+        775, 785, 809,
+        809, 785, 818,
+        774, 786, 775,
+        775, 786, 785,
+        774, 814, 786,
+        786, 814, 819,
+        814, 817, 819,
+        819, 817, 820,
+        785, 787, 818,
+        818, 787, 821,
+        822, 783, 758,
+        758, 783, 667,
+        787, 792, 821,
+        821, 792, 823,
+        824, 789, 822,
+        822, 789, 783,
+        792, 795, 823,
+        823, 795, 825,
+        826, 793, 824,
+        824, 793, 789,
+        795, 793, 825,
+        825, 793, 826,
+        786, 819, 788,
+        788, 819, 827,
+        784, 828, 664,
+        664, 828, 776,
+        788, 827, 791,
+        791, 827, 829,
+        790, 830, 784,
+        784, 830, 828,
+        791, 829, 796,
+        796, 829, 831,
+        794, 832, 790,
+        790, 832, 830,
+        796, 831, 794,
+        794, 831, 832,
+        819, 820, 827,
+        827, 820, 833,
+        828, 834, 776,
+        776, 834, 779,
+        827, 833, 829,
+        829, 833, 835,
+        830, 836, 828,
+        828, 836, 834,
+        829, 835, 831,
+        831, 835, 837,
+        832, 838, 830,
+        830, 838, 836,
+        831, 837, 832,
+        832, 837, 838,
+        678, 839, 677,
+        677, 839, 712,
+        712, 839, 840,
+        695, 730, 841,
+        841, 735, 695,
+        695, 735, 701,
+        842, 739, 743,
+        743, 739, 738,
+        736, 842, 743,
+        727, 843, 726,
+        726, 843, 729,
+        843, 727, 844,
+        755, 845, 757,
+        757, 845, 846,
+        753, 847, 755,
+        755, 847, 845,
+        675, 848, 753,
+        753, 848, 847,
+        675, 676, 848,
+        848, 676, 849,
+        676, 797, 849,
+        849, 797, 850,
+        797, 798, 850,
+        850, 798, 851,
+        798, 800, 851,
+        851, 800, 852,
+        853, 854, 855,
+        855, 854, 856,
+        855, 856, 857,
+        857, 856, 858,
+        857, 858, 859,
+        859, 858, 860,
+        861, 859, 862,
+        862, 859, 860,
+        863, 861, 864,
+        864, 861, 862,
+        865, 863, 866,
+        866, 863, 864,
+        867, 865, 868,
+        868, 865, 866,
+        854, 869, 856,
+        856, 869, 870,
+        856, 870, 858,
+        858, 870, 871,
+        858, 871, 860,
+        860, 871, 872,
+        862, 860, 873,
+        873, 860, 872,
+        864, 862, 874,
+        874, 862, 873,
+        866, 864, 875,
+        875, 864, 874,
+        868, 866, 876,
+        876, 866, 875,
+        877, 878, 855,
+        855, 878, 853,
+        879, 877, 857,
+        857, 877, 855,
+        880, 879, 859,
+        859, 879, 857,
+        881, 880, 861,
+        861, 880, 859,
+        882, 881, 863,
+        863, 881, 861,
+        883, 882, 865,
+        865, 882, 863,
+        884, 883, 867,
+        867, 883, 865,
+        885, 886, 877,
+        877, 886, 878,
+        887, 885, 879,
+        879, 885, 877,
+        888, 887, 880,
+        880, 887, 879,
+        889, 888, 881,
+        881, 888, 880,
+        889, 881, 890,
+        890, 881, 882,
+        890, 882, 891,
+        891, 882, 883,
+        891, 883, 892,
+        892, 883, 884,
+        869, 826, 870,
+        870, 826, 824,
+        870, 824, 871,
+        871, 824, 822,
+        871, 822, 872,
+        872, 822, 758,
+        873, 872, 722,
+        722, 872, 758,
+        874, 873, 721,
+        721, 873, 722,
+        875, 874, 725,
+        725, 874, 721,
+        876, 875, 728,
+        728, 875, 725,
+        851, 852, 885,
+        885, 852, 886,
+        850, 851, 887,
+        887, 851, 885,
+        849, 850, 888,
+        888, 850, 887,
+        848, 849, 889,
+        889, 849, 888,
+        848, 889, 847,
+        847, 889, 890,
+        847, 890, 845,
+        845, 890, 891,
+        845, 891, 846,
+        846, 891, 892,
+        808, 886, 805,
+        805, 886, 852,
+        809, 878, 808,
+        808, 878, 886,
+        809, 818, 878,
+        878, 818, 853,
+        818, 821, 853,
+        853, 821, 854,
+        821, 823, 854,
+        854, 823, 869,
+        733, 868, 732,
+        732, 868, 876,
+        734, 867, 733,
+        733, 867, 868,
+        737, 884, 734,
+        734, 884, 867,
+        737, 752, 884,
+        884, 752, 892,
+        752, 754, 892,
+        892, 754, 846,
+        732, 876, 731,
+        731, 876, 728,
+        754, 756, 846,
+        846, 756, 757,
+        805, 852, 802,
+        802, 852, 800,
+        826, 869, 825,
+        825, 869, 823,
+        893, 894, 895,
+        894, 896, 895,
+        896, 894, 897,
+        894, 898, 897,
+        899, 900, 894,
+        894, 900, 901,
+        898, 894, 902,
+        894, 903, 902,
+        904, 894, 905,
+        894, 906, 905,
+        907, 908, 894,
+        894, 908, 906,
+        907, 894, 909,
+        909, 894, 893,
+        910, 911, 894,
+        894, 911, 903,
+        901, 912, 894,
+        894, 912, 910,
+        904, 913, 894,
+        894, 913, 899,
+        914, 915, 916,
+        915, 917, 916,
+        917, 915, 918,
+        915, 919, 918,
+        920, 921, 915,
+        915, 921, 922,
+        919, 915, 923,
+        915, 924, 923,
+        925, 915, 926,
+        915, 927, 926,
+        928, 929, 915,
+        915, 929, 927,
+        928, 915, 930,
+        930, 915, 914,
+        931, 932, 915,
+        915, 932, 924,
+        922, 933, 915,
+        915, 933, 931,
+        925, 934, 915,
+        915, 934, 920,
+        935, 936, 937,
+        937, 936, 938,
+        936, 939, 938,
+        938, 939, 940,
+        941, 935, 942,
+        942, 935, 937,
+        943, 944, 945,
+        945, 944, 946,
+        944, 941, 946,
+        946, 941, 942,
+        947, 948, 949,
+        949, 948, 950,
+        948, 943, 950,
+        950, 943, 945,
+        951, 947, 952,
+        952, 947, 949,
+        953, 954, 955,
+        955, 954, 956,
+        954, 951, 956,
+        956, 951, 952,
+        957, 958, 959,
+        959, 958, 960,
+        958, 953, 960,
+        960, 953, 955,
+        961, 957, 962,
+        962, 957, 959,
+        963, 964, 965,
+        965, 964, 966,
+        964, 961, 966,
+        966, 961, 962,
+        967, 968, 969,
+        969, 968, 970,
+        968, 963, 970,
+        970, 963, 965,
+        971, 967, 972,
+        972, 967, 969,
+        939, 973, 940,
+        940, 973, 974,
+        973, 971, 974,
+        974, 971, 972,
+        975, 976, 977,
+        977, 976, 978,
+        976, 979, 978,
+        978, 979, 980,
+        981, 975, 982,
+        982, 975, 977,
+        983, 984, 985,
+        985, 984, 986,
+        984, 981, 986,
+        986, 981, 982,
+        987, 988, 989,
+        989, 988, 990,
+        988, 983, 990,
+        990, 983, 985,
+        991, 987, 992,
+        992, 987, 989,
+        993, 994, 995,
+        995, 994, 996,
+        994, 991, 996,
+        996, 991, 992,
+        997, 998, 999,
+        999, 998, 1000,
+        998, 993, 1000,
+        1000, 993, 995,
+        1001, 997, 1002,
+        1002, 997, 999,
+        1003, 1004, 1005,
+        1005, 1004, 1006,
+        1004, 1001, 1006,
+        1006, 1001, 1002,
+        1007, 1008, 1009,
+        1009, 1008, 1010,
+        1008, 1003, 1010,
+        1010, 1003, 1005,
+        1011, 1007, 1012,
+        1012, 1007, 1009,
+        979, 1013, 980,
+        980, 1013, 1014,
+        1013, 1011, 1014,
+        1014, 1011, 1012};
+
+    const ZEDModelMesh zed_m_mesh = {zed_m_vertices, 1015, zed_m_indices, 4539};
+}
+
+const ZEDModelMesh &getZEDModelMesh(CameraModel model)
+{
+    switch (model)
+    {
+    case CameraModel::ZED:
+        return zed_mesh;
+    case CameraModel::ZED_M:
+        return zed_m_mesh;
+    case CameraModel::ZED2:
+    case CameraModel::ZED2i:
+        // Same shape
+        return zed2_mesh;
+    default:
+        std::cout << "[Sample] No mesh for the camera model " << (int)model << ", drawn as a ZED 2" << std::endl;
+        return zed2_mesh;
+    }
+}
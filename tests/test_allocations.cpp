@@ -0,0 +1,96 @@
+#include "alloc_counter.h"
+#include "chunk_codec.h"
+#include "chunk_store.h"
+#include "parallel_primitives.h"
+#include "test_common.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    std::vector<std::vector<MapPoint>> makeChunks(int nb_chunks, size_t nb_points, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> u(0.f, 2000.f);
+        std::vector<std::vector<MapPoint>> chunks(nb_chunks, std::vector<MapPoint>(nb_points));
+        for (int c = 0; c < nb_chunks; c++)
+            for (auto &p : chunks[c])
+                p = {u(rng) + c * 2000.f, u(rng), u(rng), (uint32_t)rng()};
+        return chunks;
+    }
+
+    /// Once warm, the merge of an update and its consumption stay off the heap (strictly so without workers)
+    void testStoreUpdate()
+    {
+        std::mt19937 rng(1);
+        // Small chunks (serial sort) and chunks larger than the parallel blocks, enough points to copy them on all the cores
+        const auto chunks = makeChunks(40, 3000, rng);
+        const auto large = makeChunks(3, 3 * parallel::MIN_BLOCK, rng);
+        std::vector<ChunkInput> inputs;
+        for (int i = 0; i < (int)chunks.size(); i++)
+            inputs.push_back({i, chunks[i].data(), chunks[i].size()});
+        for (int i = 0; i < (int)large.size(); i++)
+            inputs.push_back({100 + i, large[i].data(), large[i].size()});
+
+        ChunkStore store(1, 2000.f);
+        store.setMortonOrder(10.f);
+        const int consumer = store.addConsumer();
+        size_t nb_consumed = 0;
+        auto frame = [&] {
+            store.update(0, inputs);
+            nb_consumed += store.consumeUpdates(consumer, [](const ChunkUpdate &) {});
+        };
+        // Warm up: scratch blocks, recycled contents, octree, queues of the consumer
+        for (int i = 0; i < 3; i++)
+            frame();
+
+        const unsigned long long before = alloc_counter::getTotalCount();
+        for (int i = 0; i < 10; i++)
+            frame();
+        const unsigned long long allocations = alloc_counter::getTotalCount() - before;
+        std::cout << "[Test] " << allocations << " heap allocations in 10 updates of " << inputs.size() << " chunks" << std::endl;
+        // The arena of a worker grows (a block and the list of blocks) the first time it sorts a large
+        // chunk, which depends on the stealing order and may come after the warm up
+        CHECK(allocations <= 2 * (unsigned long long)ThreadPool::global().getNbWorkers());
+        CHECK(nb_consumed == 13 * inputs.size());
+    }
+
+    /// Encoding a chunk only writes to its output buffer
+    void testEncode()
+    {
+        std::mt19937 rng(2);
+        const auto chunks = makeChunks(20, 3000, rng);
+        const auto large = makeChunks(1, 3 * parallel::MIN_BLOCK, rng);
+        std::vector<uint8_t> out;
+        auto encodeAll = [&] {
+            out.clear();
+            for (const auto &it : chunks)
+                chunk_codec::encode(it.data(), it.size(), 1.f, out);
+            chunk_codec::encode(large[0].data(), large[0].size(), 1.f, out);
+        };
+        encodeAll();
+        encodeAll();
+
+        const unsigned long long before = alloc_counter::getTotalCount();
+        for (int i = 0; i < 10; i++)
+            encodeAll();
+        const unsigned long long allocations = alloc_counter::getTotalCount() - before;
+        std::cout << "[Test] " << allocations << " heap allocations in 10 encodings of " << chunks.size() + 1 << " chunks" << std::endl;
+        CHECK(allocations == 0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    CHECK(alloc_counter::isEnabled());
+    {
+        const unsigned long long before = alloc_counter::getTotalCount();
+        std::unique_ptr<int> p(new int(1));
+        CHECK(alloc_counter::getTotalCount() == before + 1);
+    }
+    test::configurePool(argc, argv);
+    testStoreUpdate();
+    testEncode();
+    return test::result("allocations");
+}
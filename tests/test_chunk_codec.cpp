@@ -0,0 +1,266 @@
+#include "chunk_codec.h"
+#include "map_protocol.h"
+#include "test_common.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Floor and wall of 2 m in millimeters, with colors spanning every byte value
+    std::vector<MapPoint> makeChunk(size_t n, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> u(0.f, 2000.f);
+        std::vector<MapPoint> points(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            const float a = u(rng), b = u(rng);
+            points[i] = i % 2 ? MapPoint{a, 30.f * std::sin(b * 0.003f), b, 0} : MapPoint{a, b, 2000.f, 0};
+            points[i].color = (uint32_t)rng() & 0xffffff;
+        }
+        return points;
+    }
+
+    bool lessPoint(const MapPoint &a, const MapPoint &b)
+    {
+        if (a.x != b.x)
+            return a.x < b.x;
+        if (a.y != b.y)
+            return a.y < b.y;
+        if (a.z != b.z)
+            return a.z < b.z;
+        return a.color < b.color;
+    }
+
+    bool samePoints(const std::vector<MapPoint> &a, const std::vector<MapPoint> &b)
+    {
+        return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(MapPoint)) == 0);
+    }
+
+    /// Decoded points are on the grid and in Morton order: compare them to the grid positions of the
+    /// input as multisets, and the grid positions to the input
+    void checkRoundTrip(const std::vector<MapPoint> &points, float step, size_t stride)
+    {
+        std::vector<uint8_t> encoded;
+        const size_t size = chunk_codec::encode(points.data(), points.size(), step, encoded, stride);
+        CHECK(size == encoded.size());
+        std::vector<MapPoint> decoded;
+        CHECK(chunk_codec::decode(encoded.data(), encoded.size(), decoded));
+
+        std::vector<MapPoint> expected;
+        bool within_step = true;
+        for (size_t i = 0; i < points.size(); i += stride)
+        {
+            MapPoint q = points[i];
+            float *xyz[3] = {&q.x, &q.y, &q.z};
+            for (float *v : xyz)
+            {
+                const float grid = (float)(int32_t)std::floor(*v * (1. / step) + 0.5) * step;
+                within_step &= std::fabs(grid - *v) <= step * 0.5f * 1.001f;
+                *v = grid;
+            }
+            expected.push_back(q);
+        }
+        CHECK(within_step);
+        std::sort(expected.begin(), expected.end(), lessPoint);
+        std::sort(decoded.begin(), decoded.end(), lessPoint);
+        CHECK(samePoints(decoded, expected));
+        // Far below the 16 bytes of a raw point
+        if (expected.size() > 1000)
+            CHECK(encoded.size() < expected.size() * 8);
+    }
+
+    void testRoundTrip()
+    {
+        std::mt19937 rng(1);
+        for (size_t n : {0, 1, 63, 64, 65, 3000, 100000})
+            checkRoundTrip(makeChunk(n, rng), 5.f, 1);
+        checkRoundTrip(makeChunk(3000, rng), 0.5f, 1);
+        // Negative coordinates
+        auto points = makeChunk(3000, rng);
+        for (auto &p : points)
+            p.x -= 5000.f;
+        checkRoundTrip(points, 5.f, 1);
+    }
+
+    void testStride()
+    {
+        std::mt19937 rng(2);
+        const auto points = makeChunk(1000, rng);
+        for (size_t stride : {2, 3, 8, 1000, 2000})
+        {
+            checkRoundTrip(points, 5.f, stride);
+            std::vector<uint8_t> encoded;
+            chunk_codec::encode(points.data(), points.size(), 5.f, encoded, stride);
+            std::vector<MapPoint> decoded;
+            CHECK(chunk_codec::decode(encoded.data(), encoded.size(), decoded) && decoded.size() == (1000 + stride - 1) / stride);
+        }
+    }
+
+    /// Points which cannot be quantized are stored as they are, in their order
+    void testRaw()
+    {
+        std::mt19937 rng(3);
+        auto with_nan = makeChunk(500, rng);
+        with_nan[123].y = std::numeric_limits<float>::quiet_NaN();
+        auto with_inf = makeChunk(500, rng);
+        with_inf[7].z = std::numeric_limits<float>::infinity();
+        // Wider than 2^21 steps
+        auto wide = makeChunk(500, rng);
+        wide[0].x = 3e6f;
+        for (const auto *points : {&with_nan, &with_inf, &wide})
+        {
+            std::vector<uint8_t> encoded;
+            chunk_codec::encode(points->data(), points->size(), 1.f, encoded);
+            CHECK(encoded.size() > points->size() * sizeof(MapPoint));
+            std::vector<MapPoint> decoded;
+            CHECK(chunk_codec::decode(encoded.data(), encoded.size(), decoded));
+            CHECK(samePoints(decoded, *points));
+        }
+        // Raw with a stride
+        std::vector<uint8_t> encoded;
+        chunk_codec::encode(wide.data(), wide.size(), 1.f, encoded, 2);
+        std::vector<MapPoint> decoded, expected;
+        for (size_t i = 0; i < wide.size(); i += 2)
+            expected.push_back(wide[i]);
+        CHECK(chunk_codec::decode(encoded.data(), encoded.size(), decoded) && samePoints(decoded, expected));
+    }
+
+    void testMalformed()
+    {
+        std::mt19937 rng(4);
+        const auto points = makeChunk(3000, rng);
+        std::vector<uint8_t> encoded;
+        chunk_codec::encode(points.data(), points.size(), 5.f, encoded);
+        std::vector<MapPoint> decoded;
+
+        bool truncated_rejected = true;
+        for (size_t size = 0; size < encoded.size(); size += 1 + size / 16)
+            truncated_rejected &= !chunk_codec::decode(encoded.data(), size, decoded);
+        CHECK(truncated_rejected);
+
+        // Header fields: number of points, mode, origin beyond the grid, stream sizes
+        const size_t NB_POINTS = 0, MODE = 4, ORIGIN = 12, STREAM_SIZE = 24;
+        auto corrupt = [&](size_t offset, uint32_t value) {
+            std::vector<uint8_t> c = encoded;
+            memcpy(&c[offset], &value, sizeof(value));
+            return !chunk_codec::decode(c.data(), c.size(), decoded);
+        };
+        CHECK(corrupt(NB_POINTS, 0xffffffffu));
+        CHECK(corrupt(MODE, 7));
+        CHECK(corrupt(ORIGIN, 0x7ffffc20u));
+        CHECK(corrupt(ORIGIN + 8, 0x80000000u));
+        CHECK(corrupt(STREAM_SIZE, 0xfffffff0u));
+        CHECK(corrupt(STREAM_SIZE, (uint32_t)encoded.size()));
+
+        // Raw chunk whose size does not match its number of points
+        auto wide = points;
+        wide[0].x = 1e9f;
+        std::vector<uint8_t> raw;
+        chunk_codec::encode(wide.data(), wide.size(), 5.f, raw);
+        CHECK(!chunk_codec::decode(raw.data(), raw.size() - 1, decoded));
+        encoded = raw;
+        CHECK(corrupt(NB_POINTS, 2999));
+
+        // A batch fails if one of its chunks does
+        std::vector<std::vector<uint8_t>> batch = {raw, raw, std::vector<uint8_t>(raw.begin(), raw.begin() + 40)};
+        std::vector<std::vector<MapPoint>> batch_points;
+        CHECK(!chunk_codec::decode(batch, batch_points));
+        batch.pop_back();
+        CHECK(chunk_codec::decode(batch, batch_points) && batch_points.size() == 2 && samePoints(batch_points[1], wide));
+    }
+
+    void testStream()
+    {
+        const std::string path = "test_chunk_codec.zmap";
+        std::mt19937 rng(5);
+        chunk_codec::StreamInfo info;
+        info.nbSources = 2;
+        info.step = 5.f;
+        info.cameraModels = {1, 3};
+        // More chunks than a batch of the writer, chunk 3 of source 1 is written twice
+        std::vector<std::vector<MapPoint>> chunks;
+        {
+            chunk_codec::StreamWriter writer;
+            CHECK(writer.open(path, info));
+            for (int i = 0; i < 1100; i++)
+            {
+                chunks.push_back(makeChunk(1 + i % 50, rng));
+                CHECK(writer.write(i % 2, i / 2, chunks.back().data(), chunks.back().size()));
+            }
+            chunks.push_back(makeChunk(700, rng));
+            CHECK(writer.write(1, 3, chunks.back().data(), chunks.back().size()));
+            CHECK(writer.close());
+        }
+
+        chunk_codec::StreamReader reader;
+        CHECK(reader.open(path));
+        CHECK(reader.getInfo().nbSources == 2 && reader.getInfo().step == 5.f && reader.getInfo().cameraModels == info.cameraModels);
+        std::map<std::pair<int, int>, std::vector<MapPoint>> read;
+        size_t nb_records = 0;
+        bool in_order = true;
+        while (size_t n = reader.read([&](int source, int index, std::vector<MapPoint> &points) {
+                   in_order &= nb_records >= 1100 || (source == (int)nb_records % 2 && index == (int)nb_records / 2);
+                   read[{source, index}] = points;
+                   nb_records++;
+               }, 10000))
+            CHECK(n > 0);
+        CHECK(reader.isValid());
+        CHECK(in_order);
+        CHECK(nb_records == 1101);
+        CHECK(read.size() == 1100);
+        // The last content wins
+        CHECK(read[std::make_pair(1, 3)].size() == 700);
+        CHECK(read[std::make_pair(0, 0)].size() == chunks[0].size());
+        reader.close();
+
+        // A chunk index beyond the limit of the store makes the file invalid
+        {
+            chunk_codec::StreamWriter writer;
+            CHECK(writer.open(path, info));
+            writer.write(0, map_protocol::MAX_CHUNK_INDEX + 1, chunks[0].data(), chunks[0].size());
+            CHECK(writer.close());
+        }
+        CHECK(reader.open(path));
+        CHECK(reader.read([](int, int, std::vector<MapPoint> &) {}) == 0);
+        CHECK(!reader.isValid());
+        reader.close();
+
+        // Truncated file
+        {
+            chunk_codec::StreamWriter writer;
+            CHECK(writer.open(path, info));
+            writer.write(0, 0, chunks[1100].data(), chunks[1100].size());
+            CHECK(writer.close());
+            FILE *file = fopen(path.c_str(), "rb");
+            std::vector<uint8_t> bytes(1 << 16);
+            bytes.resize(fread(bytes.data(), 1, bytes.size(), file));
+            fclose(file);
+            file = fopen(path.c_str(), "wb");
+            fwrite(bytes.data(), 1, bytes.size() - 10, file);
+            fclose(file);
+        }
+        CHECK(reader.open(path));
+        CHECK(reader.read([](int, int, std::vector<MapPoint> &) {}) == 0);
+        CHECK(!reader.isValid());
+        reader.close();
+        std::remove(path.c_str());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    test::configurePool(argc, argv);
+    testRoundTrip();
+    testStride();
+    testRaw();
+    testMalformed();
+    testStream();
+    return test::result("chunk_codec");
+}
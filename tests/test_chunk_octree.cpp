@@ -0,0 +1,156 @@
+#include "chunk_octree.h"
+#include "chunk_store.h"
+#include "test_common.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    typedef std::set<std::pair<int, int>> ChunkSet;
+
+    ChunkBounds randomBox(std::mt19937 &rng, float range, float max_size)
+    {
+        std::uniform_real_distribution<float> pos(-range, range), size(0.f, max_size);
+        ChunkBounds b;
+        for (int i = 0; i < 3; i++)
+        {
+            b.min[i] = pos(rng);
+            b.max[i] = b.min[i] + size(rng);
+        }
+        return b;
+    }
+
+    bool overlaps(const ChunkBounds &a, const ChunkBounds &b)
+    {
+        for (int i = 0; i < 3; i++)
+            if (a.max[i] < b.min[i] || b.max[i] < a.min[i])
+                return false;
+        return true;
+    }
+
+    /// Frustum of the box center +- half (an orthographic view-projection)
+    Frustum boxFrustum(const float *center, float half)
+    {
+        const float vp[16] = {1.f / half, 0.f, 0.f, -center[0] / half,
+                              0.f, 1.f / half, 0.f, -center[1] / half,
+                              0.f, 0.f, 1.f / half, -center[2] / half,
+                              0.f, 0.f, 0.f, 1.f};
+        Frustum frustum;
+        frustum.set(vp);
+        return frustum;
+    }
+
+    /// Queries against a linear scan of the chunks, while they move and are removed
+    void testQueries()
+    {
+        std::mt19937 rng(5);
+        ChunkOctree octree(50.f);
+        std::vector<std::pair<bool, ChunkBounds>> chunks(2000);
+        for (int round = 0; round < 3; round++)
+        {
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                if (round == 2 && i % 3 == 0)
+                {
+                    octree.remove(1, (int)i);
+                    chunks[i].first = false;
+                    continue;
+                }
+                // Some are far away so that the root grows, some are large
+                const float range = i % 50 == 0 ? 20000.f : 2000.f;
+                chunks[i] = std::make_pair(true, randomBox(rng, range, i % 7 == 0 ? 800.f : 100.f));
+                octree.update(1, (int)i, chunks[i].second);
+            }
+            for (int q = 0; q < 50; q++)
+            {
+                const ChunkBounds box = randomBox(rng, 2500.f, 1500.f);
+                ChunkSet found, expected;
+                octree.queryBox(box, [&](int source, int index) { found.insert(std::make_pair(source, index)); });
+                for (size_t i = 0; i < chunks.size(); i++)
+                    if (chunks[i].first && overlaps(chunks[i].second, box))
+                        expected.insert(std::make_pair(1, (int)i));
+                CHECK(found == expected);
+
+                const float center[3] = {box.min[0], box.min[1], box.min[2]};
+                const Frustum frustum = boxFrustum(center, 700.f);
+                ChunkSet visible, expected_visible;
+                bool inside_right = true;
+                octree.queryFrustum(frustum, [&](int source, int index, bool inside) {
+                    visible.insert(std::make_pair(source, index));
+                    inside_right &= inside == (frustum.classify(chunks[index].second) == Frustum::INSIDE);
+                });
+                for (size_t i = 0; i < chunks.size(); i++)
+                    if (chunks[i].first && frustum.classify(chunks[i].second) != Frustum::OUTSIDE)
+                        expected_visible.insert(std::make_pair(1, (int)i));
+                CHECK(visible == expected_visible);
+                CHECK(inside_right);
+            }
+        }
+        CHECK(octree.getNbItems() == chunks.size() - (chunks.size() + 2) / 3);
+    }
+
+    /// Non-finite bounds are not placed in the tree (the root would grow forever)
+    void testNonFiniteBounds()
+    {
+        ChunkOctree octree(50.f);
+        ChunkBounds b = {{0.f, 0.f, 0.f}, {10.f, 10.f, 10.f}};
+        octree.update(0, 0, b);
+        b.max[1] = std::numeric_limits<float>::quiet_NaN();
+        octree.update(0, 1, b);
+        b.max[1] = std::numeric_limits<float>::infinity();
+        octree.update(0, 2, b);
+        CHECK(octree.getNbItems() == 1);
+        // An existing chunk updated with NaN bounds leaves the tree
+        octree.update(0, 0, b);
+        CHECK(octree.getNbItems() == 0);
+    }
+
+    /// The bounds of a chunk with NaN points only cover its finite points
+    void testStoreNonFinitePoints()
+    {
+        ChunkStore store(1, 100.f);
+        store.setMortonOrder(10.f);
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        std::vector<MapPoint> points = {{1.f, 2.f, 3.f, 0}, {nan, 0.f, 0.f, 0}, {4.f, 5.f, 6.f, 0}, {0.f, std::numeric_limits<float>::infinity(), 0.f, 0}};
+        store.update(0, {{0, points.data(), points.size()}});
+        auto data = store.get(0, 0, false);
+        CHECK(data && data->points.size() == points.size());
+        if (data)
+        {
+            CHECK(data->bounds.min[0] == 1.f && data->bounds.max[0] == 4.f);
+            CHECK(data->bounds.min[2] == 3.f && data->bounds.max[2] == 6.f);
+        }
+        int found = 0;
+        const ChunkBounds box = {{0.f, 0.f, 0.f}, {2.f, 3.f, 4.f}};
+        store.queryBox(box, [&](int, int, const ChunkData &) { found++; });
+        CHECK(found == 1);
+    }
+
+    void testNodeAlignment()
+    {
+        std::vector<OctreeNode, AlignedAllocator<OctreeNode>> nodes;
+        bool aligned = true;
+        for (int i = 0; i < 100; i++)
+        {
+            nodes.emplace_back();
+            aligned &= (reinterpret_cast<uintptr_t>(nodes.data()) % 64) == 0;
+        }
+        CHECK(aligned);
+    }
+}
+
+int main()
+{
+    testQueries();
+    testNonFiniteBounds();
+    testStoreNonFinitePoints();
+    testNodeAlignment();
+    return test::result("chunk octree");
+}
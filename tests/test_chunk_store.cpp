@@ -0,0 +1,107 @@
+#include "chunk_store.h"
+#include "test_common.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const int NB_CHUNKS = 16;
+
+    /// Every point of a version of a chunk carries the version and the number of points, so a read
+    /// mixing two versions is detected
+    std::vector<MapPoint> makeVersion(int index, uint32_t version)
+    {
+        const size_t n = 20000 + (version * 3701 + index * 1100) % 30000;
+        return std::vector<MapPoint>(n, MapPoint{(float)n, (float)index, 0.f, version});
+    }
+
+    bool isConsistent(const ChunkData &data, int index)
+    {
+        if (data.points.empty())
+            return false;
+        const MapPoint &first = data.points[0];
+        for (const auto &p : data.points)
+            if (p.x != (float)data.points.size() || p.y != (float)index || p.color != first.color)
+                return false;
+        return true;
+    }
+
+    /// Chunks updated with other sizes and paged out again while readers page them in: every read
+    /// returns a whole version, never the old number of points with the new content
+    void testPagingRace()
+    {
+        {
+            ChunkStore store(1);
+            PagingParameters paging;
+            paging.directory = ".";
+            paging.after = 0.f;
+            paging.distance = 0.f;
+            CHECK(store.startPaging(paging));
+
+            std::vector<std::vector<MapPoint>> contents(NB_CHUNKS);
+            std::vector<ChunkInput> inputs;
+            for (int i = 0; i < NB_CHUNKS; i++)
+            {
+                contents[i] = makeVersion(i, 0);
+                inputs.push_back({i, contents[i].data(), contents[i].size()});
+            }
+            store.update(0, inputs);
+
+            std::atomic<bool> stop(false);
+            std::atomic<int> nb_inconsistent(0), nb_missing(0);
+            std::vector<std::thread> readers;
+            for (int r = 0; r < 4; r++)
+                readers.emplace_back([&, r] {
+                    std::mt19937 rng(r);
+                    while (!stop)
+                    {
+                        const int index = (int)(rng() % NB_CHUNKS);
+                        const auto data = store.get(0, index, false);
+                        if (!data)
+                            nb_missing++;
+                        else if (!isConsistent(*data, index))
+                            nb_inconsistent++;
+                    }
+                });
+
+            // A few chunks at a time, so the others stay paged out and the slots are reused
+            std::mt19937 rng(7);
+            const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(1500);
+            for (uint32_t version = 1; std::chrono::steady_clock::now() < end; version++)
+            {
+                const int index = (int)(rng() % NB_CHUNKS);
+                contents[index] = makeVersion(index, version);
+                store.update(0, {{index, contents[index].data(), contents[index].size()}});
+                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            }
+            stop = true;
+            for (auto &it : readers)
+                it.join();
+            CHECK(nb_inconsistent == 0);
+            CHECK(nb_missing == 0);
+
+            // The last versions, from memory or from the page file
+            bool last = true;
+            for (int i = 0; i < NB_CHUNKS; i++)
+            {
+                const auto data = store.get(0, i);
+                last &= data && data->points.size() == contents[i].size() && data->points[0].color == contents[i][0].color;
+            }
+            CHECK(last);
+            store.report();
+        }
+        std::remove("./chunks_0.bin");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    test::configurePool(argc, argv);
+    testPagingRace();
+    return test::result("chunk_store");
+}
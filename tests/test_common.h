@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "thread_pool.h"
+
+/// Minimal checks of the unit tests, a failed check is printed and the test goes on
+namespace test
+{
+    inline int &failures()
+    {
+        static int count = 0;
+        return count;
+    }
+
+    inline void fail(const char *file, int line, const std::string &what)
+    {
+        std::cout << "[Test][Error] " << file << ":" << line << " " << what << std::endl;
+        failures()++;
+    }
+
+    /// Workers of the global pool from the first argument (default: one per core besides the calling thread)
+    inline void configurePool(int argc, char **argv)
+    {
+        if (argc > 1)
+            ThreadPool::configure(std::atoi(argv[1]));
+        std::cout << "[Test] " << ThreadPool::global().getNbWorkers() << " workers" << std::endl;
+    }
+
+    /// Exit code of the test
+    inline int result(const char *name)
+    {
+        std::cout << "[Test] " << name << ": " << (failures() ? std::to_string(failures()) + " checks failed" : std::string("passed")) << std::endl;
+        return failures() ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+}
+
+#define CHECK(cond)                               \
+    do                                            \
+    {                                             \
+        if (!(cond))                              \
+            test::fail(__FILE__, __LINE__, #cond); \
+    } while (0)
@@ -0,0 +1,202 @@
+#include "map_client.h"
+#include "map_server.h"
+#include "net_socket.h"
+#include "test_common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+// A MapServer and a MapClient in one process over a Unix socket: the map rebuilt by the client must
+// match the source map on the quantization grid, at the connection and after updates
+
+namespace
+{
+    const float STEP = 5.f;
+    const std::string ENDPOINT = "unix:test_map_loopback.sock";
+
+    std::vector<MapPoint> makeChunk(int index, size_t n, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> u(0.f, 2000.f);
+        std::vector<MapPoint> points(n);
+        for (auto &p : points)
+            p = {index * 2000.f + u(rng), u(rng), u(rng), (uint32_t)rng() & 0xffffff};
+        return points;
+    }
+
+    /// Points on the grid of the stream, sorted
+    std::vector<MapPoint> quantized(const std::vector<MapPoint> &points)
+    {
+        std::vector<MapPoint> out(points);
+        for (auto &p : out)
+            for (float *v : {&p.x, &p.y, &p.z})
+                *v = (float)(int32_t)std::floor(*v * (1. / STEP) + 0.5) * STEP;
+        std::sort(out.begin(), out.end(), [](const MapPoint &a, const MapPoint &b) {
+            return a.x != b.x ? a.x < b.x : a.y != b.y ? a.y < b.y : a.z != b.z ? a.z < b.z : a.color < b.color;
+        });
+        return out;
+    }
+
+    /// Chunks of the client which differ from the source (missing, decimated or outdated)
+    int countMismatches(ChunkStore &source, ChunkStore &received)
+    {
+        int mismatches = 0;
+        for (int index = 0; index < source.getNbChunks(0); index++)
+        {
+            const auto expected = source.get(0, index);
+            const auto actual = received.get(0, index);
+            if (!expected)
+                continue;
+            if (!actual || actual->points.size() != expected->points.size())
+            {
+                mismatches++;
+                continue;
+            }
+            const auto a = quantized(actual->points), e = quantized(expected->points);
+            bool same = true;
+            for (size_t i = 0; i < a.size() && same; i++)
+                same = a[i].color == e[i].color && std::fabs(a[i].x - e[i].x) <= STEP * 0.5f && std::fabs(a[i].y - e[i].y) <= STEP * 0.5f &&
+                       std::fabs(a[i].z - e[i].z) <= STEP * 0.5f;
+            mismatches += !same;
+        }
+        return mismatches;
+    }
+
+    void sendAll(int fd, const std::vector<uint8_t> &data)
+    {
+        for (size_t sent = 0; fd >= 0 && sent < data.size();)
+        {
+            const long size = net::sendSome(fd, &data[sent], data.size() - sent);
+            if (size < 0)
+                break;
+            sent += size;
+        }
+    }
+
+    bool waitFor(const std::function<bool()> &condition, int timeout_ms)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    void testLoopback()
+    {
+        std::mt19937 rng(1);
+        ChunkStore store(1, 2000.f);
+        std::vector<std::vector<MapPoint>> chunks;
+        for (int i = 0; i < 200; i++)
+            chunks.push_back(makeChunk(i, 500 + i * 10, rng));
+        std::vector<ChunkInput> inputs;
+        for (int i = 0; i < (int)chunks.size(); i++)
+            inputs.push_back({i, chunks[i].data(), chunks[i].size()});
+        store.update(0, inputs);
+
+        MapServer server;
+        const map_protocol::Hello hello = {map_protocol::MAGIC, map_protocol::VERSION, 1, 1000.f, 50.f, STEP};
+        CHECK(server.start(ENDPOINT, store, hello, {3}, 1 << 20));
+
+        MapClient client;
+        CHECK(client.connect(server.getLocalEndpoint()));
+        CHECK(client.getHello().quantizationStep == STEP && client.getCameraModels() == std::vector<int32_t>{3});
+        std::atomic<int> nb_poses(0);
+        std::atomic<float> last_x(0.f);
+        client.start([&](const map_protocol::Pose &pose) {
+            last_x = pose.translation[0];
+            nb_poses++;
+        });
+
+        // Startup: the whole map
+        CHECK(waitFor([&] { return client.hasSnapshot(); }, 10000));
+        CHECK(waitFor([&] { return countMismatches(store, client.getStore()) == 0; }, 10000));
+
+        // Steady state: some chunks updated, new ones, and a pose per update
+        for (int step = 0; step < 20; step++)
+        {
+            std::vector<ChunkInput> updates;
+            for (int k = 0; k < 5; k++)
+            {
+                const int index = step % 2 ? (int)chunks.size() : (int)(rng() % chunks.size());
+                if (index == (int)chunks.size())
+                    chunks.emplace_back();
+                chunks[index] = makeChunk(index, 300 + rng() % 1000, rng);
+                updates.push_back({index, chunks[index].data(), chunks[index].size()});
+            }
+            store.update(0, updates);
+            map_protocol::Pose pose = {};
+            pose.translation[0] = (float)step;
+            pose.orientation[3] = 1.f;
+            server.updatePose(pose);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        CHECK(waitFor([&] { return countMismatches(store, client.getStore()) == 0; }, 10000));
+        CHECK(client.getStore().getNbChunks(0) == store.getNbChunks(0));
+        CHECK(waitFor([&] { return last_x == 19.f; }, 5000));
+        CHECK(nb_poses > 0);
+        CHECK(client.isConnected());
+
+        // Startup and steady state traffic, pose latency
+        client.stop();
+        client.report();
+        server.stop();
+    }
+
+    /// A chunk index beyond the limit of the protocol drops the connection instead of growing the store
+    void testInvalidIndex()
+    {
+        const std::string endpoint = "unix:test_map_loopback_invalid.sock";
+        const int listen_fd = net::listenSocket(endpoint);
+        CHECK(listen_fd >= 0);
+        std::thread server([&] {
+            std::string peer;
+            int fd = -1;
+            waitFor([&] { return (fd = net::acceptSocket(listen_fd, peer)) >= 0; }, 5000);
+            std::vector<uint8_t> out;
+            const map_protocol::Hello hello = {map_protocol::MAGIC, map_protocol::VERSION, 1, 1000.f, 50.f, STEP};
+            map_protocol::encodeHello(hello, {0}, out);
+            sendAll(fd, out);
+            // Once connected, on the thread of the client
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            out.clear();
+            ChunkData data;
+            data.points = {{1.f, 2.f, 3.f, 0}};
+            data.bounds = {{1.f, 2.f, 3.f}, {1.f, 2.f, 3.f}};
+            map_protocol::encodeChunk(0, map_protocol::MAX_CHUNK_INDEX + 1, data, 0, STEP, out);
+            sendAll(fd, out);
+            // Closed by the client
+            uint8_t byte;
+            while (fd >= 0 && net::waitReadable(fd, 5000) && net::receiveSome(fd, &byte, 1) >= 0)
+                ;
+            net::closeSocket(fd);
+        });
+
+        MapClient client;
+        CHECK(client.connect(net::localEndpoint(endpoint)));
+        client.start(nullptr);
+        CHECK(waitFor([&] { return !client.isConnected(); }, 5000));
+        CHECK(client.getStore().getNbChunks(0) == 0);
+        server.join();
+        client.stop();
+        net::closeSocket(listen_fd);
+        std::remove(endpoint.substr(5).c_str());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    test::configurePool(argc, argv);
+    testLoopback();
+    testInvalidIndex();
+    std::remove(ENDPOINT.substr(5).c_str());
+    return test::result("map_loopback");
+}
@@ -0,0 +1,108 @@
+#include "map_protocol.h"
+#include "test_common.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    void appendHeader(uint32_t size, uint16_t type, std::vector<uint8_t> &out)
+    {
+        map_protocol::MessageHeader header = {size, type, 0};
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&header);
+        out.insert(out.end(), bytes, bytes + sizeof(header));
+    }
+
+    /// Messages split at any byte are read back whole and in order
+    void testSplit()
+    {
+        std::vector<uint8_t> stream;
+        map_protocol::encodeSnapshotEnd(stream);
+        map_protocol::Pose pose = {};
+        pose.source = 1;
+        pose.timestamp = 42;
+        map_protocol::encodePose(pose, stream);
+        map_protocol::encodeSnapshotEnd(stream);
+
+        map_protocol::MessageReader reader;
+        std::vector<uint16_t> types;
+        map_protocol::MessageHeader header;
+        const uint8_t *payload;
+        for (size_t i = 0; i < stream.size(); i++)
+        {
+            reader.append(&stream[i], 1);
+            while (reader.next(header, payload))
+            {
+                types.push_back(header.type);
+                if (header.type == map_protocol::POSE)
+                {
+                    map_protocol::Pose read;
+                    CHECK(header.size == sizeof(read));
+                    memcpy(&read, payload, sizeof(read));
+                    CHECK(read.source == 1 && read.timestamp == 42);
+                }
+            }
+        }
+        CHECK((types == std::vector<uint16_t>{map_protocol::SNAPSHOT_END, map_protocol::POSE, map_protocol::SNAPSHOT_END}));
+        CHECK(!reader.hasError());
+    }
+
+    /// A message announced larger than the limit stops the reader before anything is buffered for it
+    void testMessageSize()
+    {
+        std::vector<uint8_t> stream;
+        map_protocol::encodeSnapshotEnd(stream);
+        appendHeader(0xfffffff0u, map_protocol::CHUNK, stream);
+        map_protocol::MessageReader reader;
+        reader.append(stream.data(), stream.size());
+        map_protocol::MessageHeader header;
+        const uint8_t *payload;
+        CHECK(reader.next(header, payload) && header.type == map_protocol::SNAPSHOT_END);
+        CHECK(!reader.next(header, payload));
+        CHECK(reader.hasError());
+        // Nothing more is read
+        std::vector<uint8_t> more;
+        map_protocol::encodeSnapshotEnd(more);
+        reader.append(more.data(), more.size());
+        CHECK(!reader.next(header, payload));
+
+        // The largest valid size is accepted
+        std::vector<uint8_t> limit;
+        appendHeader(map_protocol::MAX_MESSAGE_SIZE, map_protocol::CHUNK, limit);
+        map_protocol::MessageReader valid;
+        valid.append(limit.data(), limit.size());
+        CHECK(!valid.next(header, payload));
+        CHECK(!valid.hasError());
+    }
+
+    void testChunk()
+    {
+        ChunkData data;
+        for (int i = 0; i < 100; i++)
+            data.points.push_back({(float)i, (float)(i % 7), 3.f, 0x102030u});
+        data.bounds = {{0.f, 0.f, 3.f}, {99.f, 6.f, 3.f}};
+        std::vector<uint8_t> stream;
+        map_protocol::encodeChunk(2, map_protocol::MAX_CHUNK_INDEX, data, 0, 1.f, stream);
+
+        map_protocol::MessageReader reader;
+        reader.append(stream.data(), stream.size());
+        map_protocol::MessageHeader header;
+        const uint8_t *payload;
+        CHECK(reader.next(header, payload) && header.type == map_protocol::CHUNK);
+        map_protocol::ChunkHeader chunk;
+        std::vector<MapPoint> points;
+        CHECK(map_protocol::decodeChunk(payload, header.size, chunk, points));
+        CHECK(chunk.source == 2 && chunk.index == map_protocol::MAX_CHUNK_INDEX);
+        CHECK(points.size() == 100 && chunk.nbPointsFull == 100);
+        // Truncated
+        CHECK(!map_protocol::decodeChunk(payload, header.size - 1, chunk, points));
+    }
+}
+
+int main()
+{
+    testSplit();
+    testMessageSize();
+    testChunk();
+    return test::result("map_protocol");
+}
@@ -0,0 +1,176 @@
+#include "parallel_primitives.h"
+#include "test_common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Radix sort of keys of key_bits random bits, with their index as payload, against std::stable_sort
+    template <typename K>
+    void checkRadixSort(size_t n, int key_bits, std::mt19937_64 &rng)
+    {
+        const K mask = key_bits >= (int)sizeof(K) * 8 ? (K)~(K)0 : (K)(((K)1 << key_bits) - 1);
+        std::vector<K> keys(n);
+        for (auto &it : keys)
+            it = (K)rng() & mask;
+        std::vector<uint32_t> values(n);
+        for (size_t i = 0; i < n; i++)
+            values[i] = (uint32_t)i;
+
+        std::vector<std::pair<K, uint32_t>> expected(n);
+        for (size_t i = 0; i < n; i++)
+            expected[i] = std::make_pair(keys[i], values[i]);
+        std::stable_sort(expected.begin(), expected.end(), [](const std::pair<K, uint32_t> &a, const std::pair<K, uint32_t> &b) { return a.first < b.first; });
+
+        std::vector<K> keys_only = keys;
+        parallel::radixSort(keys.data(), values.data(), n);
+        parallel::radixSort(keys_only.data(), (uint32_t *)nullptr, n);
+
+        bool sorted = true, stable = true, same_keys = true;
+        for (size_t i = 0; i < n; i++)
+        {
+            sorted &= keys[i] == expected[i].first;
+            // Stable: equal keys keep the order of their indices
+            stable &= values[i] == expected[i].second;
+            same_keys &= keys_only[i] == keys[i];
+        }
+        CHECK(sorted);
+        CHECK(stable);
+        CHECK(same_keys);
+    }
+
+    void testRadixSort()
+    {
+        std::mt19937_64 rng(42);
+        const size_t large = 2 * parallel::MIN_BLOCK + 12345;
+        // n < 64 takes the insertion sort
+        for (size_t n : {(size_t)0, (size_t)1, (size_t)2, (size_t)17, (size_t)63, (size_t)64, (size_t)65, (size_t)1000, large})
+        {
+            checkRadixSort<uint32_t>(n, 32, rng);
+            checkRadixSort<uint64_t>(n, 64, rng);
+            // Few bits: many equal keys, the stability matters
+            checkRadixSort<uint32_t>(n, 3, rng);
+            checkRadixSort<uint64_t>(n, 20, rng);
+        }
+        // Bits that vary only in the high digits
+        {
+            std::vector<uint64_t> keys(large);
+            for (auto &it : keys)
+                it = (rng() & 0xf) << 50 | 0x123;
+            std::vector<uint64_t> expected = keys;
+            std::sort(expected.begin(), expected.end());
+            parallel::radixSort(keys.data(), (uint32_t *)nullptr, keys.size());
+            CHECK(keys == expected);
+        }
+        // All keys equal: no pass, nothing moves
+        for (size_t n : {(size_t)50, large})
+        {
+            std::vector<uint64_t> keys(n, 0xabcdef0123ull);
+            std::vector<uint32_t> values(n);
+            for (size_t i = 0; i < n; i++)
+                values[i] = (uint32_t)i;
+            parallel::radixSort(keys.data(), values.data(), n);
+            bool unchanged = true;
+            for (size_t i = 0; i < n; i++)
+                unchanged &= keys[i] == 0xabcdef0123ull && values[i] == (uint32_t)i;
+            CHECK(unchanged);
+        }
+    }
+
+    void testExclusiveScan()
+    {
+        std::mt19937_64 rng(7);
+        for (size_t n : {(size_t)0, (size_t)1, (size_t)100, 2 * parallel::MIN_BLOCK + 3, (size_t)1 << 20})
+        {
+            std::vector<uint64_t> in(n);
+            for (auto &it : in)
+                it = rng() % 1000;
+            std::vector<uint64_t> expected(n);
+            uint64_t sum = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                expected[i] = sum;
+                sum += in[i];
+            }
+            std::vector<uint64_t> out(n);
+            CHECK(parallel::exclusiveScan(in.data(), out.data(), n) == sum);
+            CHECK(out == expected);
+            // In place
+            CHECK(parallel::exclusiveScan(in.data(), in.data(), n) == sum);
+            CHECK(in == expected);
+        }
+    }
+
+    void testCompact()
+    {
+        std::mt19937_64 rng(3);
+        for (size_t n : {(size_t)0, (size_t)1, (size_t)100, 2 * parallel::MIN_BLOCK + 3, (size_t)1 << 20})
+        {
+            std::vector<uint32_t> in(n);
+            for (auto &it : in)
+                it = (uint32_t)rng();
+            for (uint32_t modulo : {1u, 2u, 7u, 0xffffffffu})
+            {
+                auto keep = [modulo](uint32_t v) { return v % modulo == 0; };
+                std::vector<uint32_t> expected;
+                for (uint32_t v : in)
+                    if (keep(v))
+                        expected.push_back(v);
+                std::vector<uint32_t> out(n);
+                const size_t count = parallel::compact(in.data(), n, out.data(), keep);
+                out.resize(count);
+                CHECK(out == expected);
+            }
+        }
+    }
+
+    void testForEach()
+    {
+        // Every index once, nested calls included
+        const size_t n = 1000;
+        std::vector<std::atomic<int>> seen(n * 8);
+        for (auto &it : seen)
+            it = 0;
+        parallel::forEach(n, [&](size_t i) { parallel::forEach(8, [&](size_t j) { seen[i * 8 + j]++; }); });
+        bool once = true;
+        for (auto &it : seen)
+            once &= it.load() == 1;
+        CHECK(once);
+
+        std::atomic<size_t> count(0);
+        parallel::forBlocks(100000, parallel::getNbBlocks(100000, 1000), [&](size_t, size_t begin, size_t end) { count += end - begin; });
+        CHECK(count.load() == 100000);
+    }
+
+    /// The loops nested in a low priority loop, on the workers and in the calling thread, stay low priority
+    void testPriorityInheritance()
+    {
+        CHECK(ThreadPool::getCurrentPriority() == ThreadPool::NORMAL);
+        std::atomic<int> nb_low(0), nb_other(0);
+        parallel::forEach(64, [&](size_t) {
+            parallel::forBlocks(4 * parallel::MIN_BLOCK, 4, [&](size_t, size_t, size_t) {
+                if (ThreadPool::getCurrentPriority() == ThreadPool::LOW)
+                    nb_low++;
+                else
+                    nb_other++;
+            });
+        }, 0, ThreadPool::LOW);
+        CHECK(nb_low.load() == 64 * 4 && nb_other.load() == 0);
+        CHECK(ThreadPool::getCurrentPriority() == ThreadPool::NORMAL);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    test::configurePool(argc, argv);
+    testRadixSort();
+    testExclusiveScan();
+    testCompact();
+    testForEach();
+    testPriorityInheritance();
+    return test::result("parallel primitives");
+}
@@ -0,0 +1,37 @@
+#include "parse_value.h"
+#include "test_common.h"
+
+namespace
+{
+    void testInt()
+    {
+        int v = -1;
+        CHECK(parse_value::toInt("42", v) && v == 42);
+        CHECK(parse_value::toInt("-3", v) && v == -3);
+        CHECK(!parse_value::toInt("4x", v));
+        CHECK(!parse_value::toInt("", v));
+    }
+
+    void testFloat()
+    {
+        float v = -1.f;
+        CHECK(parse_value::toFloat("30", v) && v == 30.f);
+        CHECK(parse_value::toFloat("0.35", v) && v == 0.35f);
+        CHECK(parse_value::toFloat("-2e3", v) && v == -2000.f);
+        // Not finite, the value is left unchanged
+        for (const char *value : {"inf", "-inf", "INF", "infinity", "nan", "NAN", "1e40"})
+        {
+            v = 7.f;
+            CHECK(!parse_value::toFloat(value, v) && v == 7.f);
+        }
+        CHECK(!parse_value::toFloat("2.5x", v));
+        CHECK(!parse_value::toFloat("", v));
+    }
+}
+
+int main()
+{
+    testInt();
+    testFloat();
+    return test::result("parse_value");
+}
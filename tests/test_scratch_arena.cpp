@@ -0,0 +1,85 @@
+#include "scratch_arena.h"
+#include "test_common.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    void testAllocations()
+    {
+        ScratchArena arena(1 << 16);
+        bool aligned = true;
+        std::vector<void *> blocks;
+        for (size_t bytes : {1, 7, 64, 65, 1000, 70000})
+        {
+            void *p = arena.allocate(bytes);
+            aligned &= reinterpret_cast<uintptr_t>(p) % 64 == 0;
+            blocks.push_back(p);
+        }
+        CHECK(aligned);
+        // A buffer given back is reused by the next allocation of its size class
+        arena.deallocate(blocks[4], 1000);
+        CHECK(arena.allocate(900) == blocks[4]);
+        // After a reset the same memory is handed out again
+        arena.reset();
+        CHECK(arena.allocate(1) == blocks[0]);
+    }
+
+    void testScopes()
+    {
+        ScratchArena &arena = ScratchArena::local();
+        void *first;
+        {
+            ScratchScope outer;
+            first = arena.allocate(100);
+            {
+                ScratchScope inner;
+                // Nested scopes do not release the memory of the outer one
+                ScratchVector<int> v(1000, 7);
+                CHECK(v[999] == 7);
+            }
+            CHECK(arena.allocate(100) != first);
+        }
+        ScratchScope scope;
+        CHECK(arena.allocate(100) == first);
+    }
+
+    /// A burst keeps its blocks for a while, then they are freed
+    void testTrim()
+    {
+        ScratchArena &arena = ScratchArena::local();
+        {
+            ScratchScope scope;
+            ScratchVector<uint8_t> burst(64 << 20);
+            burst[0] = 1;
+        }
+        const size_t burst_capacity = arena.getCapacity();
+        CHECK(burst_capacity >= (size_t)(64 << 20));
+        for (int i = 0; i < 200; i++)
+        {
+            ScratchScope scope;
+            ScratchVector<uint8_t> small(1000);
+            small[0] = 1;
+        }
+        // The block of the small uses is kept
+        CHECK(arena.getCapacity() < burst_capacity);
+        CHECK(arena.getCapacity() > 0 && arena.getCapacity() <= (size_t)(1 << 20));
+
+        arena.trim();
+        CHECK(arena.getCapacity() == 0);
+        {
+            ScratchScope scope;
+            ScratchVector<int> v(10, 1);
+            CHECK(v[9] == 1);
+        }
+    }
+}
+
+int main()
+{
+    testAllocations();
+    testScopes();
+    testTrim();
+    return test::result("scratch arena");
+}
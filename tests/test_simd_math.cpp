@@ -0,0 +1,245 @@
+#include "simd_math.h"
+#include "test_common.h"
+
+#include <cmath>
+#include <random>
+
+namespace
+{
+    /// Double precision references, row major like simd::Mat4 and sl::Transform
+    struct RefMat
+    {
+        double m[16];
+    };
+
+    RefMat toRef(const simd::Mat4 &a)
+    {
+        RefMat r;
+        for (int i = 0; i < 16; i++)
+            r.m[i] = a.m[i];
+        return r;
+    }
+
+    RefMat refMultiply(const RefMat &a, const RefMat &b)
+    {
+        RefMat r;
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+            {
+                r.m[i * 4 + j] = 0.;
+                for (int k = 0; k < 4; k++)
+                    r.m[i * 4 + j] += a.m[i * 4 + k] * b.m[k * 4 + j];
+            }
+        return r;
+    }
+
+    /// General inverse by Gauss-Jordan elimination, what the rigid inverse replaces
+    RefMat refInverse(const RefMat &a)
+    {
+        double m[4][8];
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 8; j++)
+                m[i][j] = j < 4 ? a.m[i * 4 + j] : (j - 4 == i ? 1. : 0.);
+        for (int c = 0; c < 4; c++)
+        {
+            int pivot = c;
+            for (int i = c + 1; i < 4; i++)
+                if (std::fabs(m[i][c]) > std::fabs(m[pivot][c]))
+                    pivot = i;
+            for (int j = 0; j < 8; j++)
+                std::swap(m[c][j], m[pivot][j]);
+            const double inv = 1. / m[c][c];
+            for (int j = 0; j < 8; j++)
+                m[c][j] *= inv;
+            for (int i = 0; i < 4; i++)
+                if (i != c)
+                {
+                    const double f = m[i][c];
+                    for (int j = 0; j < 8; j++)
+                        m[i][j] -= f * m[c][j];
+                }
+        }
+        RefMat r;
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+                r.m[i * 4 + j] = m[i][j + 4];
+        return r;
+    }
+
+    /// v rotated by the unit quaternion q: v + 2 w (u x v) + 2 u x (u x v)
+    void refRotate(const double *q, const double *v, double *out)
+    {
+        const double u[3] = {q[0], q[1], q[2]}, w = q[3];
+        const double c1[3] = {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+        const double c2[3] = {u[1] * c1[2] - u[2] * c1[1], u[2] * c1[0] - u[0] * c1[2], u[0] * c1[1] - u[1] * c1[0]};
+        for (int i = 0; i < 3; i++)
+            out[i] = v[i] + 2. * w * c1[i] + 2. * c2[i];
+    }
+
+    double maxError(const simd::Mat4 &a, const RefMat &b)
+    {
+        double e = 0.;
+        for (int i = 0; i < 16; i++)
+            e = std::max(e, std::fabs(a.m[i] - b.m[i]));
+        return e;
+    }
+
+    /// Random rigid transform, translations of up to 100 m in millimeters like the sample
+    simd::Mat4 randomRigid(std::mt19937 &rng, double *q, double *t)
+    {
+        std::normal_distribution<double> n(0., 1.);
+        std::uniform_real_distribution<double> u(-1e5, 1e5);
+        double norm = 0.;
+        for (int i = 0; i < 4; i++)
+        {
+            q[i] = n(rng);
+            norm += q[i] * q[i];
+        }
+        norm = std::sqrt(norm);
+        float qf[4], tf[3];
+        for (int i = 0; i < 4; i++)
+        {
+            q[i] /= norm;
+            qf[i] = (float)q[i];
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            t[i] = u(rng);
+            tf[i] = (float)t[i];
+        }
+        return simd::fromQuatTranslation(qf, tf);
+    }
+
+    void testFromQuatTranslation()
+    {
+        std::mt19937 rng(1);
+        double worst = 0.;
+        for (int it = 0; it < 1000; it++)
+        {
+            double q[4], t[3];
+            const simd::Mat4 a = randomRigid(rng, q, t);
+            // Columns are the rotated axes, the last one the translation
+            for (int axis = 0; axis < 3; axis++)
+            {
+                const double v[3] = {axis == 0 ? 1. : 0., axis == 1 ? 1. : 0., axis == 2 ? 1. : 0.};
+                double r[3];
+                refRotate(q, v, r);
+                for (int i = 0; i < 3; i++)
+                    worst = std::max(worst, std::fabs(a.m[i * 4 + axis] - r[i]));
+            }
+            for (int i = 0; i < 3; i++)
+                worst = std::max(worst, std::fabs(a.m[i * 4 + 3] - t[i]) / 1e5);
+            worst = std::max(worst, (double)(std::fabs(a.m[12]) + std::fabs(a.m[13]) + std::fabs(a.m[14]) + std::fabs(a.m[15] - 1.f)));
+        }
+        CHECK(worst < 1e-5);
+    }
+
+    void testRigidInverse()
+    {
+        std::mt19937 rng(2);
+        double worst_rotation = 0., worst_translation = 0., worst_identity = 0.;
+        for (int it = 0; it < 1000; it++)
+        {
+            double q[4], t[3];
+            const simd::Mat4 a = randomRigid(rng, q, t);
+            const simd::Mat4 inv = simd::rigidInverse(a);
+            const RefMat expected = refInverse(toRef(a));
+            for (int i = 0; i < 16; i++)
+            {
+                // Translations are up to 1e5, relative error there
+                const double e = std::fabs(inv.m[i] - expected.m[i]);
+                if (i == 3 || i == 7 || i == 11)
+                    worst_translation = std::max(worst_translation, e / 1e5);
+                else
+                    worst_rotation = std::max(worst_rotation, e);
+            }
+            const simd::Mat4 id = simd::multiply(inv, a);
+            const simd::Mat4 ref_id = simd::identity();
+            for (int i = 0; i < 16; i++)
+                worst_identity = std::max(worst_identity, std::fabs(id.m[i] - ref_id.m[i]) / ((i % 4) == 3 ? 1e5 : 1.));
+        }
+        CHECK(worst_rotation < 1e-5);
+        CHECK(worst_translation < 1e-5);
+        CHECK(worst_identity < 1e-5);
+    }
+
+    void testMultiply()
+    {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> u(-10.f, 10.f);
+        double worst = 0.;
+        for (int it = 0; it < 1000; it++)
+        {
+            simd::Mat4 a, b;
+            for (int i = 0; i < 16; i++)
+            {
+                a.m[i] = u(rng);
+                b.m[i] = u(rng);
+            }
+            worst = std::max(worst, maxError(simd::multiply(a, b), refMultiply(toRef(a), toRef(b))));
+        }
+        CHECK(worst < 1e-3);
+    }
+
+    /// View-projection of the viewer: perspective times the inverse of the camera pose
+    void testProjection()
+    {
+        std::mt19937 rng(4);
+        std::uniform_real_distribution<double> u(-1., 1.);
+        const float znear = 100.f, zfar = 1e6f, fov_x = 1.4f, fov_y = 1.f;
+        simd::Mat4 projection = simd::identity();
+        projection.m[0] = 1.f / std::tan(fov_x * 0.5f);
+        projection.m[5] = 1.f / std::tan(fov_y * 0.5f);
+        projection.m[10] = -(zfar + znear) / (zfar - znear);
+        projection.m[11] = -(2.f * zfar * znear) / (zfar - znear);
+        projection.m[14] = -1.f;
+        projection.m[15] = 0.f;
+
+        double worst = 0.;
+        for (int it = 0; it < 200; it++)
+        {
+            double q[4], t[3];
+            const simd::Mat4 pose = randomRigid(rng, q, t);
+            const simd::Mat4 vp = simd::multiply(projection, simd::rigidInverse(pose));
+            const RefMat ref_vp = refMultiply(toRef(projection), refInverse(toRef(pose)));
+            // Points in front of the camera project to the same normalized coordinates
+            for (int p = 0; p < 10; p++)
+            {
+                const double local[3] = {u(rng) * 1000., u(rng) * 1000., -(1000. + 5000. * (u(rng) + 1.))};
+                double world[3];
+                refRotate(q, local, world);
+                for (int i = 0; i < 3; i++)
+                    world[i] += t[i];
+                double clip[4], ref_clip[4];
+                for (int i = 0; i < 4; i++)
+                {
+                    clip[i] = vp.m[i * 4 + 3];
+                    ref_clip[i] = ref_vp.m[i * 4 + 3];
+                    for (int j = 0; j < 3; j++)
+                    {
+                        clip[i] += vp.m[i * 4 + j] * world[j];
+                        ref_clip[i] += ref_vp.m[i * 4 + j] * world[j];
+                    }
+                }
+                for (int i = 0; i < 3; i++)
+                    worst = std::max(worst, std::fabs(clip[i] / clip[3] - ref_clip[i] / ref_clip[3]));
+            }
+        }
+        // Normalized device coordinates, in [-1, 1]
+        CHECK(worst < 1e-3);
+    }
+}
+
+int main()
+{
+#ifdef SIMD_MATH_SSE
+    std::cout << "[Test] SSE path" << std::endl;
+#else
+    std::cout << "[Test] plain C++ path" << std::endl;
+#endif
+    testFromQuatTranslation();
+    testRigidInverse();
+    testMultiply();
+    testProjection();
+    return test::result("simd math");
+}
@@ -0,0 +1,113 @@
+#include "thread_pool.h"
+#include "test_common.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /// Waiting for a group only runs the tasks of that group
+    void testWaitRunsOwnGroup()
+    {
+        ThreadPool pool(2);
+        std::atomic<bool> go(false);
+        std::atomic<int> nb_started(0);
+        ThreadPool::TaskGroup busy;
+        for (int i = 0; i < 2; i++)
+            pool.submit(busy, [&] {
+                nb_started++;
+                while (!go)
+                    std::this_thread::yield();
+            }, ThreadPool::NORMAL, i);
+        while (nb_started.load() < 2)
+            std::this_thread::yield();
+
+        ThreadPool::TaskGroup other;
+        std::atomic<bool> other_ran(false);
+        pool.submit(other, [&] { other_ran = true; }, ThreadPool::LOW, 0);
+        ThreadPool::TaskGroup mine;
+        std::thread::id ran_on;
+        pool.submit(mine, [&] { ran_on = std::this_thread::get_id(); }, ThreadPool::HIGH, 1);
+        pool.wait(mine);
+        // The workers are busy, so the task of the group ran in the waiting thread, the other one is still queued
+        CHECK(ran_on == std::this_thread::get_id());
+        CHECK(!other_ran);
+
+        go = true;
+        pool.wait(busy);
+        pool.wait(other);
+        CHECK(other_ran);
+    }
+
+    /// A waiting thread sleeps until the tasks running elsewhere are done
+    void testWaitForRunningTasks()
+    {
+        ThreadPool pool(1);
+        ThreadPool::TaskGroup group;
+        std::atomic<bool> started(false), done(false);
+        pool.submit(group, [&] {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            done = true;
+        });
+        while (!started)
+            std::this_thread::yield();
+        pool.wait(group);
+        CHECK(done);
+    }
+
+    /// Higher priorities are taken first
+    void testPriorities()
+    {
+        ThreadPool pool(1);
+        std::atomic<bool> go(false), started(false);
+        ThreadPool::TaskGroup group;
+        pool.submit(group, [&] {
+            started = true;
+            while (!go)
+                std::this_thread::yield();
+        });
+        while (!started)
+            std::this_thread::yield();
+        std::string order;
+        std::atomic<int> nb_done(0);
+        for (int i = 0; i < 3; i++)
+            pool.submit(group, [&] {
+                order += 'L';
+                nb_done++;
+            }, ThreadPool::LOW);
+        for (int i = 0; i < 3; i++)
+            pool.submit(group, [&] {
+                order += 'H';
+                nb_done++;
+            }, ThreadPool::HIGH);
+        // Run by the worker only: the waiting thread would take them in its own order
+        go = true;
+        while (nb_done.load() < 6)
+            std::this_thread::yield();
+        pool.wait(group);
+        CHECK(order == "HHHLLL");
+    }
+
+    void testNoWorkers()
+    {
+        ThreadPool pool(0);
+        ThreadPool::TaskGroup group;
+        int count = 0;
+        for (int i = 0; i < 10; i++)
+            pool.submit(group, [&] { count++; });
+        pool.wait(group);
+        CHECK(count == 10);
+    }
+}
+
+int main()
+{
+    testWaitRunsOwnGroup();
+    testWaitForRunningTasks();
+    testPriorities();
+    testNoWorkers();
+    return test::result("thread pool");
+}
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Generate src/zed_model.cpp, the indexed meshes of the ZED cameras drawn by the viewer.
+
+The input is the former include/zed_model.h of the sample (kept as tools/zed_model_soup.h): per
+camera, a vertex array in meters and triangle soups of 1-based vertex indices, one per color. The
+output shares the vertices within a color, scaled to millimeters and interleaved with the color.
+
+    python3 tools/gen_zed_model.py [input] [output]
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def namespace_block(src, name):
+    begin = src.index('namespace ' + name)
+    return src[begin:src.index('\n}\n', begin)]
+
+
+def array(block, name, type_name):
+    m = re.search(r'const\s+%s\s+%s\[\]\s*=\s*\{(.*?)\};' % (type_name, name), block, re.S)
+    cast = float if type_name == 'float' else int
+    return [cast(x) for x in re.findall(r'-?\d+\.?\d*', m.group(1))]
+
+
+def color(block, name):
+    m = re.search(r'sl::float3\s+%s\(([^)]*)\)' % name, block)
+    return [float(x.strip().rstrip('f')) for x in m.group(1).split(',')]
+
+
+def count(block, name):
+    return int(re.search(r'const int %s = (\d+);' % name, block).group(1))
+
+
+def part(block, triangles, nb_triangles, color_block, color_name):
+    return (array(block, triangles, 'int'), count(block, nb_triangles), color(color_block, color_name))
+
+
+def models(src):
+    """Vertices and colored parts of each mesh, in the order of the output"""
+    zed = namespace_block(src, 'ZED_model')
+    zed_m = namespace_block(src, 'ZED_M_model')
+    zed_vertices = array(zed, 'vertices', 'float')
+    return [
+        ('zed', zed_vertices, [
+            part(zed, 'alluminiumTriangles', 'nb_aluTriangle', zed, 'alluColor'),
+            part(zed, 'darkTriangles', 'nb_darkTriangle', zed, 'darkColor')]),
+        # Same shape as the ZED, dark body and grey front
+        ('zed2', zed_vertices, [
+            part(zed, 'alluminiumTriangles', 'nb_aluTriangle', zed, 'darkColor'),
+            part(zed, 'darkTriangles', 'nb_darkTriangle', zed_m, 'greyColor')]),
+        ('zed_m', array(zed_m, 'vertices', 'float'), [
+            part(zed_m, 'alluminiumTriangles', 'nb_aluTriangle', zed_m, 'alluColor'),
+            part(zed_m, 'darkTriangles', 'nb_darkTriangle', zed_m, 'darkColor'),
+            part(zed_m, 'greyTriangles', 'nb_greyTriangle', zed_m, 'greyColor'),
+            part(zed_m, 'yellowTriangles', 'nb_yellowTriangle', zed_m, 'yellowColor')]),
+    ]
+
+
+def index_mesh(vertices, parts):
+    """Interleaved vertices (x, y, z in millimeters, r, g, b) and the 0-based indices of the triangles"""
+    index_of = {}
+    out_vertices = []
+    out_indices = []
+    for triangles, nb_triangles, rgb in parts:
+        assert len(triangles) >= nb_triangles * 3
+        for t in triangles[:nb_triangles * 3]:
+            key = (t - 1, tuple(rgb))
+            if key not in index_of:
+                index_of[key] = len(out_vertices)
+                k = (t - 1) * 3
+                out_vertices.append([x * 1000 for x in vertices[k:k + 3]] + rgb)
+            out_indices.append(index_of[key])
+    assert len(out_vertices) < 65536, 'the indices are 16 bits'
+    return out_vertices, out_indices
+
+
+def fmt(x):
+    s = ('%.3f' % x).rstrip('0')
+    if s.endswith('.'):
+        s += '0'
+    if s == '-0.0':
+        s = '0.0'
+    return s + 'f'
+
+
+HEADER = '''// Generated by tools/gen_zed_model.py from tools/zed_model_soup.h, do not edit
+#include "zed_model.h"
+
+#include <iostream>
+
+// ZED camera meshes, in millimeters, with shared vertices.
+// Each vertex is interleaved as x, y, z, r, g, b; a vertex used by two parts of different colors is duplicated.
+
+namespace
+{'''
+
+FOOTER = '''}
+
+const ZEDModelMesh &getZEDModelMesh(CameraModel model)
+{
+    switch (model)
+    {
+    case CameraModel::ZED:
+        return zed_mesh;
+    case CameraModel::ZED_M:
+        return zed_m_mesh;
+    case CameraModel::ZED2:
+    case CameraModel::ZED2i:
+        // Same shape
+        return zed2_mesh;
+    default:
+        std::cout << "[Sample] No mesh for the camera model " << (int)model << ", drawn as a ZED 2" << std::endl;
+        return zed2_mesh;
+    }
+}
+'''
+
+
+def generate(src):
+    out = [HEADER]
+    for name, vertices, parts in models(src):
+        mesh_vertices, mesh_indices = index_mesh(vertices, parts)
+        out.append('    const float %s_vertices[] = {' % name)
+        out.append(',\n'.join('        ' + ', '.join(fmt(x) for x in v) for v in mesh_vertices) + '};\n')
+        out.append('    const unsigned short %s_indices[] = {' % name)
+        out.append(',\n'.join('        ' + ', '.join(str(i) for i in mesh_indices[j:j + 3])
+                              for j in range(0, len(mesh_indices), 3)) + '};\n')
+        out.append('    const ZEDModelMesh %s_mesh = {%s_vertices, %d, %s_indices, %d};\n'
+                   % (name, name, len(mesh_vertices), name, len(mesh_indices)))
+        print('%s: %d vertices, %d triangles' % (name, len(mesh_vertices), len(mesh_indices) // 3))
+    out[-1] = out[-1].rstrip('\n')
+    out.append(FOOTER)
+    return '\n'.join(out)
+
+
+def main():
+    src_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT, 'tools', 'zed_model_soup.h')
+    out_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(ROOT, 'src', 'zed_model.cpp')
+    with open(src_path) as f:
+        src = f.read()
+    with open(out_path, 'w') as f:
+        f.write(generate(src))
+
+
+if __name__ == '__main__':
+    main()